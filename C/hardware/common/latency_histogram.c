@@ -0,0 +1,325 @@
+//////////////////////////////////////////////////////////////////
+//
+// latency_histogram.c - C file
+//
+// Implements the latency histogram described in latency_histogram.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "latency_histogram.h"
+
+#define SUB_BUCKETS     ((t_uint64) 1 << LATENCY_HISTOGRAM_SUB_BITS)    /* latencies below this have a bucket each */
+
+static t_uint32
+most_significant_bit(t_uint64 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, (unsigned long) (value >> 32)))
+        return 32 + index;
+    _BitScanReverse(&index, (unsigned long) value);
+    return index;
+#else
+    return 63 - (t_uint32) __builtin_clzll(value);
+#endif
+}
+
+/*
+    Returns the bucket holding the latency. Latencies below SUB_BUCKETS have a bucket each. Above
+    that, the latency is shifted right until it has LATENCY_HISTOGRAM_SUB_BITS bits, and each shift
+    adds another SUB_BUCKETS / 2 buckets.
+*/
+static t_uint32
+bucket_index(t_uint64 latency)
+{
+    t_uint32 shift;
+
+    if (latency < SUB_BUCKETS)
+        return (t_uint32) latency;
+
+    shift = most_significant_bit(latency) - LATENCY_HISTOGRAM_SUB_BITS + 1;
+    if (shift > LATENCY_HISTOGRAM_MAX_BITS - LATENCY_HISTOGRAM_SUB_BITS)
+        return LATENCY_HISTOGRAM_BUCKETS - 1;
+
+    return (t_uint32) (((t_uint64) shift << (LATENCY_HISTOGRAM_SUB_BITS - 1)) + (latency >> shift));
+}
+
+/*
+    Returns the smallest latency held by the bucket.
+*/
+static t_uint64
+bucket_lower_bound(t_uint32 index)
+{
+    t_uint32 shift;
+
+    if (index < SUB_BUCKETS)
+        return index;
+
+    shift = (index >> (LATENCY_HISTOGRAM_SUB_BITS - 1)) - 1;
+    return (index - ((t_uint64) shift << (LATENCY_HISTOGRAM_SUB_BITS - 1))) << shift;
+}
+
+/*
+    Returns the largest latency held by the bucket.
+*/
+static t_uint64
+bucket_upper_bound(t_uint32 index)
+{
+    t_uint32 shift;
+
+    if (index < SUB_BUCKETS)
+        return index;
+
+    shift = (index >> (LATENCY_HISTOGRAM_SUB_BITS - 1)) - 1;
+    return bucket_lower_bound(index) + ((t_uint64) 1 << shift) - 1;
+}
+
+void
+latency_histogram_init(struct latency_histogram * histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+    histogram->minimum = ~(t_uint64) 0;
+}
+
+t_uint64
+latency_histogram_interval(const t_timeout * start_time, const t_timeout * stop_time)
+{
+    const t_int64 nanoseconds = ((t_int64) stop_time->seconds - start_time->seconds) * 1000000000
+                              + ((t_int64) stop_time->nanoseconds - start_time->nanoseconds);
+
+    return (nanoseconds > 0) ? (t_uint64) nanoseconds : 0;
+}
+
+void
+latency_histogram_record(struct latency_histogram * histogram, t_uint64 latency)
+{
+    histogram->counts[bucket_index(latency)]++;
+    histogram->time           += latency;
+    histogram->sum_of_squares += (t_double) latency * (t_double) latency;
+
+    if (latency < histogram->minimum)
+        histogram->minimum = latency;
+    if (latency > histogram->maximum)
+        histogram->maximum = latency;
+
+    /* Keep the slowest calls, replacing the fastest of them once the list is full */
+    if (histogram->num_worst < LATENCY_HISTOGRAM_WORST)
+    {
+        struct latency_sample * sample = &histogram->worst[histogram->num_worst++];
+
+        sample->iteration = histogram->count;
+        sample->time      = histogram->time;
+        sample->latency   = latency;
+    }
+    else
+    {
+        t_uint32 fastest = 0;
+        t_uint32 index;
+
+        for (index = 1; index < LATENCY_HISTOGRAM_WORST; index++)
+        {
+            if (histogram->worst[index].latency < histogram->worst[fastest].latency)
+                fastest = index;
+        }
+
+        if (latency > histogram->worst[fastest].latency)
+        {
+            histogram->worst[fastest].iteration = histogram->count;
+            histogram->worst[fastest].time      = histogram->time;
+            histogram->worst[fastest].latency   = latency;
+        }
+    }
+
+    histogram->count++;
+}
+
+void
+latency_histogram_start(struct latency_histogram * histogram, t_timeout * previous_time)
+{
+    t_uint64 overhead;
+    t_uint32 index;
+
+    /* Time empty intervals exactly as the calls will be timed. The shortest never overstates the overhead. */
+    latency_histogram_init(histogram);
+    timeout_get_high_resolution_time(previous_time);
+    for (index = 0; index < LATENCY_HISTOGRAM_CALIBRATION; index++)
+        latency_histogram_record_call(histogram, previous_time);
+
+    overhead = histogram->minimum;
+    latency_histogram_init(histogram);
+    histogram->overhead = overhead;
+
+    timeout_get_high_resolution_time(previous_time);
+}
+
+void
+latency_histogram_record_call(struct latency_histogram * histogram, t_timeout * previous_time)
+{
+    t_timeout call_time;
+    t_uint64  latency;
+
+    timeout_get_high_resolution_time(&call_time);
+    latency = latency_histogram_interval(previous_time, &call_time);
+    *previous_time = call_time;
+
+    latency_histogram_record(histogram, (latency > histogram->overhead) ? latency - histogram->overhead : 0);
+}
+
+t_uint64
+latency_histogram_percentile(const struct latency_histogram * histogram, t_double percentile)
+{
+    t_uint64 rank;
+    t_uint64 total = 0;
+    t_uint32 index;
+
+    if (histogram->count == 0)
+        return 0;
+
+    /* The rank of the latency sought, counting from one */
+    rank = (t_uint64) ceil(percentile / 100.0 * (t_double) histogram->count);
+    if (rank < 1)
+        rank = 1;
+
+    for (index = 0; index < LATENCY_HISTOGRAM_BUCKETS; index++)
+    {
+        total += histogram->counts[index];
+        if (total >= rank)
+        {
+            /* The last bucket also holds every latency too long for the others */
+            const t_uint64 upper_bound = (index < LATENCY_HISTOGRAM_BUCKETS - 1) ? bucket_upper_bound(index) : histogram->maximum;
+            return (upper_bound < histogram->maximum) ? upper_bound : histogram->maximum;
+        }
+    }
+
+    return histogram->maximum;
+}
+
+t_double
+latency_histogram_mean(const struct latency_histogram * histogram)
+{
+    return (histogram->count > 0) ? (t_double) histogram->time / (t_double) histogram->count : 0;
+}
+
+t_double
+latency_histogram_standard_deviation(const struct latency_histogram * histogram)
+{
+    t_double mean;
+    t_double variance;
+
+    if (histogram->count == 0)
+        return 0;
+
+    mean     = latency_histogram_mean(histogram);
+    variance = histogram->sum_of_squares / (t_double) histogram->count - mean * mean;
+    return (variance > 0) ? sqrt(variance) : 0;
+}
+
+/*
+    Sort the slowest calls into the order in which they happened.
+*/
+static void
+sort_worst(const struct latency_histogram * histogram, struct latency_sample worst[])
+{
+    t_uint32 index;
+
+    memcpy(worst, histogram->worst, histogram->num_worst * sizeof(worst[0]));
+    for (index = 1; index < histogram->num_worst; index++)
+    {
+        const struct latency_sample sample = worst[index];
+        t_uint32 position = index;
+
+        while (position > 0 && worst[position - 1].iteration > sample.iteration)
+        {
+            worst[position] = worst[position - 1];
+            --position;
+        }
+
+        worst[position] = sample;
+    }
+}
+
+void
+latency_histogram_print(const struct latency_histogram * histogram)
+{
+    struct latency_sample worst[LATENCY_HISTOGRAM_WORST];
+    t_uint32 index;
+
+    if (histogram->count == 0)
+        return;
+
+    printf("Latency per call (usecs): min %.3f  p50 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n",
+        histogram->minimum * 1e-3,
+        latency_histogram_percentile(histogram, 50) * 1e-3,
+        latency_histogram_percentile(histogram, 99) * 1e-3,
+        latency_histogram_percentile(histogram, 99.9) * 1e-3,
+        histogram->maximum * 1e-3);
+
+    printf("Jitter (usecs): standard deviation %.3f, peak to peak %.3f\n",
+        latency_histogram_standard_deviation(histogram) * 1e-3, (histogram->maximum - histogram->minimum) * 1e-3);
+
+    if (histogram->overhead > 0)
+        printf("Each latency excludes %.3f usecs measured for reading the clock and recording the latency.\n", histogram->overhead * 1e-3);
+
+    printf("Slowest calls:\n");
+    sort_worst(histogram, worst);
+    for (index = 0; index < histogram->num_worst; index++)
+        printf("    iteration %8.0f at %12.3f ms took %10.3f usecs\n",
+            (double) worst[index].iteration, worst[index].time * 1e-6, worst[index].latency * 1e-3);
+}
+
+t_int
+latency_histogram_write_json(const struct latency_histogram * histogram, const char * operation, FILE * file)
+{
+    struct latency_sample worst[LATENCY_HISTOGRAM_WORST];
+    const char * separator = "";
+    t_uint32 index;
+
+    sort_worst(histogram, worst);
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"operation\": \"%s\",\n", operation);
+    fprintf(file, "  \"iterations\": %.0f,\n", (double) histogram->count);
+    fprintf(file, "  \"total_ns\": %.0f,\n", (double) histogram->time);
+    fprintf(file, "  \"min_ns\": %.0f,\n", (double) (histogram->count > 0 ? histogram->minimum : 0));
+    fprintf(file, "  \"mean_ns\": %.1f,\n", latency_histogram_mean(histogram));
+    fprintf(file, "  \"p50_ns\": %.0f,\n", (double) latency_histogram_percentile(histogram, 50));
+    fprintf(file, "  \"p90_ns\": %.0f,\n", (double) latency_histogram_percentile(histogram, 90));
+    fprintf(file, "  \"p99_ns\": %.0f,\n", (double) latency_histogram_percentile(histogram, 99));
+    fprintf(file, "  \"p99_9_ns\": %.0f,\n", (double) latency_histogram_percentile(histogram, 99.9));
+    fprintf(file, "  \"p99_99_ns\": %.0f,\n", (double) latency_histogram_percentile(histogram, 99.99));
+    fprintf(file, "  \"max_ns\": %.0f,\n", (double) histogram->maximum);
+    fprintf(file, "  \"stddev_ns\": %.1f,\n", latency_histogram_standard_deviation(histogram));
+    fprintf(file, "  \"overhead_ns\": %.0f,\n", (double) histogram->overhead);
+
+    fprintf(file, "  \"worst\": [");
+    for (index = 0; index < histogram->num_worst; index++)
+    {
+        fprintf(file, "%s\n    { \"iteration\": %.0f, \"time_ns\": %.0f, \"latency_ns\": %.0f }", separator,
+            (double) worst[index].iteration, (double) worst[index].time, (double) worst[index].latency);
+        separator = ",";
+    }
+    fprintf(file, "\n  ],\n");
+
+    /* Only the buckets that were used, as [smallest latency in ns, count] */
+    separator = "";
+    fprintf(file, "  \"buckets\": [");
+    for (index = 0; index < LATENCY_HISTOGRAM_BUCKETS; index++)
+    {
+        if (histogram->counts[index] != 0)
+        {
+            fprintf(file, "%s\n    [%.0f, %.0f]", separator, (double) bucket_lower_bound(index), (double) histogram->counts[index]);
+            separator = ",";
+        }
+    }
+    fprintf(file, "\n  ]\n");
+
+    return (fprintf(file, "}\n") > 0 && !ferror(file)) ? 0 : -1;
+}
@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////
+//
+// latency_histogram.h - header file
+//
+// Records the time taken by each call in a performance example so that
+// the whole distribution can be reported rather than only the mean. A
+// mean of 1 usec per call can hide a few calls of 500 usecs, and it is
+// those calls that make a 1 kHz control loop miss its deadline.
+//
+// Latencies are counted in a log-linear histogram, as in an HDR
+// histogram: each power of two is divided into 128 equal buckets, so
+// every latency from 1 ns to about 18 minutes is recorded to within
+// 0.8% using a fixed array of counts. Recording a latency takes a few
+// nanoseconds and never allocates memory. The minimum, maximum, mean
+// and standard deviation are kept exactly, along with the slowest
+// calls, when they happened and which iteration they were.
+//
+// A series of calls is timed with latency_histogram_start and
+// latency_histogram_record_call. Only one timestamp is taken per call,
+// at its end, so that timing adds as little as possible to each call.
+// Each interval therefore runs from the end of the previous call and
+// also covers reading the clock and recording the previous latency.
+// That overhead is measured when timing starts, as the shortest of
+// many intervals with no call in them, and is subtracted from every
+// latency, so the histogram holds the time taken by the calls alone.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _latency_histogram_h
+#define _latency_histogram_h
+
+#include <stdio.h>
+
+#include "quanser_types.h"
+#include "quanser_time.h"
+
+#define LATENCY_HISTOGRAM_SUB_BITS      (8)     /* buckets per power of two are 2^(LATENCY_HISTOGRAM_SUB_BITS - 1) */
+#define LATENCY_HISTOGRAM_MAX_BITS      (40)    /* latencies of 2^LATENCY_HISTOGRAM_MAX_BITS ns or more share the last bucket */
+#define LATENCY_HISTOGRAM_BUCKETS       ((LATENCY_HISTOGRAM_MAX_BITS - LATENCY_HISTOGRAM_SUB_BITS + 2) << (LATENCY_HISTOGRAM_SUB_BITS - 1))
+#define LATENCY_HISTOGRAM_WORST         (10)    /* number of slowest calls kept */
+#define LATENCY_HISTOGRAM_CALIBRATION   (1000)  /* empty intervals timed to measure the overhead of timing a call */
+
+/*
+    One recorded call.
+*/
+struct latency_sample
+{
+    t_uint64 iteration;     /* index of the call, starting at zero */
+    t_uint64 time;          /* time at which the call ended, in ns since the first call started */
+    t_uint64 latency;       /* duration of the call in ns */
+};
+
+struct latency_histogram
+{
+    t_uint64 counts[LATENCY_HISTOGRAM_BUCKETS];         /* number of latencies in each bucket */
+    t_uint64 count;                                     /* number of latencies recorded */
+    t_uint64 minimum;                                   /* shortest latency in ns */
+    t_uint64 maximum;                                   /* longest latency in ns */
+    t_uint64 time;                                      /* sum of the latencies in ns */
+    t_double sum_of_squares;                            /* sum of the squares of the latencies in ns^2 */
+    struct latency_sample worst[LATENCY_HISTOGRAM_WORST];   /* slowest calls, in no particular order */
+    t_uint32 num_worst;                                 /* number of entries in worst */
+    t_uint64 overhead;                                  /* ns subtracted from each latency for the timing itself */
+};
+
+/*
+    Empty the histogram.
+*/
+extern void
+latency_histogram_init(struct latency_histogram * histogram);
+
+/*
+    Returns the number of nanoseconds from the start time to the stop time, as returned by
+    timeout_get_high_resolution_time.
+*/
+extern t_uint64
+latency_histogram_interval(const t_timeout * start_time, const t_timeout * stop_time);
+
+/*
+    Empty the histogram, measure the overhead of timing a call with latency_histogram_record_call,
+    and get the time at which the first call starts.
+*/
+extern void
+latency_histogram_start(struct latency_histogram * histogram, t_timeout * previous_time);
+
+/*
+    Record the call that has just ended, which started at the previous time, less the overhead of
+    timing it. The previous time becomes the time at which the call ended.
+*/
+extern void
+latency_histogram_record_call(struct latency_histogram * histogram, t_timeout * previous_time);
+
+/*
+    Record the latency of the next call in ns. Calls are assumed to follow one another, so the
+    call ends at the sum of all the latencies recorded so far.
+*/
+extern void
+latency_histogram_record(struct latency_histogram * histogram, t_uint64 latency);
+
+/*
+    Returns the latency in ns below which the given percentage of the calls fall, such as 99.9
+    for the 99.9th percentile. The value is accurate to within 0.8%.
+*/
+extern t_uint64
+latency_histogram_percentile(const struct latency_histogram * histogram, t_double percentile);
+
+/*
+    Returns the mean latency in ns.
+*/
+extern t_double
+latency_histogram_mean(const struct latency_histogram * histogram);
+
+/*
+    Returns the standard deviation of the latencies in ns.
+*/
+extern t_double
+latency_histogram_standard_deviation(const struct latency_histogram * histogram);
+
+/*
+    Print the percentiles, jitter and slowest calls to the console.
+*/
+extern void
+latency_histogram_print(const struct latency_histogram * histogram);
+
+/*
+    Write the statistics, slowest calls and non-empty buckets of the histogram to the file as a JSON
+    object, naming the operation measured. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+latency_histogram_write_json(const struct latency_histogram * histogram, const char * operation, FILE * file);
+
+#endif
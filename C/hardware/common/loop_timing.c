@@ -0,0 +1,229 @@
+//////////////////////////////////////////////////////////////////
+//
+// loop_timing.c - C file
+//
+// Implements the loop timing instrumentation described in loop_timing.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "loop_timing.h"
+
+#define RING_MASK   (LOOP_TIMING_RING_SIZE - 1)
+
+void
+loop_timing_init(struct loop_timing * timing, t_double period)
+{
+    memset(timing, 0, sizeof(*timing));
+
+    timing->period           = (t_uint64) (period * 1e9 + 0.5);
+    timing->minimum_interval = ~(t_uint64) 0;
+
+    latency_histogram_init(&timing->deviation);
+    latency_histogram_init(&timing->compute);
+    latency_histogram_init(&timing->write);
+}
+
+static void
+anchor(struct loop_timing * timing, const t_timeout * now)
+{
+    timing->anchor_time          = *now;
+    timing->samples_since_anchor = 0;
+}
+
+void
+loop_timing_wake(struct loop_timing * timing)
+{
+    t_timeout now;
+
+    timeout_get_high_resolution_time(&now);
+    if (timing->awake)
+    {
+        const t_uint64 interval = latency_histogram_interval(&timing->wake_time, &now);
+
+        timing->interval = interval;
+        if (interval < timing->minimum_interval)
+            timing->minimum_interval = interval;
+        if (interval > timing->maximum_interval)
+            timing->maximum_interval = interval;
+
+        /* A wake-up half a period late means a sample was processed a full period late or worse */
+        if (interval > timing->period + timing->period / 2)
+            timing->late_wakeups++;
+        else if (interval < timing->period / 2)
+            timing->early_wakeups++;
+
+        latency_histogram_record(&timing->deviation,
+            (interval > timing->period) ? interval - timing->period : timing->period - interval);
+    }
+
+    timing->backlog = 0;
+    timing->samples_since_anchor++;
+
+    /*
+        A read that waited for a good part of a period returned a sample that had only just arrived,
+        so the loop is up to date and the schedule is anchored here. A read that waited for much longer
+        than a period was kept from running while samples arrived, and one that did not wait returned
+        a sample that was already waiting. In either case any whole periods elapsed beyond the schedule
+        are samples waiting behind the one read.
+    */
+    if (!timing->awake)
+        anchor(timing, &now);
+    else
+    {
+        const t_uint64 blocked  = latency_histogram_interval(&timing->sleep_time, &now);
+        const t_uint64 elapsed  = latency_histogram_interval(&timing->anchor_time, &now);
+        const t_uint64 expected = timing->samples_since_anchor * timing->period;
+
+        if ((blocked >= timing->period / 4 && blocked < timing->period + timing->period / 4) || elapsed < expected)
+            anchor(timing, &now);   /* up to date, or the sample arrived earlier than the schedule predicted */
+        else if (elapsed - expected >= timing->period)
+        {
+            const t_uint64 backlog = (elapsed - expected) / timing->period;
+
+            timing->backlog = (backlog < 0xFFFFFFFFu) ? (t_uint32) backlog : 0xFFFFFFFFu;
+            if (timing->backlog > timing->maximum_backlog)
+                timing->maximum_backlog = timing->backlog;
+            timing->deadline_misses++;
+        }
+    }
+
+    timing->wake_time        = now;
+    timing->write_begin_time = now;
+    timing->write_end_time   = now;
+    timing->awake            = true;
+}
+
+t_uint32
+loop_timing_backlog(const struct loop_timing * timing)
+{
+    return timing->backlog;
+}
+
+void
+loop_timing_skip(struct loop_timing * timing, t_uint32 samples)
+{
+    timing->samples_since_anchor += samples;
+    timing->skipped_samples      += samples;
+    timing->skipped              += samples;
+    timing->backlog               = (samples < timing->backlog) ? timing->backlog - samples : 0;
+}
+
+t_int
+loop_timing_drain_encoder(struct loop_timing * timing, t_task task, t_uint32 num_channels, t_int32 counts[])
+{
+    t_int32 buffer[LOOP_TIMING_DRAIN_SIZE];
+    t_int   skipped = 0;
+
+    if (num_channels == 0 || num_channels > LOOP_TIMING_DRAIN_SIZE)
+        return -QERR_INVALID_ARGUMENT;
+
+    while (timing->backlog > 0)
+    {
+        const t_uint32 capacity     = LOOP_TIMING_DRAIN_SIZE / num_channels;
+        const t_uint32 num_samples  = (timing->backlog < capacity) ? timing->backlog : capacity;
+        const t_int    samples_read = hil_task_read_encoder(task, num_samples, buffer);
+        if (samples_read <= 0)
+            return (samples_read < 0) ? samples_read : skipped;
+
+        /* The counts are grouped by sample, so the freshest sample is the last group */
+        memcpy(counts, &buffer[(samples_read - 1) * num_channels], num_channels * sizeof(t_int32));
+        loop_timing_skip(timing, samples_read);
+        skipped += samples_read;
+    }
+
+    return skipped;
+}
+
+void
+loop_timing_write_begin(struct loop_timing * timing)
+{
+    timeout_get_high_resolution_time(&timing->write_begin_time);
+}
+
+void
+loop_timing_write_end(struct loop_timing * timing)
+{
+    timeout_get_high_resolution_time(&timing->write_end_time);
+}
+
+void
+loop_timing_sleep(struct loop_timing * timing)
+{
+    struct loop_timing_record * record = &timing->ring[timing->iterations & RING_MASK];
+    t_uint64 compute, write;
+    t_timeout now;
+
+    timeout_get_high_resolution_time(&now);
+    timing->sleep_time = now;
+
+    write   = latency_histogram_interval(&timing->write_begin_time, &timing->write_end_time);
+    compute = latency_histogram_interval(&timing->wake_time, &timing->write_begin_time)
+            + latency_histogram_interval(&timing->write_end_time, &now);
+
+    if (compute + write > timing->period)
+        timing->overruns++;
+
+    latency_histogram_record(&timing->compute, compute);
+    latency_histogram_record(&timing->write, write);
+
+    record->interval = (t_uint32) timing->interval;
+    record->compute  = (t_uint32) compute;
+    record->write    = (t_uint32) write;
+    record->skipped  = timing->skipped;
+
+    timing->interval = 0;
+    timing->skipped  = 0;
+    timing->iterations++;
+}
+
+static void
+print_statistics(const char * name, const struct latency_histogram * histogram)
+{
+    printf("    %-24s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n", name,
+        (histogram->count > 0) ? histogram->minimum * 1e-3 : 0.0,
+        latency_histogram_mean(histogram) * 1e-3,
+        latency_histogram_percentile(histogram, 50) * 1e-3,
+        latency_histogram_percentile(histogram, 99) * 1e-3,
+        latency_histogram_percentile(histogram, 99.9) * 1e-3,
+        histogram->maximum * 1e-3);
+}
+
+void
+loop_timing_print(const struct loop_timing * timing)
+{
+    if (timing->iterations == 0)
+        return;
+
+    printf("\nLoop timing over %.0f iterations with a period of %.3f usecs:\n", (double) timing->iterations, timing->period * 1e-3);
+    if (timing->deviation.count > 0)
+        printf("    Time between wake-ups ranged from %.3f to %.3f usecs.\n", timing->minimum_interval * 1e-3, timing->maximum_interval * 1e-3);
+
+    printf("    %-24s %9s %9s %9s %9s %9s %9s\n", "(usecs)", "Min", "Mean", "p50", "p99", "p99.9", "Max");
+    print_statistics("Wake-up deviation", &timing->deviation);
+    print_statistics("Compute time", &timing->compute);
+    print_statistics("Write time", &timing->write);
+
+    printf("    Overruns (compute and write took longer than a period): %.0f\n", (double) timing->overruns);
+    printf("    Late wake-ups (more than 1.5 periods apart): %.0f\n", (double) timing->late_wakeups);
+    printf("    Early wake-ups (less than 0.5 periods apart, catching up on buffered samples): %.0f\n", (double) timing->early_wakeups);
+    printf("    Deadline misses (newer samples already waiting): %.0f, most samples waiting: %u, samples skipped: %.0f\n",
+        (double) timing->deadline_misses, timing->maximum_backlog, (double) timing->skipped_samples);
+}
+
+t_int
+loop_timing_write_csv(const struct loop_timing * timing, FILE * file)
+{
+    t_uint64 iteration = (timing->iterations > LOOP_TIMING_RING_SIZE) ? timing->iterations - LOOP_TIMING_RING_SIZE : 0;
+
+    fprintf(file, "iteration,interval_ns,compute_ns,write_ns,skipped\n");
+    for (; iteration < timing->iterations; iteration++)
+    {
+        const struct loop_timing_record * record = &timing->ring[iteration & RING_MASK];
+        fprintf(file, "%.0f,%u,%u,%u,%u\n", (double) iteration, record->interval, record->compute, record->write, record->skipped);
+    }
+
+    return ferror(file) ? -1 : 0;
+}
@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////
+//
+// loop_timing.h - header file
+//
+// Measures the timing of every iteration of a control loop paced by a
+// HIL task, such as a loop that waits in hil_task_read_encoder. Each
+// iteration records when the loop woke up relative to the previous
+// wake-up, how long the control computation took and how long the
+// outputs took to write. From these it can be shown whether a 1 kHz
+// loop really runs every millisecond and, if it does not, whether the
+// cause is a late wake-up, a slow computation or a slow write.
+//
+// The loop calls loop_timing_wake when the read returns,
+// loop_timing_write_begin and loop_timing_write_end around the write,
+// and loop_timing_sleep just before the next read. These only take a
+// timestamp and update fixed-size arrays, so the loop never allocates
+// memory or performs I/O for the sake of the measurements. The last
+// LOOP_TIMING_RING_SIZE iterations are kept in a ring, and statistics
+// over the whole run are kept in latency histograms. Both are reported
+// once the loop has stopped.
+//
+// A loop paced by a task that falls behind, because it was stalled or
+// overran, does not lose samples: they wait in the task buffer and each
+// read returns the oldest of them immediately. The loop then controls
+// on data that is increasingly stale while it works through the buffer
+// at full speed. loop_timing_backlog estimates how many newer samples
+// are already waiting, so the loop may skip to the freshest one. The
+// HIL API offers no way to ask how many samples are buffered, so the
+// estimate comes from the wake-up times. Each time a read actually
+// blocks, the loop is up to date and the sample schedule is anchored
+// at that wake-up. The backlog is then the time elapsed beyond the
+// schedule, in whole periods. Anchoring at every blocking read also
+// keeps any drift between the hardware clock and the processor clock
+// from accumulating. A loop paced by hil_task_read_encoder may call
+// loop_timing_drain_encoder to read and discard that backlog.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _loop_timing_h
+#define _loop_timing_h
+
+#include <stdio.h>
+
+#include "hil.h"
+#include "quanser_types.h"
+#include "quanser_time.h"
+
+#include "latency_histogram.h"
+
+#define LOOP_TIMING_RING_SIZE   (8192)  /* iterations kept in the ring, a power of two */
+#define LOOP_TIMING_DRAIN_SIZE  (32)    /* counts read at a time when draining the backlog of an encoder reader task */
+
+/*
+    The timing of one iteration in ns.
+*/
+struct loop_timing_record
+{
+    t_uint32 interval;      /* time since the previous wake-up, or zero for the first iteration */
+    t_uint32 compute;       /* time spent computing, excluding the write */
+    t_uint32 write;         /* time spent writing the outputs */
+    t_uint32 skipped;       /* samples skipped to catch up */
+};
+
+struct loop_timing
+{
+    t_uint64 period;                        /* expected time between wake-ups in ns */
+    t_uint64 iterations;                    /* number of iterations recorded */
+    t_uint64 overruns;                      /* iterations that took longer than a period to compute and write */
+    t_uint64 late_wakeups;                  /* wake-ups more than half a period later than expected */
+    t_uint64 early_wakeups;                 /* wake-ups more than half a period earlier than expected, as when catching up */
+    t_uint64 minimum_interval;              /* shortest time between wake-ups in ns */
+    t_uint64 maximum_interval;              /* longest time between wake-ups in ns */
+    t_uint64 deadline_misses;               /* wake-ups at which newer samples were already waiting */
+    t_uint64 skipped_samples;               /* samples skipped to catch up */
+    t_uint32 maximum_backlog;               /* most samples found waiting at one wake-up */
+
+    struct latency_histogram deviation;     /* difference between the time between wake-ups and the period */
+    struct latency_histogram compute;       /* time spent computing */
+    struct latency_histogram write;         /* time spent writing the outputs */
+
+    struct loop_timing_record ring[LOOP_TIMING_RING_SIZE];  /* the last iterations, oldest overwritten first */
+
+    /* Timestamps of the current iteration */
+    t_timeout wake_time;
+    t_timeout write_begin_time;
+    t_timeout write_end_time;
+    t_timeout sleep_time;
+    t_uint64  interval;                     /* time since the previous wake-up in ns */
+    t_boolean awake;                        /* whether the loop has woken up at least once */
+
+    /* Backlog estimation */
+    t_timeout anchor_time;                  /* wake-up time of the last read that blocked */
+    t_uint64  samples_since_anchor;         /* samples read or skipped since then */
+    t_uint32  backlog;                      /* newer samples estimated to be waiting */
+    t_uint32  skipped;                      /* samples skipped in the current iteration */
+};
+
+/*
+    Prepare to time a loop that runs once every period seconds. The structure is large, so it
+    should be static rather than on the stack.
+*/
+extern void
+loop_timing_init(struct loop_timing * timing, t_double period);
+
+/*
+    Record that the loop has woken up, as soon as the read that paces it returns.
+*/
+extern void
+loop_timing_wake(struct loop_timing * timing);
+
+/*
+    Returns the number of samples estimated to be waiting in the task buffer beyond the one just
+    read, or zero if the loop is up to date. Call after loop_timing_wake.
+*/
+extern t_uint32
+loop_timing_backlog(const struct loop_timing * timing);
+
+/*
+    Record that the loop read and discarded the given number of samples to catch up.
+*/
+extern void
+loop_timing_skip(struct loop_timing * timing, t_uint32 samples);
+
+/*
+    Read and discard the samples estimated by loop_timing_backlog to be waiting in the buffer of an
+    encoder reader task behind the one just read, recording them with loop_timing_skip. The
+    freshest sample of each of the num_channels channels of the task is left in counts. The task
+    may read at most LOOP_TIMING_DRAIN_SIZE channels. Returns the number of samples skipped or a
+    negative error code.
+*/
+extern t_int
+loop_timing_drain_encoder(struct loop_timing * timing, t_task task, t_uint32 num_channels, t_int32 counts[]);
+
+/*
+    Record that the computation is done and the outputs are about to be written.
+*/
+extern void
+loop_timing_write_begin(struct loop_timing * timing);
+
+/*
+    Record that the outputs have been written.
+*/
+extern void
+loop_timing_write_end(struct loop_timing * timing);
+
+/*
+    Record that the iteration is done and the loop is about to wait for the next read. Any
+    computation after the write counts towards the compute time.
+*/
+extern void
+loop_timing_sleep(struct loop_timing * timing);
+
+/*
+    Print statistics of the wake-up times, compute times and write times, the overrun counts and
+    the samples skipped to the console.
+*/
+extern void
+loop_timing_print(const struct loop_timing * timing);
+
+/*
+    Write the iterations held in the ring to the file as comma-separated values, oldest first.
+    Returns 0 on success and -1 on failure.
+*/
+extern t_int
+loop_timing_write_csv(const struct loop_timing * timing, FILE * file);
+
+#endif
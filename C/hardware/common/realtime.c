@@ -0,0 +1,465 @@
+//////////////////////////////////////////////////////////////////
+//
+// realtime.c - C file
+//
+// Implements the real-time setup described in realtime.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     /* for sched_setaffinity and sched_getaffinity */
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "quanser_messages.h"
+#include "quanser_thread.h"
+
+#include "realtime.h"
+
+#if defined(_MSC_VER)
+#define REALTIME_NOINLINE   __declspec(noinline)
+#else
+#define REALTIME_NOINLINE   __attribute__((noinline))
+#endif
+
+#define TOUCH_STRIDE    4096        /* bytes between the bytes touched when prefaulting, no larger than a page */
+#define STACK_CHUNK     (16 * 1024) /* bytes of stack touched by each call of touch_stack */
+
+static const char * const step_names[NUMBER_OF_REALTIME_STEPS] =
+{
+    "Pin to CPU",
+    "Lock memory",
+    "Prefault heap",
+    "Prefault stack",
+    "Raise priority"
+};
+
+static const char * const outcome_names[] =
+{
+    "skipped",
+    "succeeded",
+    "FAILED",
+    "unsupported"
+};
+
+static void
+set_outcome(struct realtime_report * report, enum realtime_step step, enum realtime_outcome outcome, const char * details)
+{
+    report->outcomes[step] = outcome;
+    snprintf(report->details[step], sizeof(report->details[step]), "%s", details);
+}
+
+#if !defined(_WIN32)
+
+static void
+set_error(struct realtime_report * report, enum realtime_step step, const char * action, int error)
+{
+    report->outcomes[step] = REALTIME_OUTCOME_FAILED;
+    snprintf(report->details[step], sizeof(report->details[step]), "%.60s: %.60s", action, strerror(error));
+}
+
+#endif
+
+#if defined(__linux__)
+
+static cpu_set_t original_affinity;     /* CPUs of the first thread pinned, before it was pinned */
+static int       has_original_affinity; /* whether original_affinity has been recorded */
+
+/*
+    Describe a set of CPUs as a list of ranges, such as "CPUs 0-2,4".
+*/
+static void
+describe_cpus(const cpu_set_t * set, char * details, size_t size)
+{
+    size_t length = (size_t) snprintf(details, size, (CPU_COUNT(set) == 1) ? "CPU " : "CPUs ");
+    int cpu = 0;
+
+    while (cpu < CPU_SETSIZE && length < size)
+    {
+        if (CPU_ISSET(cpu, set))
+        {
+            int last = cpu;
+            while (last + 1 < CPU_SETSIZE && CPU_ISSET(last + 1, set))
+                last++;
+
+            if (last > cpu)
+                length += (size_t) snprintf(details + length, size - length, "%s%d-%d", (details[length - 1] == ' ') ? "" : ",", cpu, last);
+            else
+                length += (size_t) snprintf(details + length, size - length, "%s%d", (details[length - 1] == ' ') ? "" : ",", cpu);
+            cpu = last;
+        }
+        cpu++;
+    }
+}
+
+/*
+    Returns the first CPU listed in /sys/devices/system/cpu/isolated, which holds the CPUs given
+    to the isolcpus kernel parameter, or -1 if no CPU is isolated.
+*/
+static int
+find_isolated_cpu(void)
+{
+    FILE * file = fopen("/sys/devices/system/cpu/isolated", "r");
+    int cpu = -1;
+
+    if (file != NULL)
+    {
+        if (fscanf(file, "%d", &cpu) != 1)
+            cpu = -1;
+        fclose(file);
+    }
+
+    return cpu;
+}
+
+#endif
+
+/*
+    Let the thread run on any CPU the process could use before a thread was pinned, except the
+    excluded CPU.
+*/
+static void
+exclude_cpu(t_int excluded_cpu, struct realtime_report * report)
+{
+    char details[128];
+
+#if defined(__linux__)
+    cpu_set_t set;
+
+    if (has_original_affinity)
+        set = original_affinity;
+    else if (sched_getaffinity(0, sizeof(set), &set) != 0)
+    {
+        set_error(report, REALTIME_STEP_PIN_CPU, "sched_getaffinity", errno);
+        return;
+    }
+
+    if (excluded_cpu >= 0 && excluded_cpu < CPU_SETSIZE)
+        CPU_CLR(excluded_cpu, &set);
+
+    if (CPU_COUNT(&set) == 0)
+    {
+        snprintf(details, sizeof(details), "no CPU other than CPU %d is available, so the CPU is shared", excluded_cpu);
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SKIPPED, details);
+        return;
+    }
+
+    describe_cpus(&set, details, sizeof(details));
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        set_error(report, REALTIME_STEP_PIN_CPU, details, errno);
+        return;
+    }
+#elif defined(_WIN32)
+    DWORD_PTR process_mask, system_mask;
+
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+    {
+        snprintf(details, sizeof(details), "Windows error %lu", (unsigned long) GetLastError());
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_FAILED, details);
+        return;
+    }
+
+    if (excluded_cpu >= 0 && excluded_cpu < (t_int) (8 * sizeof(DWORD_PTR)))
+        process_mask &= ~((DWORD_PTR) 1 << excluded_cpu);
+
+    if (process_mask == 0)
+    {
+        snprintf(details, sizeof(details), "no CPU other than CPU %d is available, so the CPU is shared", excluded_cpu);
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SKIPPED, details);
+        return;
+    }
+
+    snprintf(details, sizeof(details), "CPU mask 0x%llx", (unsigned long long) process_mask);
+    if (SetThreadAffinityMask(GetCurrentThread(), process_mask) == 0)
+    {
+        snprintf(details, sizeof(details), "CPU mask 0x%llx: Windows error %lu", (unsigned long long) process_mask, (unsigned long) GetLastError());
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_FAILED, details);
+        return;
+    }
+#else
+    set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_UNSUPPORTED, "threads cannot be pinned on this operating system");
+    return;
+#endif
+
+    set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SUCCEEDED, details);
+}
+
+static void
+pin_cpu(const struct realtime_options * options, struct realtime_report * report)
+{
+    t_int cpu = options->cpu;
+    char details[128];
+
+    report->cpu = -1;
+    if (cpu == REALTIME_CPU_NONE)
+    {
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SKIPPED, "not requested");
+        return;
+    }
+
+    if (cpu == REALTIME_CPU_OTHERS)
+    {
+        exclude_cpu(options->excluded_cpu, report);
+        return;
+    }
+
+#if defined(__linux__)
+    {
+        cpu_set_t set;
+
+        if (cpu == REALTIME_CPU_ISOLATED)
+        {
+            cpu = find_isolated_cpu();
+            if (cpu < 0)
+            {
+                set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SKIPPED,
+                    "no CPU is isolated; add isolcpus= to the kernel command line to reserve one");
+                return;
+            }
+        }
+
+        if (cpu >= CPU_SETSIZE)
+        {
+            set_error(report, REALTIME_STEP_PIN_CPU, "invalid CPU", EINVAL);
+            return;
+        }
+
+        /* Remember where the process could run, so that helper threads can be kept off this CPU */
+        if (!has_original_affinity && sched_getaffinity(0, sizeof(original_affinity), &original_affinity) == 0)
+            has_original_affinity = 1;
+
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        {
+            snprintf(details, sizeof(details), "CPU %d", cpu);
+            set_error(report, REALTIME_STEP_PIN_CPU, details, errno);
+            return;
+        }
+    }
+#elif defined(_WIN32)
+    if (cpu == REALTIME_CPU_ISOLATED)
+    {
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SKIPPED, "Windows does not isolate CPUs from the scheduler");
+        return;
+    }
+
+    if (cpu >= (t_int) (8 * sizeof(DWORD_PTR)) || SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR) 1 << cpu) == 0)
+    {
+        snprintf(details, sizeof(details), "CPU %d: Windows error %lu", cpu, (unsigned long) GetLastError());
+        set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_FAILED, details);
+        return;
+    }
+#else
+    set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_UNSUPPORTED, "threads cannot be pinned on this operating system");
+    return;
+#endif
+
+    report->cpu = cpu;
+    snprintf(details, sizeof(details), "CPU %d", cpu);
+    set_outcome(report, REALTIME_STEP_PIN_CPU, REALTIME_OUTCOME_SUCCEEDED, details);
+}
+
+static void
+lock_memory(const struct realtime_options * options, struct realtime_report * report)
+{
+    if (!options->lock_memory)
+    {
+        set_outcome(report, REALTIME_STEP_LOCK_MEMORY, REALTIME_OUTCOME_SKIPPED, "not requested");
+        return;
+    }
+
+#if defined(_WIN32)
+    {
+        /* Windows cannot lock every page, but raising the minimum working set keeps the pages of the process resident */
+        const SIZE_T increase = options->heap_size + options->stack_size + 4 * 1024 * 1024;
+        SIZE_T minimum, maximum;
+        char details[128];
+
+        if (!GetProcessWorkingSetSize(GetCurrentProcess(), &minimum, &maximum)
+            || !SetProcessWorkingSetSize(GetCurrentProcess(), minimum + increase, (maximum > minimum + increase) ? maximum : minimum + increase))
+        {
+            snprintf(details, sizeof(details), "Windows error %lu", (unsigned long) GetLastError());
+            set_outcome(report, REALTIME_STEP_LOCK_MEMORY, REALTIME_OUTCOME_FAILED, details);
+            return;
+        }
+
+        snprintf(details, sizeof(details), "minimum working set raised to %lu KB", (unsigned long) ((minimum + increase) / 1024));
+        set_outcome(report, REALTIME_STEP_LOCK_MEMORY, REALTIME_OUTCOME_SUCCEEDED, details);
+    }
+#elif defined(__APPLE__)
+    set_outcome(report, REALTIME_STEP_LOCK_MEMORY, REALTIME_OUTCOME_UNSUPPORTED, "mlockall is not implemented on macOS");
+#else
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        /* Locking memory requires root, CAP_IPC_LOCK or a large enough RLIMIT_MEMLOCK */
+        set_error(report, REALTIME_STEP_LOCK_MEMORY, "mlockall (needs CAP_IPC_LOCK or a larger memlock limit)", errno);
+        return;
+    }
+
+    set_outcome(report, REALTIME_STEP_LOCK_MEMORY, REALTIME_OUTCOME_SUCCEEDED, "current and future pages");
+#endif
+}
+
+static void
+prefault_heap(size_t size, struct realtime_report * report)
+{
+    volatile unsigned char * block;
+    char details[128];
+    size_t offset;
+
+    if (size == 0)
+    {
+        set_outcome(report, REALTIME_STEP_PREFAULT_HEAP, REALTIME_OUTCOME_SKIPPED, "not requested");
+        return;
+    }
+
+#if defined(__GLIBC__)
+    /*
+        Never return freed memory to the system and never satisfy an allocation with a separate
+        mapping. These settings apply to the whole process, so calling realtime_setup again from
+        another thread with a heap to prefault makes them again, which changes nothing.
+    */
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+#endif
+
+    block = (volatile unsigned char *) malloc(size);
+    if (block == NULL)
+    {
+        snprintf(details, sizeof(details), "unable to allocate %lu KB", (unsigned long) (size / 1024));
+        set_outcome(report, REALTIME_STEP_PREFAULT_HEAP, REALTIME_OUTCOME_FAILED, details);
+        return;
+    }
+
+    for (offset = 0; offset < size; offset += TOUCH_STRIDE)
+        block[offset] = 0;
+
+    free((void *) block);
+
+#if defined(__GLIBC__)
+    snprintf(details, sizeof(details), "%lu KB kept by the heap", (unsigned long) (size / 1024));
+    set_outcome(report, REALTIME_STEP_PREFAULT_HEAP, REALTIME_OUTCOME_SUCCEEDED, details);
+#else
+    /* Other heaps may give a large block back to the system when it is freed */
+    snprintf(details, sizeof(details), "%lu KB touched, but this heap may return it to the system", (unsigned long) (size / 1024));
+    set_outcome(report, REALTIME_STEP_PREFAULT_HEAP, REALTIME_OUTCOME_UNSUPPORTED, details);
+#endif
+}
+
+/*
+    Touch size bytes below the caller's stack frame, rounded up to a whole number of chunks. Each
+    call touches one chunk and calls itself for the rest, so the size may be chosen at run time.
+    The chunk is written again after the nested call so that the call cannot reuse its frame. The
+    function must not be inlined, or the chunk could share the caller's frame.
+*/
+static REALTIME_NOINLINE void
+touch_stack(size_t size)
+{
+    volatile unsigned char chunk[STACK_CHUNK];
+    size_t offset;
+
+    for (offset = 0; offset < sizeof(chunk); offset += TOUCH_STRIDE)
+        chunk[offset] = 0;
+
+    if (size > sizeof(chunk))
+        touch_stack(size - sizeof(chunk));
+
+    chunk[0] = 0;
+}
+
+static void
+prefault_stack(size_t size, struct realtime_report * report)
+{
+    char details[128];
+
+    if (size == 0)
+    {
+        set_outcome(report, REALTIME_STEP_PREFAULT_STACK, REALTIME_OUTCOME_SKIPPED, "not requested");
+        return;
+    }
+
+    touch_stack(size);
+
+    snprintf(details, sizeof(details), "%lu KB", (unsigned long) ((size + STACK_CHUNK - 1) / STACK_CHUNK * STACK_CHUNK / 1024));
+    set_outcome(report, REALTIME_STEP_PREFAULT_STACK, REALTIME_OUTCOME_SUCCEEDED, details);
+}
+
+static void
+raise_priority(struct realtime_report * report)
+{
+    qsched_param_t scheduling_parameters;
+    char message[128];
+    t_error result;
+
+    scheduling_parameters.sched_priority = qsched_get_priority_max(QSCHED_FIFO);
+    result = qthread_setschedparam(qthread_self(), QSCHED_FIFO, &scheduling_parameters);
+    if (result < 0)
+    {
+        msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+        set_outcome(report, REALTIME_STEP_PRIORITY, REALTIME_OUTCOME_FAILED, message);
+        return;
+    }
+
+    snprintf(message, sizeof(message), "FIFO priority %d", scheduling_parameters.sched_priority);
+    set_outcome(report, REALTIME_STEP_PRIORITY, REALTIME_OUTCOME_SUCCEEDED, message);
+}
+
+void
+realtime_default_options(struct realtime_options * options)
+{
+    options->cpu          = REALTIME_CPU_ISOLATED;
+    options->excluded_cpu = -1;
+    options->lock_memory  = true;
+    options->heap_size    = REALTIME_DEFAULT_HEAP_SIZE;
+    options->stack_size   = REALTIME_DEFAULT_STACK_SIZE;
+}
+
+t_int
+realtime_setup(const struct realtime_options * options, struct realtime_report * report)
+{
+    t_int step;
+
+    /* Pin first so that the pages touched below are allocated close to the CPU that runs the loop */
+    pin_cpu(options, report);
+    lock_memory(options, report);
+    prefault_heap(options->heap_size, report);
+    prefault_stack(options->stack_size, report);
+    raise_priority(report);
+
+    for (step = 0; step < NUMBER_OF_REALTIME_STEPS; step++)
+    {
+        if (report->outcomes[step] == REALTIME_OUTCOME_FAILED || report->outcomes[step] == REALTIME_OUTCOME_UNSUPPORTED)
+            return -1;
+    }
+
+    return 0;
+}
+
+void
+realtime_print_report(const struct realtime_report * report)
+{
+    t_int step;
+
+    printf("Real-time setup:\n");
+    for (step = 0; step < NUMBER_OF_REALTIME_STEPS; step++)
+        printf("    %-15s %-12s %s\n", step_names[step], outcome_names[report->outcomes[step]], report->details[step]);
+    printf("\n");
+}
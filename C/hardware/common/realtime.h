@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////
+//
+// realtime.h - header file
+//
+// Prepares the calling thread to run a control loop. Raising the
+// priority of the thread, as the examples always did, keeps other
+// threads from delaying it, but the loop can still stall when it
+// touches memory that is not resident or when the scheduler moves it
+// to another CPU. Each such page fault or migration costs from tens of
+// microseconds to milliseconds, which appears as spikes in the loop
+// timing.
+//
+// realtime_setup therefore also pins the thread to one CPU, preferably
+// one isolated from the scheduler with the isolcpus kernel parameter,
+// locks the pages of the process into memory, and touches a region of
+// the stack and heap in advance so that the loop never faults them in.
+// Each step is attempted independently and its outcome is recorded,
+// because several need privileges the example may not have. The
+// outcome of every step is printed, so a failed step is reported
+// rather than silently leaving the loop exposed.
+//
+// A thread that helps the control loop, such as one computing its
+// outputs, must not share the CPU of the loop. A new thread inherits the
+// CPU affinity of the thread that creates it, so once the loop thread is
+// pinned, a helper it creates would run on the same CPU. The helper asks
+// for REALTIME_CPU_OTHERS instead, which lets it run on any CPU the
+// process could use before the loop thread was pinned, except the CPU
+// of the loop thread.
+//
+// A helper thread is usually created with the default stack size,
+// which on some targets, such as QNX, is far smaller than the stack of
+// the main thread and smaller than REALTIME_DEFAULT_STACK_SIZE. A
+// helper therefore asks for no more stack to be prefaulted than it was
+// given. The heap settings made to prefault the heap apply to the whole
+// process, so a helper that leaves the heap alone does not repeat them.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _realtime_h
+#define _realtime_h
+
+#include <stddef.h>
+
+#include "quanser_types.h"
+
+#define REALTIME_CPU_ISOLATED       (-1)            /* pin to the first CPU isolated from the scheduler, if there is one */
+#define REALTIME_CPU_NONE           (-2)            /* do not pin the thread */
+#define REALTIME_CPU_OTHERS         (-3)            /* run on any CPU the process may use except the excluded CPU */
+#define REALTIME_DEFAULT_STACK_SIZE (256 * 1024)    /* bytes of stack prefaulted by default */
+#define REALTIME_DEFAULT_HEAP_SIZE  (1024 * 1024)   /* bytes of heap prefaulted by default */
+
+/*
+    The steps taken by realtime_setup, in the order in which they are taken.
+*/
+enum realtime_step
+{
+    REALTIME_STEP_PIN_CPU,          /* pin the thread to one CPU */
+    REALTIME_STEP_LOCK_MEMORY,      /* lock current and future pages into memory */
+    REALTIME_STEP_PREFAULT_HEAP,    /* touch the heap and keep it allocated to the process */
+    REALTIME_STEP_PREFAULT_STACK,   /* touch the requested number of bytes of the stack */
+    REALTIME_STEP_PRIORITY,         /* run the thread at the highest FIFO priority */
+
+    NUMBER_OF_REALTIME_STEPS
+};
+
+enum realtime_outcome
+{
+    REALTIME_OUTCOME_SKIPPED,       /* the step was not requested or was not needed */
+    REALTIME_OUTCOME_SUCCEEDED,
+    REALTIME_OUTCOME_FAILED,
+    REALTIME_OUTCOME_UNSUPPORTED    /* the operating system does not support the step */
+};
+
+/*
+    Describes the real-time environment requested for the calling thread.
+*/
+struct realtime_options
+{
+    t_int     cpu;                  /* CPU to which to pin the thread, or REALTIME_CPU_ISOLATED, REALTIME_CPU_NONE or REALTIME_CPU_OTHERS */
+    t_int     excluded_cpu;         /* CPU kept free by REALTIME_CPU_OTHERS, such as that of the control loop, or -1 for none */
+    t_boolean lock_memory;          /* lock the pages of the process into memory */
+    size_t    heap_size;            /* bytes of heap to prefault, or 0 to leave the heap alone */
+    size_t    stack_size;           /* bytes of stack to prefault, less than the stack of the thread, or 0 to leave the stack alone */
+};
+
+/*
+    The outcome of each step of realtime_setup.
+*/
+struct realtime_report
+{
+    enum realtime_outcome outcomes[NUMBER_OF_REALTIME_STEPS];
+    t_int cpu;                                      /* CPU to which the thread was pinned, or -1 if it was not pinned to one CPU */
+    char details[NUMBER_OF_REALTIME_STEPS][128];    /* what was done, or why the step failed or was skipped */
+};
+
+/*
+    Fill in the options used by the control examples: pin to an isolated CPU if there is one,
+    lock memory and prefault REALTIME_DEFAULT_HEAP_SIZE bytes of heap and
+    REALTIME_DEFAULT_STACK_SIZE bytes of stack. No CPU is excluded.
+*/
+extern void
+realtime_default_options(struct realtime_options * options);
+
+/*
+    Prepare the calling thread to run a control loop, recording the outcome of each step in the
+    report. Call it from the thread that runs the loop, before the loop starts. Returns 0 if every
+    requested step succeeded and -1 if any step failed or is unsupported, in which case the loop may
+    still be run but with less predictable timing.
+*/
+extern t_int
+realtime_setup(const struct realtime_options * options, struct realtime_report * report);
+
+/*
+    Print the outcome of each step to the console.
+*/
+extern void
+realtime_print_report(const struct realtime_report * report);
+
+#endif
@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////
+//
+// seqlock_mailbox.c - C file
+//
+// Implements the lock-free mailbox described in seqlock_mailbox.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "seqlock_mailbox.h"
+
+/*
+    The writer stores the odd count, then the message, then the even count, and the reader loads
+    the count, then the message, then the count again. The fences keep the message between the
+    two counts on both sides, so a reader that sees the same even count twice copied a message
+    that was not changed while it was being copied.
+*/
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+/* Volatile accesses have acquire and release semantics with /volatile:ms, the default on x86 and x64 */
+#define LOAD_ACQUIRE(variable)          (*(volatile const t_uint32 *) &(variable))
+#define LOAD_RELAXED(variable)          (*(volatile const t_uint32 *) &(variable))
+#define STORE_RELEASE(variable, value)  (*(volatile t_uint32 *) &(variable) = (value))
+#define STORE_RELAXED(variable, value)  (*(volatile t_uint32 *) &(variable) = (value))
+#define FENCE_ACQUIRE()                 _ReadWriteBarrier()
+#define FENCE_RELEASE()                 _ReadWriteBarrier()
+#else
+#define LOAD_ACQUIRE(variable)          __atomic_load_n(&(variable), __ATOMIC_ACQUIRE)
+#define LOAD_RELAXED(variable)          __atomic_load_n(&(variable), __ATOMIC_RELAXED)
+#define STORE_RELEASE(variable, value)  __atomic_store_n(&(variable), (value), __ATOMIC_RELEASE)
+#define STORE_RELAXED(variable, value)  __atomic_store_n(&(variable), (value), __ATOMIC_RELAXED)
+#define FENCE_ACQUIRE()                 __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define FENCE_RELEASE()                 __atomic_thread_fence(__ATOMIC_RELEASE)
+#endif
+
+void
+seqlock_mailbox_init(struct seqlock_mailbox * mailbox)
+{
+    memset(mailbox, 0, sizeof(*mailbox));
+}
+
+void
+seqlock_mailbox_write(struct seqlock_mailbox * mailbox, const void * message, size_t size)
+{
+    const t_uint32 sequence = mailbox->sequence; /* only the writer changes the count */
+
+    STORE_RELAXED(mailbox->sequence, sequence + 1);
+    FENCE_RELEASE(); /* the odd count is seen before any part of the new message */
+
+    memcpy(mailbox->data, message, size);
+
+    STORE_RELEASE(mailbox->sequence, sequence + 2);
+}
+
+t_uint32
+seqlock_mailbox_count(const struct seqlock_mailbox * mailbox)
+{
+    return LOAD_ACQUIRE(mailbox->sequence) / 2;
+}
+
+t_int
+seqlock_mailbox_read(const struct seqlock_mailbox * mailbox, void * message, size_t size)
+{
+    int attempt;
+
+    for (attempt = 0; attempt < SEQLOCK_MAILBOX_RETRIES; attempt++)
+    {
+        const t_uint32 sequence = LOAD_ACQUIRE(mailbox->sequence);
+        if (sequence == 0)
+            return -1; /* nothing written yet */
+
+        if ((sequence & 1) == 0)
+        {
+            memcpy(message, mailbox->data, size);
+
+            FENCE_ACQUIRE(); /* the copy is complete before the count is checked again */
+            if (LOAD_RELAXED(mailbox->sequence) == sequence)
+                return 0;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////
+//
+// seqlock_mailbox.h - header file
+//
+// A lock-free mailbox holding the latest message passed from one
+// thread to another. The writer overwrites the message whenever it has
+// a new one and never waits for the reader, which always gets the most
+// recent message rather than a queue of old ones. This suits a control
+// loop, where only the freshest joint angles or output voltages matter.
+//
+// The mailbox is guarded by a sequence count, as in a Linux seqlock.
+// The writer makes the count odd before it changes the message and
+// even again afterwards. The reader copies the message and keeps the
+// copy only if the count was even and unchanged throughout, so it
+// never sees half of one message and half of another. Neither thread
+// takes a lock, so a thread preempted in the middle of a read or a
+// write can never hold up the other.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _seqlock_mailbox_h
+#define _seqlock_mailbox_h
+
+#include <stddef.h>
+
+#include "quanser_types.h"
+
+#define SEQLOCK_MAILBOX_CACHE_LINE_SIZE (64)
+#define SEQLOCK_MAILBOX_SIZE            (192)   /* largest message in bytes */
+#define SEQLOCK_MAILBOX_RETRIES         (4)     /* attempts made by seqlock_mailbox_read before giving up */
+
+struct seqlock_mailbox
+{
+    /* Kept on cache lines of its own so the mailbox does not share a line with its neighbours */
+    t_ubyte  padding[SEQLOCK_MAILBOX_CACHE_LINE_SIZE];
+    t_uint32 sequence;                          /* twice the number of messages written, plus one while a message is being written */
+    t_ubyte  data[SEQLOCK_MAILBOX_SIZE];        /* the latest message */
+    t_ubyte  tail_padding[SEQLOCK_MAILBOX_CACHE_LINE_SIZE];
+};
+
+/*
+    Prepare an empty mailbox.
+*/
+extern void
+seqlock_mailbox_init(struct seqlock_mailbox * mailbox);
+
+/*
+    Writer: replace the message in the mailbox with the given message of size bytes, which must
+    be no more than SEQLOCK_MAILBOX_SIZE. Only one thread may write to a mailbox.
+*/
+extern void
+seqlock_mailbox_write(struct seqlock_mailbox * mailbox, const void * message, size_t size);
+
+/*
+    Reader: the number of messages written to the mailbox so far. A reader polls this to find out
+    cheaply whether a new message has arrived.
+*/
+extern t_uint32
+seqlock_mailbox_count(const struct seqlock_mailbox * mailbox);
+
+/*
+    Reader: copy the latest message of size bytes from the mailbox. Returns 0 on success and -1 if
+    no message has been written yet or the writer was writing throughout SEQLOCK_MAILBOX_RETRIES
+    attempts, in which case the reader should try again later rather than wait.
+*/
+extern t_int
+seqlock_mailbox_read(const struct seqlock_mailbox * mailbox, void * message, size_t size);
+
+#endif
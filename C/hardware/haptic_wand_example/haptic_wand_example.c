@@ -9,6 +9,29 @@
 //
 /* This example runs until Esc is pressed. Do not press Ctrl+C. */
 //
+/* Normally one thread reads the encoders, computes the forces and writes the */
+/* output voltages, so the time spent computing adds to the time between */
+/* reading the encoders and writing the outputs. In pipelined mode the thread */
+/* that owns the board only reads and writes it, and a compute thread, free to */
+/* run on another core, computes the voltages. The threads pass the latest */
+/* joint angles and output voltages through lock-free seqlock mailboxes. The */
+/* voltages computed from one sample are written at the next sampling */
+/* instant, so the outputs lag by a sample, but the loop keeps its rate for */
+/* force models that take up to a whole period to compute. The time taken by */
+/* each stage is reported when the controller stops. */
+//
+/* The end-effector is rendered against a virtual scene of a floor, a sphere, */
+/* a box and a triangle mesh, in addition to the optional springs. */
+/* The velocity of the end-effector, used to damp its motion into the */
+/* objects, comes from joint velocities estimated from the encoder counts by */
+/* a filtered difference or a sliding least-squares fit. */
+//
+/* Compile with HAPTIC_WAND_SINGLE_PRECISION defined to compute the */
+/* kinematics in single precision, for targets on which double precision */
+/* arithmetic is slow. Their errors are far below one encoder count. */
+/* Compile with HAPTIC_WAND_TRIG_TABLE defined instead to look up the sines */
+/* and cosines of the joint angles in tables indexed by encoder count. */
+//
 /* This example demonstrates the use of the following functions: */
 /*    hil_open */
 /*    hil_set_encoder_counts */
@@ -19,6 +42,8 @@
 /*    hil_task_stop */
 /*    hil_task_delete */
 /*    hil_close */
+/*    qthread_create */
+/*    qthread_join */
 //
 /* Copyright 2008 Quanser Inc. */
 //////////////////////////////////////////////////////////////////
@@ -26,722 +51,97 @@
 #include "haptic_wand_example.h"
 #include "haptic_wand.h"
 
-struct limiter_state
-{
-    double mean;
-    double time;
-    int    count;
-    int    state;
-};
-
 static int  stop = 0;      /* a flag used to stop the controller */
 static char message[512];  /* a buffer used for error messages */
 
 static const char      board_type[]                   = "q8";                           /* type of board controlling the haptic wand */
 static const char      board_identifier[]             = "0";                            /* the instance of the board controlling the haptic wand */
-static const double    l[7]                           = { L1, L2, L3, L4, L5, L6, L7 }; /* link lengths of the haptic wand links */
 static const t_uint32  analog_channels[NUM_JOINTS]    = { 0, 1, 2, 3,  4,  5 };         /* analog output channels driving the haptic wand motors */
 static const t_uint32  encoder_channels[NUM_JOINTS]   = { 0, 1, 2, 3,  4,  5 };         /* encoder input channels for the haptic wand joint encoders */
 static const t_uint32  digital_channels[NUM_JOINTS]   = { 0, 1, 2, 3, 16, 17 };         /* digital output channels driving the amplifier enable lines */
 static const t_double  frequency                      = 1000;                           /* sampling frequency of the controller */
+static const t_boolean pipelined                      = false;                          /* compute the forces on a thread of their own */
+static const t_uint64  maximum_output_age             = 10;                             /* samples after which the compute thread is deemed stalled */
+static const size_t    compute_stack_size             = 32 * 1024;                      /* bytes of the stack of the compute thread prefaulted */
+static const t_uint32  velocity_filter                = VELOCITY_FILTER_LEAST_SQUARES;  /* how the joint velocities are estimated */
+static const t_double  velocity_cutoff                = 50;                             /* cutoff frequency of the filtered difference in Hz */
+static const t_uint32  velocity_window                = 8;                              /* samples fitted by the least-squares estimate */
 
-static void 
-signal_handler(int signal)
-{
-    stop = 1;
-}
+static const double count_offsets[NUM_JOINTS] = { 0.12760527954869, 3.0139873740411, 0.12760527954869, 3.0139873740411, 0.0000, 0.0000 }; /* joint angles at the calibration position */
+static const double count_factors[NUM_JOINTS] = { 2*PI/20000, 2*PI/20000, -2*PI/20000, -2*PI/20000, 2*PI/20000, 2*PI/20000 };             /* radians per encoder count */
 
 /*
-    Convert the encoder counts to joint angles in radians.
+    The joint angles of one sample, passed from the I/O thread to the compute thread.
 */
-static void 
-encoder_counts_to_joint_angles(const t_int32 counts[NUM_JOINTS], double joint_angles[NUM_JOINTS])
+struct joint_angles_message
 {
-    static const double offsets[] = { 0.12760527954869, 3.0139873740411, 0.12760527954869, 3.0139873740411, 0.0000, 0.0000 };
-    static const double factors[] = { 2*PI/20000, 2*PI/20000, -2*PI/20000, -2*PI/20000, 2*PI/20000, 2*PI/20000 };
+    t_uint64  sample;                       /* index of the sample, starting at zero */
+    t_timeout read_time;                    /* time at which the read of the sample returned */
+    t_int32   counts[NUM_JOINTS];           /* encoder counts */
+    double    joint_angles[NUM_JOINTS];     /* joint angles in radians */
+};
 
-    int i;
-    for (i=NUM_JOINTS-1; i >= 0; --i) // convert counts to radians and rearrange channels appropriately
-        joint_angles[i] = counts[i] * factors[i] + offsets[i];
-}
+/*
+    The output voltages computed from one sample, passed from the compute thread to the I/O thread.
+*/
+struct output_voltages_message
+{
+    t_uint64  sample;                       /* index of the sample from which the voltages were computed */
+    t_timeout read_time;                    /* time at which the read of that sample returned */
+    double    output_voltages[NUM_JOINTS];  /* output voltages in volts */
+};
 
 /*
-    Compute the end-effector position and orientation, X, from the joint angles, theta.
+    The state shared by the I/O thread and the compute thread in pipelined mode.
 */
-static void 
-forward_kinematics(const double theta[NUM_JOINTS], double X[NUM_WORLD])
+struct compute_context
 {
-    X[0] = l[4] / 0.2e1 + cos(theta[2]) * l[0] / 0.2e1 + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1] / 0.2e1 + cos(theta[0]) * l[0] / 0.2e1 + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] / 0.2e1;
-    X[1] = cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[5]) * (-l[6] + l[3]) / 0.2e1 + cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[4]) * (l[6] - l[3]) / 0.2e1;
-    X[2] = sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 + cos(theta[5]) * (-l[6] + l[3]) / 0.2e1 + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 + cos(theta[4]) * (l[6] - l[3]) / 0.2e1;
-    X[3] = -atan((cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])));
-    X[4] = atan((cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])));
-}
+    struct seqlock_mailbox  joint_angles;           /* written by the I/O thread */
+    struct seqlock_mailbox  output_voltages;        /* written by the compute thread */
+    struct realtime_report  realtime_report;        /* outcome of preparing the compute thread */
+    double                  period;                 /* sampling period in seconds */
+    t_int                   io_cpu;                 /* CPU to which the I/O thread is pinned, or -1 */
+    volatile int            done;                   /* set by the I/O thread once it reads no more samples */
+};
 
 /*
-    Compute the motor torques, tau, from the end-effector generalized forces, F. Since this conversion
-    is configuration-dependent, the joint tangles, theta, are required.
+    The time taken by each stage of the controller. The compute thread records the compute
+    stage and the samples it skipped, and the I/O thread records the rest.
 */
+struct stage_timing
+{
+    t_uint64 samples;                       /* samples read */
+    t_uint64 skipped_samples;               /* samples the compute thread passed over because a newer one had arrived */
+    t_uint64 stale_outputs;                 /* sampling instants at which no new output voltages were ready */
+    t_uint64 zeroed_outputs;                /* sampling instants at which the motors were driven with zero voltage */
+
+    struct latency_histogram io;            /* time from the read returning until the outputs are written */
+    struct latency_histogram compute;       /* time to compute the output voltages from the joint angles */
+    struct latency_histogram velocity;      /* time to estimate the velocities, part of the compute time */
+    struct latency_histogram latency;       /* time from a sample being read until the voltages computed from it are written, pipelined mode only */
+};
+
+static struct stage_timing timing;          /* large, so kept off the stack */
+static t_int io_cpu = -1;                   /* CPU to which the controller thread is pinned, or -1 if it is not pinned */
+static struct haptic_scene scene;           /* virtual objects felt by the end-effector, used only by the thread computing the forces */
+static struct velocity_estimator velocity_estimator; /* joint velocity estimator, used only by the thread computing the forces */
+static struct haptic_wand_trig_table trig_table;    /* sines of the joint angles by encoder count, built only if HAPTIC_WAND_TRIG_TABLE is defined */
+
 static void 
-inverse_force_kinematics(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS])
+signal_handler(int signal)
 {
-    double J[NUM_WORLD][NUM_JOINTS]; /* Jacobian */
-
-    J[0][0] = -sin(theta[0]) * l[0] / 0.2e1 - sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin
-      (theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * 
-      (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 *
-      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * 
-      pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), 
-      -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4
-      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4]
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[0][1] = -sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
-      ], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[
-      0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 
-      0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1
-      ]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0
-      ]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0
-      ] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[0][2] = -sin(theta[2]) * l[0] / 0.2e1
-      - sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(
-      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3
-      ]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[
-      0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l
-      [0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) *
-      l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
-      [0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[0][3] = -sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin
-      (theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * 
-      (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * 
-      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * 
-      pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), 
-      -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[
-      4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4
-      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[0][4] = 0.0e0;
-
-    J[0][5] = 0.0e0;
-  
-    J[1][0] = cos(theta[4]) * (cos(theta[0]) * 
-      l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 
-      0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - 
-      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]
-      ) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0
-      ]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta
-      [1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[
-      1]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
-
-    J[1][1] = cos(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin
-      (theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 
-      0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * 
-      cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) 
-      * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) *
-      l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[1][2] = cos(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
-      [0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0])
-      * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(
-      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4]
-      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1)
-      * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1
-      ))) * l[1]) / 0.2e1;
-
-    J[1][3] = cos(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] 
-      - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) 
-      * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1
-      * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0
-      ]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1
-      ), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * 
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * 
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / 0.2e1;
-
-    J[1][4] = -sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[
-      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[
-      0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 - cos(theta[4]) * (l[6] - l[3]) / 0.2e1;
-
-    J[1][5] = -sin(
-      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3
-      ]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1
-      - cos(theta[5]) * (-l[6] + l[3]) / 0.2e1;
-
-    J[2][0] = sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) 
-      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] +
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]
-      ) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[
-      0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - 
-      sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + 
-      (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta
-      [0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
-
-    J[2][1] = sin(theta[4]) * cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
-      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[
-      1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) *
-      l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - 
-      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] 
-      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
-      ], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
-      , -0.2e1))) * l[1] / 0.2e1;
-
-    J[2][2] = sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
-       + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * 
-      l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
-      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3
-      ]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
-      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l
-      [0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
-
-    J[2][3] = sin(theta[5]) * cos(PI - acos(sqrt
-      (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2
-      ]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
-      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(
-      theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) *
-      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin
-      (theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[
-      1] / 0.2e1;
-
-    J[2][4] = cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) 
-      * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta
-      [1]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[4]) * (l[6] - l[3]) / 0.2e1;
-
-    J[2][5] = cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[5]) * (-l[6] + l[3]) / 0.2e1;
-
-    J[3][0] = -(cos(theta[4
-      ]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[
-      0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (
-      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) 
-      / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[
-      0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0
-      ]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos
-      (theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l
-      [4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(
-      l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * 
-      l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[4]) * (sin(theta[
-      0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin
-      (theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1
-      ]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
-      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0]
-      - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(
-      PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
-      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * 
-      sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow
-      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4
-      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(
-      0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1)
-      , -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow
-      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(
-      l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
-      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] +
-      sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
-      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) *
-      pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0
-      ] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))
-      ) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0],
-      0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2])
-      * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[3][1] = -(cos(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0])
-      * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) 
-      * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l
-      [0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * 
-      (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / 
-      (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]
-      ) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0
-      ], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4
-      ]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta
-      [2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]
-      ) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)
-      ) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6
-      ] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[
-      0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0])
-      )) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] 
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
-      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] 
-      - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[4]) * cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l
-      [0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) 
-      * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0]
-      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
-      ], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
-      , -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) +
-      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] -
-      cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] -
-      cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) /
-      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + 
-      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
-      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
-      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
-      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(
-      theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[3][2] = -(-cos(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * 
-      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0
-      ], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(
-      theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * 
-      l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0
-      ] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin
-      (theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[
-      3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
-      cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + 
-      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] 
-      - cos(theta[1]) * l[0]))) * l[
-      1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1
-      ) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[
-      0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + 
-      sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
-      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) 
-      * sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (
-      l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * 
-      pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1
-      ), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * 
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow
-      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
-      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] 
-      + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1)
-      * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l
-      [0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
-      ))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0
-      ], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[
-      2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[3][3] = -(-cos(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) 
-      * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) 
-      * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2
-      ]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 
-      * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - 
-      cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) 
-      / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(
-      theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1])
-      * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(
-      theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(
-      theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(
-      theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos
-      (theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1
-      )) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[
-      6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l
-      [0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]
-      ))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4]
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
-      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] 
-      - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[5]) * cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
-      [0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) 
-      * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(
-      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0
-      ] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
-      [0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[
-      0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1)
-      + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0]
-      - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0]
-      - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0])
-      / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] +
-      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
-      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
-      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
-      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5])
-      * (-l[6] + l[3]), -0.2e1));
-
-    J[3][4] = -((-sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) *
-      l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - cos(theta[4]) * (l[6] - l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] 
-      - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[
-      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - 
-      (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) 
-      - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + 
-      pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] -
-      cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta
-      [0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta
-      [1]) * l[0]) / (l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (cos(theta[4]) * (sin(theta[
-      0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[
-      1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[
-      3]))) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta
-      [0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]
-      ) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3
-      ]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (
-      sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0
-      ], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5
-      ]) * (-l[6] + l[3]), -0.2e1));
-
-    J[3][5] = -((sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0
-      ], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[
-      2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + cos(theta[5]) * (-l[6] + l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] +
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
-      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0]
-      + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos
-      (theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[
-      1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - 
-      sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos
-      (theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]
-      ) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]
-      ) * l[0]) / (l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (-cos(theta[5]) * (sin(theta
-      [2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l
-      [1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + 
-      l[3]))) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[
-      1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta
-      [3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * 
-      (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l
-      [0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta
-      [5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[4][0] = ((-sin(theta[0]) * l[0] - sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1
-      ]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[
-      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] +
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1
-      - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1)
-      / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0]
-      - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0])
-      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]
-      ) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[0]) * l[0] + 
-      cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1]
-      / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI 
-      - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[
-      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - 
-      sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta
-      [3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
-      cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1)
-      + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) *
-      l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)
-      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1
-      ]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * 
-      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta
-      [0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l
-      [0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI -
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4
-      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0
-      ] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI 
-      - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) 
-      * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0],
-      0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) 
-      * (-l[6] + l[3]), -0.2e1));
-
-    J[4][1] = (-sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
-      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(
-      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l
-      [4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * 
-      pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1
-      / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4]
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] +
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * 
-      l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * 
-      l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos
-      (sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
-      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[0]) * l
-      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(
-      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]
-      ) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta
-      [2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l
-      [1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + 
-      l[3]), -0.2e1) * sin(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) 
-      * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] 
-      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos
-      (theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 -
-      (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1
-      ) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + 
-      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4
-      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 
-      0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2])
-      * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
-      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[
-      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l
-      [4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l
-      [0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[4][2] = ((sin(
-      theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) /
-      l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * 
-      l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0]
-      - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(
-      theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - 
-      cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos
-      (theta[3]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[
-      0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta
-      [0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(
-      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] 
-      / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI 
-      - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[
-      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - 
-      sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta
-      [3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
-      cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
-      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) *
-      l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
-      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3
-      ]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
-      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[
-      2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[
-      0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4
-      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0
-      ] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI 
-      - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
-      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) 
-      * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0],
-      0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) 
-      * (-l[6] + l[3]), -0.2e1));
-
-    J[4][3] = (sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[
-      4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow
-      (0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1
-      / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] 
-      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] +
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * 
-      l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * 
-      l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos
-      (sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
-      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[0]) * l
-      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(
-      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0])
-      * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2
-      ]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1
-      ] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[
-      3]), -0.2e1) * sin(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
-      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (
-      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1)
-      / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta
-      [2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1])
-      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + 
-      pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] -
-      cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1])
-      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
-      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
-      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    J[4][4] = -(cos(theta[0]) * l
-      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
-      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] +
-      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
-      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
-      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
-      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(
-      theta[5]) * (-l[6] + l[3]), -0.2e1) * (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) +
-      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] -
-      cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - 
-      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (
-      l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
-      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (
-      sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
-      ) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (
-      -l[6] + l[3]), -0.2e1));
-
-    J[4][5] = -(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
-      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1
-      ]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - 
-      sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[
-      1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0])
-      * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l
-      [0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * 
-      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(
-      theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (-cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l
-      [4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l
-      [0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) / (0.1e1 + pow(cos(theta[0]) * 
-      l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
-       + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - 
-      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) 
-      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin
-      (theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1
-      )) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[
-      6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l
-      [0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]
-      ))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
-
-    tau[0] = J[0][0]*F[0] + J[1][0]*F[1] + J[2][0]*F[2] + J[3][0]*F[3] + J[4][0]*F[4];
-	tau[1] = J[0][1]*F[0] + J[1][1]*F[1] + J[2][1]*F[2] + J[3][1]*F[3] + J[4][1]*F[4];
-	tau[2] = J[0][2]*F[0] + J[1][2]*F[1] + J[2][2]*F[2] + J[3][2]*F[3] + J[4][2]*F[4];
-	tau[3] = J[0][3]*F[0] + J[1][3]*F[1] + J[2][3]*F[2] + J[3][3]*F[3] + J[4][3]*F[4];
-	tau[4] = J[0][4]*F[0] + J[1][4]*F[1] + J[2][4]*F[2] + J[3][4]*F[3] + J[4][4]*F[4];
-	tau[5] = J[0][5]*F[0] + J[1][5]*F[1] + J[2][5]*F[2] + J[3][5]*F[3] + J[4][5]*F[4]; 
+    stop = 1;
 }
 
 /*
-    Limit the motor currents such that the thermal rating for the motors is not exceeded
-    while continuing to provide the peak torque when necessary.
+    Convert the encoder counts to joint angles in radians.
 */
 static void 
-limit_currents(struct limiter_state current_limiters[NUM_JOINTS], double dt, double motor_currents[NUM_JOINTS])
+encoder_counts_to_joint_angles(const t_int32 counts[NUM_JOINTS], double joint_angles[NUM_JOINTS])
 {
-    static const double current_limit_1[NUM_JOINTS]  = {LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_LARGE,   LIMIT_1_LARGE};
-    static const double current_limit_2[NUM_JOINTS]  = {LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_LARGE,   LIMIT_2_LARGE};
-    static const double timeout_1[NUM_JOINTS]        = {TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_LARGE, TIMEOUT_1_LARGE};
-    static const double timeout_2[NUM_JOINTS]        = {TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_LARGE, TIMEOUT_2_LARGE};
-
-    int index;
-    for (index = NUM_JOINTS-1; index >= 0; --index)
-    {
-        double value = fabs(motor_currents[index]);
-
-        switch (current_limiters[index].state)
-        {
-        case 0: // Limiting to the upper limits and waiting for input to exceed lower limits
-            if (value > current_limit_2[index])
-            {
-                current_limiters[index].state = 1;
-                current_limiters[index].time  = 0;
-                current_limiters[index].count = 0;
-                current_limiters[index].mean  = value;
-
-                if (value > current_limit_1[index])
-                    motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
-                else
-                    motor_currents[index] = motor_currents[index];
-            }
-            else
-                motor_currents[index] = motor_currents[index];
-
-            break;
-
-        case 1: // Limiting to the upper limits and waiting for peak time limit
-            current_limiters[index].mean += value;
-            current_limiters[index].time += dt;
-            current_limiters[index].count++;
-
-            if (current_limiters[index].time >= timeout_1[index])
-            {
-                current_limiters[index].mean /= current_limiters[index].count + 1;
-                if (current_limiters[index].mean > current_limit_2[index])
-                {
-                    current_limiters[index].state = 2;
-                    current_limiters[index].time  = 0;
-                    current_limiters[index].count = 0;
-                    motor_currents[index] = (motor_currents[index] > 0) ? current_limit_2[index] : -current_limit_2[index];
-                }
-                else
-                {
-                    current_limiters[index].state = 0;
-                    motor_currents[index] = motor_currents[index];
-                }
-            }
-            else if (value > current_limit_1[index])
-                motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
-            else
-                motor_currents[index] = motor_currents[index];
-
-            break;
-
-        case 2: // Limiting to the lower limits and waiting for motors to recover
-            current_limiters[index].time += dt;
-            current_limiters[index].count++;
-
-            if (current_limiters[index].time >= timeout_2[index])
-            {
-                if (value > current_limit_2[index])
-                {
-                    current_limiters[index].state = 1;
-                    current_limiters[index].time  = 0;
-                    current_limiters[index].count = 0;
-                    current_limiters[index].mean  = value;
-
-                    if (value > current_limit_1[index])
-                        motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
-                    else
-                        motor_currents[index] = motor_currents[index];
-                }
-                else
-                {
-                    current_limiters[index].state = 0;
-                    motor_currents[index] = motor_currents[index];
-                }
-            }
-            else if (value > current_limit_2[index])
-                motor_currents[index] = (motor_currents[index] > 0) ? current_limit_2[index] : -current_limit_2[index];
-            else
-                motor_currents[index] = motor_currents[index];
-
-            break;
-        }
-    }
+    int i;
+    for (i=NUM_JOINTS-1; i >= 0; --i) // convert counts to radians and rearrange channels appropriately
+        joint_angles[i] = counts[i] * count_factors[i] + count_offsets[i];
 }
 
 /*
@@ -852,7 +252,8 @@ start_controller(t_card board, t_task * task_pointer)
     static const t_uint32 samples           = -1; /* read continuously */
     const t_uint32        samples_in_buffer = (t_uint32)(0.1 * frequency);
 
-    qsched_param_t scheduling_parameters;
+    struct realtime_options realtime_options;
+    struct realtime_report  realtime_report;
     int result;
 
     /* Create a task to read the encoders at regular intervals */
@@ -863,9 +264,11 @@ start_controller(t_card board, t_task * task_pointer)
 
         printf("The motors have been enabled. Starting the controller...\n");
 
-        /* Bump up the priority of our thread to minimize latencies */
-        scheduling_parameters.sched_priority = qsched_get_priority_max(QSCHED_FIFO);
-        qthread_setschedparam(qthread_self(), QSCHED_FIFO, &scheduling_parameters);
+        /* Pin our thread, lock and prefault its memory and bump up its priority to minimize latencies */
+        realtime_default_options(&realtime_options);
+        realtime_setup(&realtime_options, &realtime_report);
+        realtime_print_report(&realtime_report);
+        io_cpu = realtime_report.cpu;
 
         /* Start the controller at the chosen sampling rate. */
         result = hil_task_start(*task_pointer, SYSTEM_CLOCK_1, frequency, samples);
@@ -890,26 +293,420 @@ start_controller(t_card board, t_task * task_pointer)
 }
 
 /*
-    Drive the haptic wand motors to produce the desired world-space generalized forces.
-    Motor currents are dynamically limited heuristically to prevent overheating of the motors
-    while continuing to provide peak torque.
+    Compute the output voltages that drive the haptic wand motors to produce the desired
+    world-space generalized forces. Motor currents are dynamically limited heuristically to
+    prevent overheating of the motors while continuing to provide peak torque.
 */
 static void
-generate_forces(t_card board, struct limiter_state current_limiters[NUM_JOINTS], double period,
-                const double joint_angles[NUM_JOINTS], const double world_forces[NUM_WORLD])
+generate_forces(struct current_limiter * current_limiter, double period,
+                const double jacobian[NUM_WORLD][NUM_JOINTS], const double world_forces[NUM_WORLD],
+                double output_voltages[NUM_JOINTS])
 {
     double joint_torques[NUM_JOINTS];       /* joint torques in N-m */
     double motor_currents[NUM_JOINTS];      /* motor currents in amps */
-    double output_voltages[NUM_JOINTS];     /* output voltages in volts */
 
     /* Compute the output voltages needed to produce the desired world-space generalized forces at the end-effector */
-    inverse_force_kinematics(joint_angles, world_forces, joint_torques);    /* convert generalized forces to joint torques */
+    haptic_wand_joint_torques(jacobian, world_forces, joint_torques);       /* convert generalized forces to joint torques */
     joint_torques_to_motor_currents(joint_torques, motor_currents);         /* convert joint torques to motor currents */
-    limit_currents(current_limiters, period, motor_currents);               /* limit motor currents to prevent overheating */
+    current_limiter_apply(current_limiter, period, motor_currents);         /* limit motor currents to prevent overheating */
     motor_currents_to_output_voltages(motor_currents, output_voltages);     /* compute output voltages required to produce the motor currents */
+}
+
+/*
+    Build the virtual scene felt by the end-effector: a floor below the workspace, a sphere to the
+    left of the home position, a box to its right and an octahedron in front of it, all clear of
+    the home position. Returns 0 on success and -1 on failure.
+*/
+static int
+build_scene(struct haptic_scene * scene)
+{
+    static const double floor_point[3]   = { 0.25, 0, -0.08 };
+    static const double floor_normal[3]  = { 0, 0, 1 };
+    static const double sphere_center[3] = { 0.25, 0.08, 0 };
+    static const double box_minimum[3]   = { 0.20, -0.12, -0.03 };
+    static const double box_maximum[3]   = { 0.26, -0.06,  0.03 };
+    static const double octahedron_vertices[6][3] =
+    {
+        { 0.34, 0, 0 }, { 0.30, 0, 0 }, { 0.32, 0.02, 0 }, { 0.32, -0.02, 0 }, { 0.32, 0, 0.02 }, { 0.32, 0, -0.02 }
+    };
+    static const t_uint32 octahedron_triangles[8][3] =
+    {
+        { 0, 2, 4 }, { 2, 1, 4 }, { 1, 3, 4 }, { 3, 0, 4 }, { 2, 0, 5 }, { 1, 2, 5 }, { 3, 1, 5 }, { 0, 3, 5 }
+    };
+    static const double stiffness = 300;  /* N/m */
+    static const double damping   = 2;    /* N-s/m */
+    static const double thickness = 0.04; /* m, the whole octahedron */
+
+    if (haptic_scene_create(scene, 4, 16, 1) != 0)
+        return -1;
+
+    if (haptic_scene_add_plane(scene, floor_point, floor_normal, stiffness, damping) == 0
+        && haptic_scene_add_sphere(scene, sphere_center, 0.03, stiffness, damping) == 0
+        && haptic_scene_add_box(scene, box_minimum, box_maximum, stiffness, damping) == 0
+        && haptic_scene_add_mesh(scene, ARRAY_LENGTH(octahedron_vertices), octahedron_vertices,
+                                 ARRAY_LENGTH(octahedron_triangles), octahedron_triangles, thickness, stiffness, damping) == 0
+        && haptic_scene_build(scene) == 0)
+        return 0;
+
+    haptic_scene_destroy(scene);
+    return -1;
+}
+
+/*
+    Prepare the joint velocity estimator with the chosen filter. Returns 0 on success and -1 on
+    failure.
+*/
+static int
+prepare_velocity_estimator(void)
+{
+    if (velocity_filter == VELOCITY_FILTER_LEAST_SQUARES)
+        return velocity_estimator_init_least_squares(&velocity_estimator, NUM_JOINTS, 1.0 / frequency, velocity_window);
+    else
+        return velocity_estimator_init_difference(&velocity_estimator, NUM_JOINTS, 1.0 / frequency, velocity_cutoff);
+}
+
+/*
+    Build the tables of the sines of the joint angles if HAPTIC_WAND_TRIG_TABLE is defined. Returns
+    0 on success and -1 on failure.
+*/
+static int
+prepare_trig_table(void)
+{
+#if defined(HAPTIC_WAND_TRIG_TABLE)
+    return haptic_wand_trig_table_create(&trig_table, count_factors, count_offsets);
+#else
+    return 0;
+#endif
+}
+
+/*
+    Compute the world-space coordinates of the end-effector and the Jacobian from the joint angles,
+    with the sines and cosines of the joint angles looked up by encoder count if
+    HAPTIC_WAND_TRIG_TABLE is defined, or in single precision if HAPTIC_WAND_SINGLE_PRECISION is
+    defined.
+*/
+static void
+compute_kinematics(const t_int32 counts[NUM_JOINTS], const double joint_angles[NUM_JOINTS],
+                   double world_coordinates[NUM_WORLD], double jacobian[NUM_WORLD][NUM_JOINTS])
+{
+#if defined(HAPTIC_WAND_TRIG_TABLE)
+    double sines[NUM_JOINTS];
+    double cosines[NUM_JOINTS];
+
+    (void) joint_angles; /* the angles are looked up by encoder count instead */
+
+    haptic_wand_trig_table_lookup(&trig_table, counts, sines, cosines);
+    haptic_wand_jacobian_trig(sines, cosines, world_coordinates, jacobian);
+#elif defined(HAPTIC_WAND_SINGLE_PRECISION)
+    float theta[NUM_JOINTS];
+    float X[NUM_WORLD];
+    float J[NUM_WORLD][NUM_JOINTS];
+    int i, j;
+
+    (void) counts; /* only used to look up the sines in the tables */
+
+    for (j = 0; j < NUM_JOINTS; j++)
+        theta[j] = (float) joint_angles[j];
+
+    haptic_wand_jacobian_float(theta, X, J);
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        world_coordinates[i] = X[i];
+        for (j = 0; j < NUM_JOINTS; j++)
+            jacobian[i][j] = J[i][j];
+    }
+#else
+    (void) counts; /* only used to look up the sines in the tables */
+    haptic_wand_jacobian(joint_angles, world_coordinates, jacobian);
+#endif
+}
+
+/*
+    Compute the output voltages for one sample of the encoder counts and the joint angles converted
+    from them, taken the given number of sampling periods after the previous sample for which
+    voltages were computed.
+*/
+static void
+control_wand(struct current_limiter * current_limiter, t_uint32 samples, const t_int32 counts[NUM_JOINTS],
+             const double joint_angles[NUM_JOINTS], double output_voltages[NUM_JOINTS])
+{
+    static const double k[NUM_WORLD]    = { 0, 0, 0, 0, 0 }; /* set elements to get springs in different world coordinates */
+    static const double b[NUM_WORLD]    = { 0, 0, 0, 0, 0 }; /* set elements to get viscous damping in different world coordinates */
+    static const double home[NUM_WORLD] = { 0.25, 0, 0, 0, 0 }; /* home position, in front of calibration position */
+
+    double joint_velocities[NUM_JOINTS];    /* joint velocities in radians/s */
+    double world_coordinates[NUM_WORLD];    /* world coordinates X, Y, Z in m and roll (about X) and pitch (about Y) in radians */
+    double world_velocities[NUM_WORLD];     /* world velocities in m/s and radians/s */
+    double jacobian[NUM_WORLD][NUM_JOINTS]; /* derivatives of the world coordinates with respect to the joint angles */
+    double world_forces[NUM_WORLD];         /* world forces in N and world torques in N-m */
+    double scene_forces[3];                 /* forces of the virtual scene on the end-effector in N */
+    t_timeout start_time, end_time;
+    int i;
+
+    /* Compute the world-space coordinates for the end-effector, and the Jacobian used to generate the forces */
+    compute_kinematics(counts, joint_angles, world_coordinates, jacobian);
+
+    /* Estimate the joint velocities and map them to world space through the Jacobian */
+    timeout_get_high_resolution_time(&start_time);
+    velocity_estimator_update(&velocity_estimator, samples, joint_angles, joint_velocities);
+    haptic_wand_world_velocity(jacobian, joint_velocities, world_velocities);
+    timeout_get_high_resolution_time(&end_time);
+    latency_histogram_record(&timing.velocity, latency_histogram_interval(&start_time, &end_time));
+
+    /* Compute forces in world coordinates (simple springs and dampers plus the forces of the virtual scene in this example) */
+    for (i = 0; i < NUM_WORLD; i++)
+        world_forces[i] = -k[i] * (world_coordinates[i] - home[i]) - b[i] * world_velocities[i];
+
+    haptic_scene_render(&scene, world_coordinates, world_velocities, scene_forces);
+    for (i = 0; i < 3; i++)
+        world_forces[i] += scene_forces[i];
+
+    generate_forces(current_limiter, samples / frequency, jacobian, world_forces, output_voltages);
+}
+
+/*
+    Run the controller on this thread alone, reading the encoders, computing the output voltages
+    and writing them in turn. Returns the result of the last read.
+*/
+static t_int
+run_serial(t_card board, t_task task)
+{
+    struct current_limiter current_limiter;
+    t_int32   counts[NUM_JOINTS];
+    t_int     samples_read;
+    t_timeout read_time, compute_time, write_time;
+
+    haptic_wand_current_limiter_init(&current_limiter);
+
+    samples_read = hil_task_read_encoder(task, 1, counts); /* read one sample of the encoders */
+    while (samples_read > 0 && stop == 0)
+    {
+        double joint_angles[NUM_JOINTS];        /* joint angles in radians */
+        double output_voltages[NUM_JOINTS];     /* output voltages in volts */
+
+        timeout_get_high_resolution_time(&read_time);
+
+        /* Compute the voltages that drive the motors to produce the desired world-space forces and torques */
+        encoder_counts_to_joint_angles(counts, joint_angles);
+        control_wand(&current_limiter, 1, counts, joint_angles, output_voltages);
+        timeout_get_high_resolution_time(&compute_time);
+
+        /* Write the voltages to the outputs */
+        hil_write_analog(board, analog_channels, ARRAY_LENGTH(analog_channels), output_voltages);
+        timeout_get_high_resolution_time(&write_time);
+
+        timing.samples++;
+        latency_histogram_record(&timing.compute, latency_histogram_interval(&read_time, &compute_time));
+        latency_histogram_record(&timing.io, latency_histogram_interval(&read_time, &write_time));
+
+        /* Prepare for the next sampling instant */
+        samples_read = hil_task_read_encoder(task, 1, counts);  /* read the encoders for the next sampling instant */
+    }
+
+    return samples_read;
+}
+
+/*
+    The compute thread of the pipelined mode. It waits for new joint angles from the I/O thread,
+    computes the output voltages from them and passes the voltages back. If it falls behind, it
+    goes straight to the latest joint angles, and the current limiter and velocity estimator
+    account for the time since the last sample it computed.
+*/
+static void *
+compute_thread(void * argument)
+{
+    struct compute_context * context = (struct compute_context *) argument;
+
+    struct realtime_options        realtime_options;
+    struct current_limiter         current_limiter;
+    struct joint_angles_message    angles;
+    struct output_voltages_message voltages;
+    t_uint64  next_sample = 0;
+    t_timeout poll_interval;
+    t_timeout start_time, end_time;
+
+    /*
+        Raise the priority of the thread and let it run on any core other than the one reserved for
+        the I/O thread. The thread inherited the affinity of the I/O thread, which is pinned to that
+        core, so it must be moved off it explicitly. The memory of the process is already locked.
+        The thread has the default stack size, which is small on some targets, so only the part of
+        the stack that the computations use is prefaulted.
+    */
+    realtime_default_options(&realtime_options);
+    realtime_options.cpu          = REALTIME_CPU_OTHERS;
+    realtime_options.excluded_cpu = context->io_cpu;
+    realtime_options.lock_memory  = false;
+    realtime_options.heap_size    = 0;
+    realtime_options.stack_size   = compute_stack_size;
+    realtime_setup(&realtime_options, &context->realtime_report);
+
+    /*
+        Poll rather than spin, so the thread never keeps the I/O thread of the same priority from
+        running when both share a core. The outputs are not written until the next sampling
+        instant, so the delay before new joint angles are seen costs nothing.
+    */
+    poll_interval.seconds     = 0;
+    poll_interval.nanoseconds = (t_int) (context->period * 1e9 / 50);
+    poll_interval.is_absolute = false;
+
+    haptic_wand_current_limiter_init(&current_limiter);
+
+    while (!context->done)
+    {
+        if (seqlock_mailbox_read(&context->joint_angles, &angles, sizeof(angles)) == 0 && angles.sample >= next_sample)
+        {
+            timeout_get_high_resolution_time(&start_time);
+
+            control_wand(&current_limiter, (t_uint32) (angles.sample - next_sample + 1), angles.counts, angles.joint_angles,
+                         voltages.output_voltages);
+            voltages.sample    = angles.sample;
+            voltages.read_time = angles.read_time;
+            seqlock_mailbox_write(&context->output_voltages, &voltages, sizeof(voltages));
+
+            timeout_get_high_resolution_time(&end_time);
+            latency_histogram_record(&timing.compute, latency_histogram_interval(&start_time, &end_time));
 
-    /* Write the voltages to the outputs */
-    hil_write_analog(board, analog_channels, ARRAY_LENGTH(analog_channels), output_voltages);
+            timing.skipped_samples += angles.sample - next_sample;
+            next_sample = angles.sample + 1;
+        }
+        else
+            qtimer_sleep(&poll_interval);
+    }
+
+    return NULL;
+}
+
+/*
+    Run the controller in pipelined mode. This thread owns the board: at each sampling instant it
+    passes the joint angles to the compute thread and writes the latest output voltages the compute
+    thread has passed back. Returns the result of the last read.
+*/
+static t_int
+run_pipelined(t_card board, t_task task)
+{
+    static const t_double zero_voltages[NUM_JOINTS] = { 0, 0, 0, 0, 0, 0 };
+    static struct compute_context context;
+
+    struct joint_angles_message    angles;
+    struct output_voltages_message voltages;
+    qthread_t compute;
+    t_int32   counts[NUM_JOINTS];
+    t_int     samples_read;
+    t_int     result;
+    t_uint64  sample = 0;
+    t_uint64  written_sample = 0;
+    t_boolean written = false;
+    t_timeout write_time;
+
+    seqlock_mailbox_init(&context.joint_angles);
+    seqlock_mailbox_init(&context.output_voltages);
+    context.period = 1.0 / frequency;
+    context.io_cpu = io_cpu;
+    context.done   = 0;
+
+    result = qthread_create(&compute, NULL, compute_thread, &context);
+    if (result != 0)
+    {
+        msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+        printf("Unable to create the compute thread. %s Error %d. Running the controller on one thread.\n", message, -result);
+        return run_serial(board, task);
+    }
+
+    samples_read = hil_task_read_encoder(task, 1, counts); /* read one sample of the encoders */
+    while (samples_read > 0 && stop == 0)
+    {
+        timeout_get_high_resolution_time(&angles.read_time);
+
+        /* Pass the joint angles to the compute thread */
+        angles.sample = sample;
+        memcpy(angles.counts, counts, sizeof(angles.counts));
+        encoder_counts_to_joint_angles(counts, angles.joint_angles);
+        seqlock_mailbox_write(&context.joint_angles, &angles, sizeof(angles));
+
+        /*
+            Write the voltages computed from the latest sample the compute thread has finished. The
+            outputs hold their values, so they are only written when there are new voltages. If the
+            compute thread has stalled, the motors are driven with zero voltage instead of with
+            forces computed for a position the wand has long since left.
+        */
+        if (seqlock_mailbox_read(&context.output_voltages, &voltages, sizeof(voltages)) == 0
+            && voltages.sample + maximum_output_age >= sample)
+        {
+            if (!written || voltages.sample != written_sample)
+            {
+                hil_write_analog(board, analog_channels, ARRAY_LENGTH(analog_channels), voltages.output_voltages);
+                timeout_get_high_resolution_time(&write_time);
+
+                latency_histogram_record(&timing.latency, latency_histogram_interval(&voltages.read_time, &write_time));
+                written_sample = voltages.sample;
+                written        = true;
+            }
+            else
+                timing.stale_outputs++;
+        }
+        else if (sample > 0)
+        {
+            hil_write_analog(board, analog_channels, ARRAY_LENGTH(analog_channels), zero_voltages);
+            timing.zeroed_outputs++;
+        }
+
+        timeout_get_high_resolution_time(&write_time);
+        latency_histogram_record(&timing.io, latency_histogram_interval(&angles.read_time, &write_time));
+        timing.samples++;
+        sample++;
+
+        /* Prepare for the next sampling instant */
+        samples_read = hil_task_read_encoder(task, 1, counts);  /* read the encoders for the next sampling instant */
+    }
+
+    context.done = 1;
+    qthread_join(compute, NULL);
+
+    printf("\nThe compute thread was prepared as follows.\n");
+    realtime_print_report(&context.realtime_report);
+
+    return samples_read;
+}
+
+static void
+print_stage(const char * name, const struct latency_histogram * histogram)
+{
+    printf("    %-24s %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n", name,
+        (histogram->count > 0) ? histogram->minimum * 1e-3 : 0.0,
+        latency_histogram_mean(histogram) * 1e-3,
+        latency_histogram_percentile(histogram, 50) * 1e-3,
+        latency_histogram_percentile(histogram, 99) * 1e-3,
+        latency_histogram_percentile(histogram, 99.9) * 1e-3,
+        histogram->maximum * 1e-3);
+}
+
+/*
+    Print the time taken by each stage of the controller and how often the scene was searched to
+    the console.
+*/
+static void
+print_stage_timing(void)
+{
+    if (timing.samples == 0)
+        return;
+
+    printf("\nStage timing over %.0f samples, %s:\n", (double) timing.samples,
+        pipelined ? "pipelined" : "serial");
+    printf("    %-24s %9s %9s %9s %9s %9s %9s\n", "(usecs)", "Min", "Mean", "p50", "p99", "p99.9", "Max");
+    print_stage("Read to write (I/O)", &timing.io);
+    print_stage("Compute", &timing.compute);
+    print_stage("Velocity estimate", &timing.velocity);
+    if (pipelined) /* in the serial mode the samples are written as soon as they are computed, so this is the I/O time */
+        print_stage("Sample to output", &timing.latency);
+    printf("    Scene searched at %.0f of %.0f samples.\n", (double) scene.refreshes, (double) scene.renders);
+
+    if (pipelined)
+    {
+        printf("    Samples skipped by the compute thread: %.0f\n", (double) timing.skipped_samples);
+        printf("    Sampling instants without new outputs: %.0f\n", (double) timing.stale_outputs);
+        printf("    Sampling instants with the motors zeroed: %.0f\n", (double) timing.zeroed_outputs);
+    }
 }
 
 /*
@@ -938,48 +735,33 @@ int main(int argc, char * argv[])
 
         if (calibrate_wand(board))
         {
-            const t_double period = 1.0 / frequency;
-
-            t_int32  counts[NUM_JOINTS];
-            t_int    samples_read;
-            t_task   task;
+            t_int  samples_read;
+            t_task task;
 
             printf("The Quanser 5DOF Haptic Wand has been calibrated. Remove the Wand\n");
             printf("from the calibration position and press Enter to start the controller.\n");
             getchar();
 
-            if (start_controller(board, &task))
+            latency_histogram_init(&timing.io);
+            latency_histogram_init(&timing.compute);
+            latency_histogram_init(&timing.latency);
+            latency_histogram_init(&timing.velocity);
+
+            if (build_scene(&scene) != 0)
+                printf("Unable to build the virtual scene.\n");
+            else if (prepare_velocity_estimator() != 0)
+                printf("Unable to prepare the velocity estimator.\n");
+            else if (prepare_trig_table() != 0)
+                printf("Unable to build the tables of joint sines and cosines.\n");
+            else if (start_controller(board, &task))
             {
-                const double k[NUM_WORLD]    = { 0, 0, 0, 0, 0 }; /* set elements to get springs in different world coordinates */
-                const double home[NUM_WORLD] = { 0.25, 0, 0, 0, 0 }; /* home position, in front of calibration position */
-
-                struct limiter_state current_limiters[NUM_JOINTS];
-                memset(current_limiters, 0, sizeof(current_limiters));
-
-                samples_read = hil_task_read_encoder(task, 1, counts); /* read one sample of the encoders */
-                while (samples_read > 0 && stop == 0)
-                {
-                    double joint_angles[NUM_JOINTS];        /* joint angles in radians */
-                    double world_coordinates[NUM_WORLD];    /* world coordinates X, Y, Z in m and roll (about X) and pitch (about Y) in radians */
-                    double world_forces[NUM_WORLD];         /* world forces in N and world torques in N-m */
-                    int i;
-
-                    /* Compute the world-space coordinates for the end-effector */
-                    encoder_counts_to_joint_angles(counts, joint_angles);
-                    forward_kinematics(joint_angles, world_coordinates);
-
-                    /* Compute forces in world coordinates (simple spring in this example) */
-                    for (i = 0; i < NUM_WORLD; i++)
-                        world_forces[i] = -k[i] * (world_coordinates[i] - home[i]);
-                    
-                    /* Drive the motors to produce the desired world-space forces and torques */
-                    generate_forces(board, current_limiters, period, joint_angles, world_forces);
-
-                    /* Prepare for the next sampling instant */
-                    samples_read = hil_task_read_encoder(task, 1, counts);  /* read the encoders for the next sampling instant */
-                }
+                if (pipelined)
+                    samples_read = run_pipelined(board, task);
+                else
+                    samples_read = run_serial(board, task);
 
                 stop_controller(board, task);
+                print_stage_timing();
 
                 if (samples_read < 0)
                 {
@@ -992,6 +774,9 @@ int main(int argc, char * argv[])
                     getchar(); /* absorb Ctrl-C */
                 }
             }
+
+            haptic_wand_trig_table_destroy(&trig_table);
+            haptic_scene_destroy(&scene);
         }
 
         hil_close(board);
@@ -16,3 +16,15 @@
 #include "quanser_signal.h"
 #include "quanser_messages.h"
 #include "quanser_thread.h"
+#include "quanser_timer.h"
+
+#include "realtime.h"
+#include "latency_histogram.h"
+#include "seqlock_mailbox.h"
+
+#include "haptic_wand_kinematics.h"
+#include "haptic_wand_kinematics_float.h"
+#include "haptic_wand_limiter.h"
+#include "haptic_wand_scene.h"
+#include "haptic_wand_trig_table.h"
+#include "haptic_wand_velocity.h"
@@ -0,0 +1,479 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_kinematics.c - C file
+//
+// Implements the haptic wand kinematics described in
+// haptic_wand_kinematics.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <math.h>
+
+#include "quanser_thread.h"
+
+#include "haptic_wand_kinematics.h"
+
+#define ROUNDING    6755399441055744.0  /* 1.5 * 2^52, which rounds any smaller value to an integer when added */
+
+static const double l[7] = { L1, L2, L3, L4, L5, L6, L7 }; /* link lengths of the haptic wand links */
+
+/*
+    The terms shared by the kinematics of one five-bar linkage, driven by the joint angles
+    theta_a and theta_b.
+*/
+struct linkage
+{
+    double cos_a, sin_a;    /* cosine and sine of theta_a */
+    double cos_b, sin_b;    /* cosine and sine of theta_b */
+    double dx, dy;          /* vector from the elbow of link b to the elbow of link a */
+    double distance;        /* length of that vector */
+    double alpha;           /* angle of the distal link driven by link a */
+    double cos_alpha;       /* cosine of alpha */
+    double sin_alpha;       /* sine of alpha */
+    double x, y;            /* end point of the linkage in the plane of the linkage */
+
+    /* Derivatives of the end point with respect to theta_a and theta_b, filled in by differentiate_linkage */
+    double x_a, x_b;
+    double y_a, y_b;
+};
+
+/*
+    Solve one five-bar linkage for the position of its end point, given the sines and cosines of
+    its joint angles, theta_a and theta_b.
+*/
+static void
+solve_linkage(double sin_a, double cos_a, double sin_b, double cos_b, struct linkage * linkage)
+{
+    linkage->cos_a = cos_a;
+    linkage->sin_a = sin_a;
+    linkage->cos_b = cos_b;
+    linkage->sin_b = sin_b;
+
+    linkage->dx       = l[4] + linkage->cos_a * l[0] - linkage->cos_b * l[0];
+    linkage->dy       = linkage->sin_a * l[0] - linkage->sin_b * l[0];
+    linkage->distance = sqrt(linkage->dx * linkage->dx + linkage->dy * linkage->dy);
+    linkage->alpha    = PI - acos(linkage->distance / l[1] / 2) + atan(linkage->dy / linkage->dx);
+
+    linkage->cos_alpha = cos(linkage->alpha);
+    linkage->sin_alpha = sin(linkage->alpha);
+
+    linkage->x = linkage->cos_a * l[0] + linkage->cos_alpha * l[1];
+    linkage->y = linkage->sin_a * l[0] + linkage->sin_alpha * l[1];
+}
+
+/*
+    Differentiate the end point of a linkage solved by solve_linkage with respect to its two joint
+    angles. The angle of the distal link depends on both joints through the distance between the
+    elbows, via the arccosine, and through the direction between them, via the arctangent.
+*/
+static void
+differentiate_linkage(struct linkage * linkage)
+{
+    const double half_distance = linkage->distance / l[1] / 2;
+    const double acos_scale    = 1 / (2 * l[1] * sqrt(1 - half_distance * half_distance));
+    const double squared       = linkage->distance * linkage->distance;
+
+    /* Derivatives of the vector between the elbows */
+    const double dx_a = -linkage->sin_a * l[0];
+    const double dx_b =  linkage->sin_b * l[0];
+    const double dy_a =  linkage->cos_a * l[0];
+    const double dy_b = -linkage->cos_b * l[0];
+
+    /* Derivatives of the angle of the distal link */
+    const double alpha_a = (linkage->dx * dx_a + linkage->dy * dy_a) / linkage->distance * acos_scale
+                         + (linkage->dx * dy_a - linkage->dy * dx_a) / squared;
+    const double alpha_b = (linkage->dx * dx_b + linkage->dy * dy_b) / linkage->distance * acos_scale
+                         + (linkage->dx * dy_b - linkage->dy * dx_b) / squared;
+
+    linkage->x_a = -linkage->sin_a * l[0] - linkage->sin_alpha * l[1] * alpha_a;
+    linkage->x_b = -linkage->sin_alpha * l[1] * alpha_b;
+    linkage->y_a =  linkage->cos_a * l[0] + linkage->cos_alpha * l[1] * alpha_a;
+    linkage->y_b =  linkage->cos_alpha * l[1] * alpha_b;
+}
+
+void
+haptic_wand_forward_kinematics(const double theta[NUM_JOINTS], double X[NUM_WORLD])
+{
+    const double offset = l[6] - l[3];  /* offset of each linkage plane from its axis of rotation */
+    const double cos_4  = cos(theta[4]);
+    const double sin_4  = sin(theta[4]);
+    const double cos_5  = cos(theta[5]);
+    const double sin_5  = sin(theta[5]);
+
+    struct linkage first, second;
+    double depth;
+
+    solve_linkage(sin(theta[0]), cos(theta[0]), sin(theta[1]), cos(theta[1]), &first);
+    solve_linkage(sin(theta[2]), cos(theta[2]), sin(theta[3]), cos(theta[3]), &second);
+
+    /* Distance between the end points of the two linkages along the length of the wand */
+    depth = l[5] + sin_4 * first.y + cos_4 * offset - sin_5 * second.y + cos_5 * offset;
+
+    X[0] = (l[4] + second.x + first.x) / 2;
+    X[1] = (cos_5 * second.y + sin_5 * offset + cos_4 * first.y - sin_4 * offset) / 2;
+    X[2] = (sin_5 * second.y - cos_5 * offset + sin_4 * first.y + cos_4 * offset) / 2;
+    X[3] = -atan((cos_4 * first.y - sin_4 * offset - cos_5 * second.y - sin_5 * offset) / depth);
+    X[4] = atan((first.x - second.x) / depth);
+}
+
+void
+haptic_wand_jacobian(const double theta[NUM_JOINTS], double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS])
+{
+    double sines[NUM_JOINTS];
+    double cosines[NUM_JOINTS];
+    int i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+    {
+        cosines[i] = cos(theta[i]);
+        sines[i]   = sin(theta[i]);
+    }
+
+    haptic_wand_jacobian_trig(sines, cosines, X, J);
+}
+
+void
+haptic_wand_jacobian_trig(const double sines[NUM_JOINTS], const double cosines[NUM_JOINTS],
+                          double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS])
+{
+    const double offset = l[6] - l[3];  /* offset of each linkage plane from its axis of rotation */
+    const double cos_4  = cosines[4];
+    const double sin_4  = sines[4];
+    const double cos_5  = cosines[5];
+    const double sin_5  = sines[5];
+
+    struct linkage first, second;
+    double roll, pitch, depth;
+    double roll_scale, pitch_scale;
+    double roll_4, roll_5, depth_4, depth_5;
+
+    solve_linkage(sines[0], cosines[0], sines[1], cosines[1], &first);
+    solve_linkage(sines[2], cosines[2], sines[3], cosines[3], &second);
+    differentiate_linkage(&first);
+    differentiate_linkage(&second);
+
+    /* The roll and pitch are the arctangents of roll / depth and pitch / depth */
+    roll  = cos_4 * first.y - sin_4 * offset - cos_5 * second.y - sin_5 * offset;
+    pitch = first.x - second.x;
+    depth = l[5] + sin_4 * first.y + cos_4 * offset - sin_5 * second.y + cos_5 * offset;
+
+    X[0] = (l[4] + second.x + first.x) / 2;
+    X[1] = (cos_5 * second.y + sin_5 * offset + cos_4 * first.y - sin_4 * offset) / 2;
+    X[2] = (sin_5 * second.y - cos_5 * offset + sin_4 * first.y + cos_4 * offset) / 2;
+    X[3] = -atan(roll / depth);
+    X[4] = atan(pitch / depth);
+
+    /* Derivatives of the roll and depth with respect to the rotation of each linkage plane */
+    roll_4  = -sin_4 * first.y - cos_4 * offset;
+    roll_5  =  sin_5 * second.y - cos_5 * offset;
+    depth_4 =  cos_4 * first.y - sin_4 * offset;
+    depth_5 = -cos_5 * second.y - sin_5 * offset;
+
+    /* The derivative of atan(n / d) is (d n' - n d') / (d^2 + n^2) */
+    roll_scale  = -1 / (depth * depth + roll * roll);
+    pitch_scale =  1 / (depth * depth + pitch * pitch);
+
+    J[0][0] = first.x_a / 2;
+    J[0][1] = first.x_b / 2;
+    J[0][2] = second.x_a / 2;
+    J[0][3] = second.x_b / 2;
+    J[0][4] = 0;
+    J[0][5] = 0;
+
+    J[1][0] = cos_4 * first.y_a / 2;
+    J[1][1] = cos_4 * first.y_b / 2;
+    J[1][2] = cos_5 * second.y_a / 2;
+    J[1][3] = cos_5 * second.y_b / 2;
+    J[1][4] = roll_4 / 2;
+    J[1][5] = (cos_5 * offset - sin_5 * second.y) / 2;
+
+    J[2][0] = sin_4 * first.y_a / 2;
+    J[2][1] = sin_4 * first.y_b / 2;
+    J[2][2] = sin_5 * second.y_a / 2;
+    J[2][3] = sin_5 * second.y_b / 2;
+    J[2][4] = depth_4 / 2;
+    J[2][5] = (cos_5 * second.y + sin_5 * offset) / 2;
+
+    J[3][0] = roll_scale * (depth * cos_4 * first.y_a - roll * sin_4 * first.y_a);
+    J[3][1] = roll_scale * (depth * cos_4 * first.y_b - roll * sin_4 * first.y_b);
+    J[3][2] = roll_scale * (-depth * cos_5 * second.y_a + roll * sin_5 * second.y_a);
+    J[3][3] = roll_scale * (-depth * cos_5 * second.y_b + roll * sin_5 * second.y_b);
+    J[3][4] = roll_scale * (depth * roll_4 - roll * depth_4);
+    J[3][5] = roll_scale * (depth * roll_5 - roll * depth_5);
+
+    J[4][0] = pitch_scale * (depth * first.x_a - pitch * sin_4 * first.y_a);
+    J[4][1] = pitch_scale * (depth * first.x_b - pitch * sin_4 * first.y_b);
+    J[4][2] = pitch_scale * (-depth * second.x_a + pitch * sin_5 * second.y_a);
+    J[4][3] = pitch_scale * (-depth * second.x_b + pitch * sin_5 * second.y_b);
+    J[4][4] = pitch_scale * (-pitch * depth_4);
+    J[4][5] = pitch_scale * (-pitch * depth_5);
+}
+
+void
+haptic_wand_joint_torques(const double J[NUM_WORLD][NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS])
+{
+    int i, j;
+
+    for (j = 0; j < NUM_JOINTS; j++)
+    {
+        double sum = 0;
+        for (i = 0; i < NUM_WORLD; i++)
+            sum += J[i][j] * F[i];
+        tau[j] = sum;
+    }
+}
+
+void
+haptic_wand_inverse_force_kinematics(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS])
+{
+    double X[NUM_WORLD];
+    double J[NUM_WORLD][NUM_JOINTS];
+
+    haptic_wand_jacobian(theta, X, J);
+    haptic_wand_joint_torques(J, F, tau);
+}
+
+/*
+    Compute the sine and cosine of a number of angles. Each angle is reduced by the nearest
+    multiple of pi/2, in three parts so that the reduction is exact for angles below 1e6 radians,
+    and the sine and cosine of the remainder are evaluated by the polynomials of fdlibm. The quadrant
+    selects which of them is the sine and its sign by arithmetic rather than branches.
+*/
+static void
+sincos_batch(t_uint count, const double * angle, double * sine, double * cosine)
+{
+    t_uint k;
+
+    for (k = 0; k < count; k++)
+    {
+        const double q = (angle[k] * 6.36619772367581382433e-01 + ROUNDING) - ROUNDING;
+        const double r = ((angle[k] - q * 1.57079632673412561417e+00) - q * 6.07710050630396597660e-11) - q * 2.02226624871116645580e-21;
+        const double z = r * r;
+
+        const double s = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04
+                       + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+        const double c = 1 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05
+                       + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+
+        const int    quadrant = (int) q;
+        const double swap     = quadrant & 1;
+        const double sin_sign = 1 - (quadrant & 2);
+        const double cos_sign = 1 - ((quadrant + 1) & 2);
+
+        sine[k]   = (s * (1 - swap) + c * swap) * sin_sign;
+        cosine[k] = (c * (1 - swap) + s * swap) * cos_sign;
+    }
+}
+
+/*
+    Compute the arctangent of a number of values. The magnitude of each value is reduced to below
+    0.66 using atan(x) = pi/2 - atan(1/x) above tan(3 pi/8) and atan(x) = pi/4 + atan((x - 1)/(x + 1))
+    above 0.66, and the arctangent of the remainder is evaluated by the rational function of Cephes.
+    The reduction is selected by multiplying by the outcomes of the comparisons rather than by
+    branches.
+*/
+static void
+atan_batch(t_uint count, const double * value, double * angle)
+{
+    const double more_bits = 6.123233995736765886130e-17;   /* pi/2 less its nearest double */
+    t_uint k;
+
+    for (k = 0; k < count; k++)
+    {
+        const double a     = fabs(value[k]);
+        const double large = a > 2.41421356237309504880;
+        const double mid   = a > 0.66;
+        const double t     = (a * (1 - large) - mid) / (a * mid + (1 - large));
+        const double base  = large * (PI / 2) + (mid - large) * (PI / 4);
+        const double extra = large * more_bits + (mid - large) * (more_bits / 2);
+        const double z     = t * t;
+
+        const double p = (((-8.750608600031904122785e-01 * z - 1.615753718733365076637e+01) * z - 7.500855792314704667340e+01) * z
+                       - 1.228866684490136173410e+02) * z - 6.485021904942025371773e+01;
+        const double q = ((((z + 2.485846490142306297962e+01) * z + 1.650270098316988542046e+02) * z + 4.328810604912902668951e+02) * z
+                       + 4.853903996359136964868e+02) * z + 1.945506571482613964425e+02;
+
+        angle[k] = copysign(base + (t + (t * z * p / q + extra)), value[k]);
+    }
+}
+
+/*
+    The intermediate results of the batch kinematics for one block of samples. Keeping them in one
+    structure lets the compiler see that the arrays do not overlap.
+*/
+struct kinematics_block
+{
+    double sines[NUM_JOINTS][HAPTIC_WAND_BATCH_SIZE];
+    double cosines[NUM_JOINTS][HAPTIC_WAND_BATCH_SIZE];
+    double x[2][HAPTIC_WAND_BATCH_SIZE];        /* end point of each linkage in the plane of the linkage */
+    double y[2][HAPTIC_WAND_BATCH_SIZE];
+    double roll[HAPTIC_WAND_BATCH_SIZE];        /* tangents of the roll and pitch */
+    double pitch[HAPTIC_WAND_BATCH_SIZE];
+};
+
+/*
+    Solve one five-bar linkage for the end points of the samples in a block. The angle of the distal
+    link is pi - acos(h) + atan(dy/dx), where h is half the distance between the elbows relative to
+    the length of the distal links, so its cosine and sine follow from the angle-sum identities with
+    cos(acos(h)) = h, sin(acos(h)) = sqrt(1 - h^2) and the cosine and sine of the arctangent given by
+    the vector between the elbows.
+*/
+static void
+solve_linkage_batch(t_uint count, t_uint linkage, struct kinematics_block * block)
+{
+    const double * cos_a = block->cosines[2 * linkage];
+    const double * sin_a = block->sines[2 * linkage];
+    const double * cos_b = block->cosines[2 * linkage + 1];
+    const double * sin_b = block->sines[2 * linkage + 1];
+    t_uint k;
+
+    for (k = 0; k < count; k++)
+    {
+        const double dx       = l[4] + cos_a[k] * l[0] - cos_b[k] * l[0];
+        const double dy       = sin_a[k] * l[0] - sin_b[k] * l[0];
+        const double distance = sqrt(dx * dx + dy * dy);
+
+        const double cos_acos = distance / l[1] / 2;
+        const double sin_acos = sqrt(1 - cos_acos * cos_acos);
+        const double cos_atan = fabs(dx) / distance;
+        const double sin_atan = copysign(1.0, dx) * dy / distance;
+
+        const double cos_alpha = -(cos_acos * cos_atan + sin_acos * sin_atan);
+        const double sin_alpha = sin_acos * cos_atan - cos_acos * sin_atan;
+
+        block->x[linkage][k] = cos_a[k] * l[0] + cos_alpha * l[1];
+        block->y[linkage][k] = sin_a[k] * l[0] + sin_alpha * l[1];
+    }
+}
+
+/*
+    Compute the forward kinematics of up to HAPTIC_WAND_BATCH_SIZE samples, starting at the given
+    sample, one stage at a time.
+*/
+static void
+forward_kinematics_block(t_uint start, t_uint count, const double * const theta[NUM_JOINTS], double * const X[NUM_WORLD])
+{
+    const double offset = l[6] - l[3];  /* offset of each linkage plane from its axis of rotation */
+
+    double * const x = X[0] + start;
+    double * const y = X[1] + start;
+    double * const z = X[2] + start;
+    struct kinematics_block block;
+    t_uint joint, k;
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+        sincos_batch(count, theta[joint] + start, block.sines[joint], block.cosines[joint]);
+
+    solve_linkage_batch(count, 0, &block);
+    solve_linkage_batch(count, 1, &block);
+
+    for (k = 0; k < count; k++)
+    {
+        const double cos_4 = block.cosines[4][k], sin_4 = block.sines[4][k];
+        const double cos_5 = block.cosines[5][k], sin_5 = block.sines[5][k];
+        const double first_x  = block.x[0][k], first_y  = block.y[0][k];
+        const double second_x = block.x[1][k], second_y = block.y[1][k];
+        const double depth = l[5] + sin_4 * first_y + cos_4 * offset - sin_5 * second_y + cos_5 * offset;
+
+        block.roll[k]  = -(cos_4 * first_y - sin_4 * offset - cos_5 * second_y - sin_5 * offset) / depth;
+        block.pitch[k] = (first_x - second_x) / depth;
+
+        x[k] = (l[4] + second_x + first_x) / 2;
+        y[k] = (cos_5 * second_y + sin_5 * offset + cos_4 * first_y - sin_4 * offset) / 2;
+        z[k] = (sin_5 * second_y - cos_5 * offset + sin_4 * first_y + cos_4 * offset) / 2;
+    }
+
+    atan_batch(count, block.roll, X[3] + start);
+    atan_batch(count, block.pitch, X[4] + start);
+}
+
+void
+haptic_wand_forward_kinematics_batch(t_uint num_samples, const double * const theta[NUM_JOINTS], double * const X[NUM_WORLD])
+{
+    t_uint start;
+
+    for (start = 0; start < num_samples; start += HAPTIC_WAND_BATCH_SIZE)
+    {
+        const t_uint remaining = num_samples - start;
+        forward_kinematics_block(start, (remaining < HAPTIC_WAND_BATCH_SIZE) ? remaining : HAPTIC_WAND_BATCH_SIZE, theta, X);
+    }
+}
+
+/*
+    The share of a trajectory computed by one thread.
+*/
+struct batch_share
+{
+    t_uint         num_samples;
+    const double * theta[NUM_JOINTS];
+    double *       X[NUM_WORLD];
+};
+
+static void *
+batch_thread(void * argument)
+{
+    struct batch_share * share = (struct batch_share *) argument;
+
+    haptic_wand_forward_kinematics_batch(share->num_samples, share->theta, share->X);
+    return NULL;
+}
+
+t_error
+haptic_wand_forward_kinematics_parallel(t_uint num_samples, const double * const theta[NUM_JOINTS], double * const X[NUM_WORLD], t_uint num_threads)
+{
+    struct batch_share shares[HAPTIC_WAND_MAX_THREADS];
+    qthread_t threads[HAPTIC_WAND_MAX_THREADS];
+    t_boolean started[HAPTIC_WAND_MAX_THREADS];
+    t_error result = 0;
+    t_uint num_blocks, start, index, i;
+
+    /* Divide the samples in whole blocks, so that only the last share has a partial block */
+    num_blocks = (num_samples + HAPTIC_WAND_BATCH_SIZE - 1) / HAPTIC_WAND_BATCH_SIZE;
+    if (num_threads > num_blocks)
+        num_threads = num_blocks;
+    if (num_threads > HAPTIC_WAND_MAX_THREADS)
+        num_threads = HAPTIC_WAND_MAX_THREADS;
+    if (num_threads <= 1)
+    {
+        haptic_wand_forward_kinematics_batch(num_samples, theta, X);
+        return 0;
+    }
+
+    start = 0;
+    for (index = 0; index < num_threads; index++)
+    {
+        const t_uint blocks = num_blocks / num_threads + ((index < num_blocks % num_threads) ? 1 : 0);
+        const t_uint end    = start + blocks * HAPTIC_WAND_BATCH_SIZE;
+
+        shares[index].num_samples = ((end < num_samples) ? end : num_samples) - start;
+        for (i = 0; i < NUM_JOINTS; i++)
+            shares[index].theta[i] = theta[i] + start;
+        for (i = 0; i < NUM_WORLD; i++)
+            shares[index].X[i] = X[i] + start;
+
+        start += shares[index].num_samples;
+    }
+
+    /* The calling thread computes the first share while the others compute the rest */
+    for (index = 1; index < num_threads; index++)
+    {
+        const t_error error = qthread_create(&threads[index], NULL, batch_thread, &shares[index]);
+
+        started[index] = (error == 0);
+        if (error != 0)
+            result = error;
+    }
+
+    batch_thread(&shares[0]);
+
+    for (index = 1; index < num_threads; index++)
+    {
+        if (started[index])
+            qthread_join(threads[index], NULL);
+        else
+            batch_thread(&shares[index]);
+    }
+
+    return result;
+}
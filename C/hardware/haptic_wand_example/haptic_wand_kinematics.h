@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_kinematics.h - header file
+//
+// Kinematics of the Quanser 5DOF Haptic Wand, as used by the
+// haptic_wand_example.
+//
+// The wand is driven by two planar five-bar linkages. Joints 0 and 1
+// drive the first linkage, which joint 4 rotates about its own axis, and
+// joints 2 and 3 drive the second, which joint 5 rotates. The
+// expressions for the end-effector coordinates were generated by a
+// computer algebra system and written out in full, so every sine,
+// cosine, square root, arccosine and arctangent appeared dozens of
+// times in a single call. Here each term shared by the expressions is
+// computed once per call, working outwards from the joint angles: the
+// sine and cosine of each joint, then the end point of each linkage in
+// its own plane, and then the end-effector coordinates. The results
+// agree with the generated expressions to within 1e-12.
+//
+// The joint torques that produce a generalized force at the end-effector
+// are the product of the transpose of the Jacobian and the force. The
+// generated expressions wrote out every element of the Jacobian in full
+// as well. Here the Jacobian is formed from the derivatives of the end
+// point of each linkage, found by differentiating the linkage terms
+// above by the chain rule, so it costs little more than the forward
+// kinematics. A controller that needs both the coordinates and the
+// torques at each sampling instant calls haptic_wand_jacobian once and
+// passes the Jacobian to haptic_wand_joint_torques. A controller that
+// already has the sines and cosines of the joint angles, such as from
+// the tables of haptic_wand_trig_table.h, calls haptic_wand_jacobian_trig
+// instead, which computes no sines or cosines itself.
+//
+// Recorded trajectories are processed offline by
+// haptic_wand_forward_kinematics_batch, which takes the joint angles of
+// many samples as a structure of arrays and computes each stage of the
+// kinematics for a block of samples at a time. The angle of the distal
+// link of each linkage is only ever used through its sine and cosine,
+// which follow from the vector between the elbows and a square root, so
+// the batch form needs no arccosine or arctangent for the linkages.
+// The sines, cosines and the arctangents of the roll and pitch are
+// computed by polynomial kernels written as loops without branches, so
+// that the compiler vectorizes them across the samples of a block when
+// optimizing with the math library exceptions and errno disabled. The
+// Makefiles therefore compile this file with -O2 -ftree-vectorize
+// -fno-math-errno -fno-trapping-math, and the timings printed by the
+// haptic_wand_kinematics_performance example assume those options. The
+// Release configurations of the Visual Studio projects vectorize the
+// kernels without further options. The kernels are accurate to within
+// a unit in the last place.
+// haptic_wand_forward_kinematics_parallel divides a long trajectory
+// between threads.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_kinematics_h
+#define _haptic_wand_kinematics_h
+
+#include "quanser_types.h"
+
+#include "haptic_wand.h"
+
+#define HAPTIC_WAND_BATCH_SIZE      64  /* samples computed together by haptic_wand_forward_kinematics_batch */
+#define HAPTIC_WAND_MAX_THREADS     64  /* most threads used by haptic_wand_forward_kinematics_parallel */
+
+/*
+    Compute the end-effector position and orientation, X, from the joint angles, theta. X holds
+    the X, Y and Z coordinates in m followed by the roll (about X) and pitch (about Y) in radians.
+*/
+extern void
+haptic_wand_forward_kinematics(const double theta[NUM_JOINTS], double X[NUM_WORLD]);
+
+/*
+    Compute the end-effector position and orientation, X, and the Jacobian, J, of X with respect
+    to the joint angles, theta, sharing the terms common to both.
+*/
+extern void
+haptic_wand_jacobian(const double theta[NUM_JOINTS], double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS]);
+
+/*
+    Compute the end-effector position and orientation, X, and the Jacobian, J, as
+    haptic_wand_jacobian does, from the sines and cosines of the joint angles rather than the angles.
+*/
+extern void
+haptic_wand_jacobian_trig(const double sines[NUM_JOINTS], const double cosines[NUM_JOINTS],
+                          double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS]);
+
+/*
+    Compute the motor torques, tau, that produce the end-effector generalized forces, F, as the
+    product of the transpose of the Jacobian, J, and F.
+*/
+extern void
+haptic_wand_joint_torques(const double J[NUM_WORLD][NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS]);
+
+/*
+    Compute the motor torques, tau, from the end-effector generalized forces, F. Since this conversion
+    is configuration-dependent, the joint angles, theta, are required.
+*/
+extern void
+haptic_wand_inverse_force_kinematics(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS]);
+
+/*
+    Compute the end-effector positions and orientations of a number of samples at once. The joint
+    angles and the results are held as structures of arrays, so theta[i][k] is the angle of joint i
+    at sample k and X[i][k] is coordinate i of X at sample k. The results agree with
+    haptic_wand_forward_kinematics to within 1e-12 for joint angles below 1e6 radians.
+*/
+extern void
+haptic_wand_forward_kinematics_batch(t_uint num_samples, const double * const theta[NUM_JOINTS], double * const X[NUM_WORLD]);
+
+/*
+    Compute the end-effector positions and orientations of a number of samples as
+    haptic_wand_forward_kinematics_batch does, dividing the samples between the given number of
+    threads, including the calling thread. Returns 0 on success. If a thread cannot be created, its
+    samples are computed by the calling thread and the error code is returned, so the results are
+    complete either way.
+*/
+extern t_error
+haptic_wand_forward_kinematics_parallel(t_uint num_samples, const double * const theta[NUM_JOINTS], double * const X[NUM_WORLD], t_uint num_threads);
+
+#endif
@@ -0,0 +1,267 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_kinematics_float.c - C file
+//
+// Implements the single-precision haptic wand kinematics described in
+// haptic_wand_kinematics_float.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <math.h>
+
+#include "haptic_wand_kinematics_float.h"
+
+#define ROUNDING    12582912.0f     /* 1.5 * 2^23, which rounds any smaller value to an integer when added */
+
+static const float l[7] = { (float) L1, (float) L2, (float) L3, (float) L4, (float) L5, (float) L6, (float) L7 }; /* link lengths of the haptic wand links */
+
+/*
+    The terms shared by the kinematics of one five-bar linkage, driven by the joint angles
+    theta_a and theta_b.
+*/
+struct linkage
+{
+    float cos_a, sin_a;     /* cosine and sine of theta_a */
+    float cos_b, sin_b;     /* cosine and sine of theta_b */
+    float dx, dy;           /* vector from the elbow of link b to the elbow of link a */
+    float distance;         /* length of that vector */
+    float sin_acos;         /* sine of the elbow angle, acos(distance / l[1] / 2) */
+    float cos_alpha;        /* cosine of the angle of the distal link driven by link a */
+    float sin_alpha;        /* sine of that angle */
+    float x, y;             /* end point of the linkage in the plane of the linkage */
+
+    /* Derivatives of the end point with respect to theta_a and theta_b, filled in by differentiate_linkage */
+    float x_a, x_b;
+    float y_a, y_b;
+};
+
+/*
+    Compute the sine and cosine of an angle. The angle is reduced by the nearest multiple of pi/2,
+    in three parts so that the reduction is exact for angles below HAPTIC_WAND_FLOAT_MAX_ANGLE, and
+    the sine and cosine of the remainder are evaluated by the single-precision polynomials of
+    Cephes. The quadrant selects which of them is the sine and its sign.
+*/
+static void
+sincos_float(float angle, float * sine, float * cosine)
+{
+    const float q = (angle * 0.636619772367581f + ROUNDING) - ROUNDING;
+    const float r = ((angle - q * 1.5703125f) - q * 4.837512969970703125e-4f) - q * 7.54978995489188216e-8f;
+    const float z = r * r;
+
+    const float s = r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+    const float c = 1 - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+
+    switch ((int) q & 3)
+    {
+        case 0:  *sine =  s; *cosine =  c; break;
+        case 1:  *sine =  c; *cosine = -s; break;
+        case 2:  *sine = -s; *cosine = -c; break;
+        default: *sine = -c; *cosine =  s; break;
+    }
+}
+
+/*
+    Compute the arctangent of a value. The magnitude is reduced to below tan(pi/8) using
+    atan(x) = pi/2 - atan(1/x) above tan(3 pi/8) and atan(x) = pi/4 + atan((x - 1)/(x + 1)) above
+    tan(pi/8), and the arctangent of the remainder is evaluated by the single-precision polynomial
+    of Cephes.
+*/
+static float
+atan_float(float value)
+{
+    const float magnitude = fabsf(value);
+    float base, t, z, angle;
+
+    if (magnitude > 2.414213562373095f)
+    {
+        base = (float) (PI / 2);
+        t    = -1 / magnitude;
+    }
+    else if (magnitude > 0.4142135623730950f)
+    {
+        base = (float) (PI / 4);
+        t    = (magnitude - 1) / (magnitude + 1);
+    }
+    else
+    {
+        base = 0;
+        t    = magnitude;
+    }
+
+    z     = t * t;
+    angle = base + ((((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t);
+    return (value < 0) ? -angle : angle;
+}
+
+/*
+    Solve one five-bar linkage for the position of its end point. The angle of the distal link is
+    pi - acos(h) + atan(dy/dx), where h is half the distance between the elbows relative to the
+    length of the distal links, so its cosine and sine follow from the angle-sum identities with
+    cos(acos(h)) = h, sin(acos(h)) = sqrt(1 - h^2) and the cosine and sine of the arctangent given by
+    the vector between the elbows.
+*/
+static void
+solve_linkage(float theta_a, float theta_b, struct linkage * linkage)
+{
+    float cos_acos, cos_atan, sin_atan;
+
+    sincos_float(theta_a, &linkage->sin_a, &linkage->cos_a);
+    sincos_float(theta_b, &linkage->sin_b, &linkage->cos_b);
+
+    linkage->dx       = l[4] + linkage->cos_a * l[0] - linkage->cos_b * l[0];
+    linkage->dy       = linkage->sin_a * l[0] - linkage->sin_b * l[0];
+    linkage->distance = sqrtf(linkage->dx * linkage->dx + linkage->dy * linkage->dy);
+
+    cos_acos          = linkage->distance / l[1] / 2;
+    linkage->sin_acos = sqrtf(1 - cos_acos * cos_acos);
+    cos_atan          = fabsf(linkage->dx) / linkage->distance;
+    sin_atan          = ((linkage->dx < 0) ? -linkage->dy : linkage->dy) / linkage->distance;
+
+    linkage->cos_alpha = -(cos_acos * cos_atan + linkage->sin_acos * sin_atan);
+    linkage->sin_alpha = linkage->sin_acos * cos_atan - cos_acos * sin_atan;
+
+    linkage->x = linkage->cos_a * l[0] + linkage->cos_alpha * l[1];
+    linkage->y = linkage->sin_a * l[0] + linkage->sin_alpha * l[1];
+}
+
+/*
+    Differentiate the end point of a linkage solved by solve_linkage with respect to its two joint
+    angles, as the double-precision kinematics do.
+*/
+static void
+differentiate_linkage(struct linkage * linkage)
+{
+    const float acos_scale = 1 / (2 * l[1] * linkage->sin_acos);
+    const float squared    = linkage->distance * linkage->distance;
+
+    /* Derivatives of the vector between the elbows */
+    const float dx_a = -linkage->sin_a * l[0];
+    const float dx_b =  linkage->sin_b * l[0];
+    const float dy_a =  linkage->cos_a * l[0];
+    const float dy_b = -linkage->cos_b * l[0];
+
+    /* Derivatives of the angle of the distal link */
+    const float alpha_a = (linkage->dx * dx_a + linkage->dy * dy_a) / linkage->distance * acos_scale
+                        + (linkage->dx * dy_a - linkage->dy * dx_a) / squared;
+    const float alpha_b = (linkage->dx * dx_b + linkage->dy * dy_b) / linkage->distance * acos_scale
+                        + (linkage->dx * dy_b - linkage->dy * dx_b) / squared;
+
+    linkage->x_a = -linkage->sin_a * l[0] - linkage->sin_alpha * l[1] * alpha_a;
+    linkage->x_b = -linkage->sin_alpha * l[1] * alpha_b;
+    linkage->y_a =  linkage->cos_a * l[0] + linkage->cos_alpha * l[1] * alpha_a;
+    linkage->y_b =  linkage->cos_alpha * l[1] * alpha_b;
+}
+
+void
+haptic_wand_forward_kinematics_float(const float theta[NUM_JOINTS], float X[NUM_WORLD])
+{
+    const float offset = l[6] - l[3];   /* offset of each linkage plane from its axis of rotation */
+
+    struct linkage first, second;
+    float cos_4, sin_4, cos_5, sin_5;
+    float depth;
+
+    sincos_float(theta[4], &sin_4, &cos_4);
+    sincos_float(theta[5], &sin_5, &cos_5);
+    solve_linkage(theta[0], theta[1], &first);
+    solve_linkage(theta[2], theta[3], &second);
+
+    /* Distance between the end points of the two linkages along the length of the wand */
+    depth = l[5] + sin_4 * first.y + cos_4 * offset - sin_5 * second.y + cos_5 * offset;
+
+    X[0] = (l[4] + second.x + first.x) / 2;
+    X[1] = (cos_5 * second.y + sin_5 * offset + cos_4 * first.y - sin_4 * offset) / 2;
+    X[2] = (sin_5 * second.y - cos_5 * offset + sin_4 * first.y + cos_4 * offset) / 2;
+    X[3] = -atan_float((cos_4 * first.y - sin_4 * offset - cos_5 * second.y - sin_5 * offset) / depth);
+    X[4] = atan_float((first.x - second.x) / depth);
+}
+
+void
+haptic_wand_jacobian_float(const float theta[NUM_JOINTS], float X[NUM_WORLD], float J[NUM_WORLD][NUM_JOINTS])
+{
+    const float offset = l[6] - l[3];   /* offset of each linkage plane from its axis of rotation */
+
+    struct linkage first, second;
+    float cos_4, sin_4, cos_5, sin_5;
+    float roll, pitch, depth;
+    float roll_scale, pitch_scale;
+    float roll_4, roll_5, depth_4, depth_5;
+
+    sincos_float(theta[4], &sin_4, &cos_4);
+    sincos_float(theta[5], &sin_5, &cos_5);
+    solve_linkage(theta[0], theta[1], &first);
+    solve_linkage(theta[2], theta[3], &second);
+    differentiate_linkage(&first);
+    differentiate_linkage(&second);
+
+    /* The roll and pitch are the arctangents of roll / depth and pitch / depth */
+    roll  = cos_4 * first.y - sin_4 * offset - cos_5 * second.y - sin_5 * offset;
+    pitch = first.x - second.x;
+    depth = l[5] + sin_4 * first.y + cos_4 * offset - sin_5 * second.y + cos_5 * offset;
+
+    X[0] = (l[4] + second.x + first.x) / 2;
+    X[1] = (cos_5 * second.y + sin_5 * offset + cos_4 * first.y - sin_4 * offset) / 2;
+    X[2] = (sin_5 * second.y - cos_5 * offset + sin_4 * first.y + cos_4 * offset) / 2;
+    X[3] = -atan_float(roll / depth);
+    X[4] = atan_float(pitch / depth);
+
+    /* Derivatives of the roll and depth with respect to the rotation of each linkage plane */
+    roll_4  = -sin_4 * first.y - cos_4 * offset;
+    roll_5  =  sin_5 * second.y - cos_5 * offset;
+    depth_4 =  cos_4 * first.y - sin_4 * offset;
+    depth_5 = -cos_5 * second.y - sin_5 * offset;
+
+    /* The derivative of atan(n / d) is (d n' - n d') / (d^2 + n^2) */
+    roll_scale  = -1 / (depth * depth + roll * roll);
+    pitch_scale =  1 / (depth * depth + pitch * pitch);
+
+    J[0][0] = first.x_a / 2;
+    J[0][1] = first.x_b / 2;
+    J[0][2] = second.x_a / 2;
+    J[0][3] = second.x_b / 2;
+    J[0][4] = 0;
+    J[0][5] = 0;
+
+    J[1][0] = cos_4 * first.y_a / 2;
+    J[1][1] = cos_4 * first.y_b / 2;
+    J[1][2] = cos_5 * second.y_a / 2;
+    J[1][3] = cos_5 * second.y_b / 2;
+    J[1][4] = roll_4 / 2;
+    J[1][5] = (cos_5 * offset - sin_5 * second.y) / 2;
+
+    J[2][0] = sin_4 * first.y_a / 2;
+    J[2][1] = sin_4 * first.y_b / 2;
+    J[2][2] = sin_5 * second.y_a / 2;
+    J[2][3] = sin_5 * second.y_b / 2;
+    J[2][4] = depth_4 / 2;
+    J[2][5] = (cos_5 * second.y + sin_5 * offset) / 2;
+
+    J[3][0] = roll_scale * (depth * cos_4 * first.y_a - roll * sin_4 * first.y_a);
+    J[3][1] = roll_scale * (depth * cos_4 * first.y_b - roll * sin_4 * first.y_b);
+    J[3][2] = roll_scale * (-depth * cos_5 * second.y_a + roll * sin_5 * second.y_a);
+    J[3][3] = roll_scale * (-depth * cos_5 * second.y_b + roll * sin_5 * second.y_b);
+    J[3][4] = roll_scale * (depth * roll_4 - roll * depth_4);
+    J[3][5] = roll_scale * (depth * roll_5 - roll * depth_5);
+
+    J[4][0] = pitch_scale * (depth * first.x_a - pitch * sin_4 * first.y_a);
+    J[4][1] = pitch_scale * (depth * first.x_b - pitch * sin_4 * first.y_b);
+    J[4][2] = pitch_scale * (-depth * second.x_a + pitch * sin_5 * second.y_a);
+    J[4][3] = pitch_scale * (-depth * second.x_b + pitch * sin_5 * second.y_b);
+    J[4][4] = pitch_scale * (-pitch * depth_4);
+    J[4][5] = pitch_scale * (-pitch * depth_5);
+}
+
+void
+haptic_wand_joint_torques_float(const float J[NUM_WORLD][NUM_JOINTS], const float F[NUM_WORLD], float tau[NUM_JOINTS])
+{
+    int i, j;
+
+    for (j = 0; j < NUM_JOINTS; j++)
+    {
+        float sum = 0;
+        for (i = 0; i < NUM_WORLD; i++)
+            sum += J[i][j] * F[i];
+        tau[j] = sum;
+    }
+}
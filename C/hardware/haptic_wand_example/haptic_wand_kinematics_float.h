@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_kinematics_float.h - header file
+//
+// Single-precision kinematics of the Quanser 5DOF Haptic Wand, for
+// low-power targets on which double-precision arithmetic and the
+// transcendental functions of the math library take up most of the
+// sampling period. The haptic_wand_example uses them in place of the
+// kinematics of haptic_wand_kinematics.h when it is compiled with
+// HAPTIC_WAND_SINGLE_PRECISION defined.
+//
+// The terms are computed in the same order as by
+// haptic_wand_jacobian, but in single precision and without calling
+// the math library other than for square roots. The sines and cosines
+// of the joint angles are evaluated by polynomials after reducing each
+// angle by the nearest multiple of pi/2, the arctangents of the roll
+// and pitch by a polynomial after reducing the argument below
+// tan(pi/8), and the angle of the distal link of each linkage, which
+// is only ever used through its sine and cosine, needs neither an
+// arccosine nor an arctangent since those follow from the vector
+// between the elbows. The polynomials are accurate to within a few
+// units in the last place of a float, about 1e-7.
+//
+// The encoders resolve 2*pi/20000 radians, or about 3.1e-4 radians,
+// which moves the end-effector by up to about 5e-5 m. Across the
+// workspace the single-precision results, including the rounding of the
+// joint angles to single precision, differ from the double-precision
+// kinematics by no more than the bounds below, all far smaller than a
+// single count of the encoders. The roll and pitch are ratios over the
+// depth of the wand between its two linkages, so at the few poses where
+// the linkage planes are turned far enough apart to fold the wand, about
+// three in ten thousand of random poses spread across the workspace,
+// their errors grow to about 1e-4 radians, which is still less than a
+// count. Close to the singularities of a linkage, where the distal links
+// are nearly straight, the differences grow because the sine of the
+// elbow angle is found from 1 - h^2 with h close to one; the wand is not
+// operated there. The haptic_wand_kinematics_performance example checks
+// the bounds along its trajectory and against its golden outputs.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_kinematics_float_h
+#define _haptic_wand_kinematics_float_h
+
+#include "haptic_wand.h"
+
+#define HAPTIC_WAND_FLOAT_POSITION_ERROR    (2e-7f)     /* largest difference in the X, Y and Z coordinates in m */
+#define HAPTIC_WAND_FLOAT_ANGLE_ERROR       (5e-6f)     /* largest difference in the roll and pitch in radians */
+#define HAPTIC_WAND_FLOAT_JACOBIAN_ERROR    (1e-5f)     /* largest difference in the Jacobian, relative to its largest element in each row */
+#define HAPTIC_WAND_FLOAT_MAX_ANGLE         (8192.0f)   /* joint angles up to this magnitude in radians are reduced accurately */
+
+/*
+    Compute the end-effector position and orientation, X, from the joint angles, theta, in single
+    precision, as haptic_wand_forward_kinematics does in double precision.
+*/
+extern void
+haptic_wand_forward_kinematics_float(const float theta[NUM_JOINTS], float X[NUM_WORLD]);
+
+/*
+    Compute the end-effector position and orientation, X, and the Jacobian, J, of X with respect
+    to the joint angles, theta, in single precision, as haptic_wand_jacobian does in double precision.
+*/
+extern void
+haptic_wand_jacobian_float(const float theta[NUM_JOINTS], float X[NUM_WORLD], float J[NUM_WORLD][NUM_JOINTS]);
+
+/*
+    Compute the motor torques, tau, that produce the end-effector generalized forces, F, as the
+    product of the transpose of the Jacobian, J, and F, in single precision.
+*/
+extern void
+haptic_wand_joint_torques_float(const float J[NUM_WORLD][NUM_JOINTS], const float F[NUM_WORLD], float tau[NUM_JOINTS]);
+
+#endif
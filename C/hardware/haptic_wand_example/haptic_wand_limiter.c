@@ -0,0 +1,142 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_limiter.c - C file
+//
+// Implements the motor current limiter described in
+// haptic_wand_limiter.h.
+//
+// Copyright (C) 2008 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <math.h>
+
+#include "haptic_wand_limiter.h"
+
+t_int
+current_limiter_init(struct current_limiter * limiter, t_uint num_motors,
+                     const double peak_limit[], const double continuous_limit[],
+                     const double peak_time[], const double cooling_time[])
+{
+    if (num_motors > CURRENT_LIMITER_MAX_MOTORS)
+        return -1;
+
+    memset(limiter, 0, sizeof(*limiter));
+    limiter->num_motors = num_motors;
+
+    memcpy(limiter->peak_limit, peak_limit, num_motors * sizeof(double));
+    memcpy(limiter->continuous_limit, continuous_limit, num_motors * sizeof(double));
+    memcpy(limiter->peak_time, peak_time, num_motors * sizeof(double));
+    memcpy(limiter->cooling_time, cooling_time, num_motors * sizeof(double));
+
+    return 0;
+}
+
+void
+haptic_wand_current_limiter_init(struct current_limiter * limiter)
+{
+    static const double current_limit_1[NUM_JOINTS]  = {LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_LARGE,   LIMIT_1_LARGE};
+    static const double current_limit_2[NUM_JOINTS]  = {LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_LARGE,   LIMIT_2_LARGE};
+    static const double timeout_1[NUM_JOINTS]        = {TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_LARGE, TIMEOUT_1_LARGE};
+    static const double timeout_2[NUM_JOINTS]        = {TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_LARGE, TIMEOUT_2_LARGE};
+
+    current_limiter_init(limiter, NUM_JOINTS, current_limit_1, current_limit_2, timeout_1, timeout_2);
+}
+
+/*
+    Limit the magnitude of a current whose magnitude is value. The smaller of the limit and the
+    magnitude is taken with the sign of the current. A current at or below the limit, including a
+    NaN, is returned unchanged.
+*/
+static double
+clamp_current(double current, double value, double limit)
+{
+    return copysign((limit < value) ? limit : value, current);
+}
+
+void
+current_limiter_apply(struct current_limiter * limiter, double dt, double motor_currents[])
+{
+    const t_uint num_motors = limiter->num_motors;
+    t_uint index;
+
+    for (index = 0; index < num_motors; index++)
+    {
+        const double current          = motor_currents[index];
+        const double value            = fabs(current);
+        const double peak_limit       = limiter->peak_limit[index];
+        const double continuous_limit = limiter->continuous_limit[index];
+
+        switch (limiter->state[index])
+        {
+        case 0: /* Limiting to the peak limit and waiting for the current to exceed the continuous limit */
+            if (value > continuous_limit)
+            {
+                limiter->state[index] = 1;
+                limiter->time[index]  = 0;
+                limiter->count[index] = 0;
+                limiter->mean[index]  = value;
+                motor_currents[index] = clamp_current(current, value, peak_limit);
+            }
+            break;
+
+        case 1: /* Limiting to the peak limit and waiting for the peak time to expire */
+        {
+            const double time  = limiter->time[index] + dt;
+            const t_int  count = limiter->count[index] + 1;
+            const double sum   = limiter->mean[index] + value;
+
+            limiter->time[index]  = time;
+            limiter->count[index] = count;
+
+            if (time >= limiter->peak_time[index])
+            {
+                /* The sum only becomes a mean once the peak time expires, so the division is only done then */
+                const double mean = sum / (count + 1);
+
+                limiter->mean[index] = mean;
+                if (mean > continuous_limit)
+                {
+                    limiter->state[index] = 2;
+                    limiter->time[index]  = 0;
+                    limiter->count[index] = 0;
+                    motor_currents[index] = (current > 0) ? continuous_limit : -continuous_limit;
+                }
+                else
+                    limiter->state[index] = 0;
+            }
+            else
+            {
+                limiter->mean[index]  = sum;
+                motor_currents[index] = clamp_current(current, value, peak_limit);
+            }
+            break;
+        }
+
+        case 2: /* Limiting to the continuous limit and waiting for the motor to cool */
+        {
+            const double time = limiter->time[index] + dt;
+
+            limiter->time[index] = time;
+            limiter->count[index]++;
+
+            if (time >= limiter->cooling_time[index])
+            {
+                if (value > continuous_limit)
+                {
+                    limiter->state[index] = 1;
+                    limiter->time[index]  = 0;
+                    limiter->count[index] = 0;
+                    limiter->mean[index]  = value;
+                    motor_currents[index] = clamp_current(current, value, peak_limit);
+                }
+                else
+                    limiter->state[index] = 0;
+            }
+            else
+                motor_currents[index] = clamp_current(current, value, continuous_limit);
+            break;
+        }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_limiter.h - header file
+//
+// Limits the currents driving the motors of the Quanser 5DOF Haptic
+// Wand so that their thermal ratings are not exceeded, as used by the
+// haptic_wand_example.
+//
+// Each motor may draw up to its peak current for a short time. If the
+// mean current over that time exceeds the continuous rating, the motor
+// is held to the continuous rating until it has had time to cool.
+//
+// The limiter works for any number of motors up to
+// CURRENT_LIMITER_MAX_MOTORS, each with its own ratings, so it serves
+// other devices as well as the wand. The ratings and the state of the
+// motors are kept as a structure of arrays, so the ratings of all the
+// motors share a few cache lines rather than being scattered through
+// per-motor structures. Each motor is updated by a switch on its state,
+// as in the original state machine, so only the transitions of the
+// current state are evaluated and the mean current is only computed
+// when the peak time expires. The limited currents and the state of the
+// limiter are exactly the same as those of the original state machine,
+// and the haptic_wand_kinematics_performance example shows that it is
+// as fast.
+//
+// Copyright (C) 2008 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_limiter_h
+#define _haptic_wand_limiter_h
+
+#include "quanser_types.h"
+
+#include "haptic_wand.h"
+
+#define CURRENT_LIMITER_MAX_MOTORS  (16)    /* most motors handled by one current limiter */
+
+/*
+    The ratings and state of the current limiters of a number of motors. Each array holds one
+    element per motor. The states are 0 when below the continuous limit, 1 at the peak limit and 2
+    while cooling.
+*/
+struct current_limiter
+{
+    t_uint num_motors;
+
+    /* Ratings */
+    double peak_limit[CURRENT_LIMITER_MAX_MOTORS];          /* current that may be drawn for a short time in amps */
+    double continuous_limit[CURRENT_LIMITER_MAX_MOTORS];    /* current that may be drawn indefinitely in amps */
+    double peak_time[CURRENT_LIMITER_MAX_MOTORS];           /* longest time at the peak limit in seconds */
+    double cooling_time[CURRENT_LIMITER_MAX_MOTORS];        /* time held to the continuous limit to cool in seconds */
+
+    /* State */
+    double mean[CURRENT_LIMITER_MAX_MOTORS];    /* sum and then mean of the currents while at the peak limit */
+    double time[CURRENT_LIMITER_MAX_MOTORS];    /* time spent in the current state in seconds */
+    t_int  count[CURRENT_LIMITER_MAX_MOTORS];   /* samples spent in the current state */
+    t_int  state[CURRENT_LIMITER_MAX_MOTORS];   /* state of the limiter */
+};
+
+/*
+    Prepare the current limiters of the given number of motors, with the ratings of each motor.
+    Returns 0 on success and -1 if there are more than CURRENT_LIMITER_MAX_MOTORS motors.
+*/
+extern t_int
+current_limiter_init(struct current_limiter * limiter, t_uint num_motors,
+                     const double peak_limit[], const double continuous_limit[],
+                     const double peak_time[], const double cooling_time[]);
+
+/*
+    Prepare the current limiters of the motors of the haptic wand.
+*/
+extern void
+haptic_wand_current_limiter_init(struct current_limiter * limiter);
+
+/*
+    Limit the motor currents such that the thermal rating for the motors is not exceeded
+    while continuing to provide the peak torque when necessary. The currents are in amps and dt
+    is the time since the previous call in seconds.
+*/
+extern void
+current_limiter_apply(struct current_limiter * limiter, double dt, double motor_currents[]);
+
+#endif
@@ -0,0 +1,679 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_scene.c - C file
+//
+// Implements the haptic scene described in haptic_wand_scene.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "haptic_wand_scene.h"
+
+/*
+    A point of contact between the end-effector and an object.
+*/
+struct contact
+{
+    t_uint32 object;        /* index of the object touched */
+    double   depth;         /* depth of penetration in m */
+    double   normal[3];     /* outward unit normal of the surface */
+};
+
+static double
+dot(const double a[3], const double b[3])
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+t_int
+haptic_scene_create(struct haptic_scene * scene, t_uint32 max_objects, t_uint32 max_primitives, t_uint32 max_planes)
+{
+    memset(scene, 0, sizeof(*scene));
+
+    scene->objects    = (struct haptic_object *) malloc((max_objects > 0 ? max_objects : 1) * sizeof(struct haptic_object));
+    scene->primitives = (struct haptic_primitive *) malloc((max_primitives > 0 ? max_primitives : 1) * sizeof(struct haptic_primitive));
+    scene->planes     = (struct haptic_primitive *) malloc((max_planes > 0 ? max_planes : 1) * sizeof(struct haptic_primitive));
+    if (scene->objects == NULL || scene->primitives == NULL || scene->planes == NULL)
+    {
+        haptic_scene_destroy(scene);
+        return -1;
+    }
+
+    scene->max_objects    = max_objects;
+    scene->max_primitives = max_primitives;
+    scene->max_planes     = max_planes;
+    return 0;
+}
+
+void
+haptic_scene_destroy(struct haptic_scene * scene)
+{
+    free(scene->objects);
+    free(scene->primitives);
+    free(scene->planes);
+    free(scene->nodes);
+
+    scene->objects    = NULL;
+    scene->primitives = NULL;
+    scene->planes     = NULL;
+    scene->nodes      = NULL;
+}
+
+/*
+    Add an object with the given material, returning its index, or -1 if there is no room for it
+    or the hierarchy has already been built.
+*/
+static t_int
+add_object(struct haptic_scene * scene, double stiffness, double damping)
+{
+    struct haptic_object * object;
+
+    if (scene->nodes != NULL || scene->num_objects >= scene->max_objects)
+        return -1;
+
+    object = &scene->objects[scene->num_objects];
+    object->stiffness = stiffness;
+    object->damping   = damping;
+    return (t_int) scene->num_objects++;
+}
+
+t_int
+haptic_scene_add_plane(struct haptic_scene * scene, const double point[3], const double normal[3],
+                       double stiffness, double damping)
+{
+    const double length = sqrt(dot(normal, normal));
+
+    struct haptic_primitive * plane;
+    t_int object;
+    int i;
+
+    if (length == 0 || scene->num_planes >= scene->max_planes)
+        return -1;
+
+    object = add_object(scene, stiffness, damping);
+    if (object < 0)
+        return -1;
+
+    plane = &scene->planes[scene->num_planes++];
+    memset(plane, 0, sizeof(*plane));
+    plane->type   = HAPTIC_PRIMITIVE_PLANE;
+    plane->object = (t_uint32) object;
+    for (i = 0; i < 3; i++)
+        plane->shape.plane.normal[i] = normal[i] / length;
+    plane->shape.plane.offset = dot(plane->shape.plane.normal, point);
+    return 0;
+}
+
+t_int
+haptic_scene_add_sphere(struct haptic_scene * scene, const double center[3], double radius,
+                        double stiffness, double damping)
+{
+    struct haptic_primitive * sphere;
+    t_int object;
+    int i;
+
+    if (!(radius > 0) || scene->num_primitives >= scene->max_primitives)
+        return -1;
+
+    object = add_object(scene, stiffness, damping);
+    if (object < 0)
+        return -1;
+
+    sphere = &scene->primitives[scene->num_primitives++];
+    sphere->type   = HAPTIC_PRIMITIVE_SPHERE;
+    sphere->object = (t_uint32) object;
+    for (i = 0; i < 3; i++)
+    {
+        sphere->shape.sphere.center[i] = center[i];
+        sphere->minimum[i] = center[i] - radius;
+        sphere->maximum[i] = center[i] + radius;
+    }
+    sphere->shape.sphere.radius = radius;
+    return 0;
+}
+
+t_int
+haptic_scene_add_box(struct haptic_scene * scene, const double minimum[3], const double maximum[3],
+                     double stiffness, double damping)
+{
+    struct haptic_primitive * box;
+    t_int object;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        if (!(maximum[i] > minimum[i]))
+            return -1;
+    }
+
+    if (scene->num_primitives >= scene->max_primitives)
+        return -1;
+
+    object = add_object(scene, stiffness, damping);
+    if (object < 0)
+        return -1;
+
+    box = &scene->primitives[scene->num_primitives++];
+    box->type   = HAPTIC_PRIMITIVE_BOX;
+    box->object = (t_uint32) object;
+    for (i = 0; i < 3; i++)
+    {
+        box->shape.box.minimum[i] = box->minimum[i] = minimum[i];
+        box->shape.box.maximum[i] = box->maximum[i] = maximum[i];
+    }
+    return 0;
+}
+
+/*
+    Set up a triangle from its vertices. Returns 0 on success and -1 if the triangle is degenerate.
+*/
+static t_int
+make_triangle(struct haptic_primitive * triangle, const double a[3], const double b[3], const double c[3], double thickness)
+{
+    double * const e0 = triangle->shape.triangle.edges[0];
+    double * const e1 = triangle->shape.triangle.edges[1];
+    double * const n  = triangle->shape.triangle.normal;
+    double length, determinant;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        triangle->shape.triangle.vertex[i] = a[i];
+        e0[i] = b[i] - a[i];
+        e1[i] = c[i] - a[i];
+    }
+
+    n[0] = e0[1]*e1[2] - e0[2]*e1[1];
+    n[1] = e0[2]*e1[0] - e0[0]*e1[2];
+    n[2] = e0[0]*e1[1] - e0[1]*e1[0];
+
+    length = sqrt(dot(n, n));
+    if (length == 0)
+        return -1;
+
+    for (i = 0; i < 3; i++)
+        n[i] /= length;
+
+    /* The barycentric coordinates of a point follow from its dot products with the edges */
+    triangle->shape.triangle.dots[0] = dot(e0, e0);
+    triangle->shape.triangle.dots[1] = dot(e0, e1);
+    triangle->shape.triangle.dots[2] = dot(e1, e1);
+
+    determinant = triangle->shape.triangle.dots[0] * triangle->shape.triangle.dots[2]
+                - triangle->shape.triangle.dots[1] * triangle->shape.triangle.dots[1];
+    if (determinant == 0)
+        return -1;
+
+    triangle->shape.triangle.inverse   = 1 / determinant;
+    triangle->shape.triangle.thickness = thickness;
+
+    /* The bounds enclose the shell behind the triangle, whichever way it faces */
+    for (i = 0; i < 3; i++)
+    {
+        const double lowest  = (a[i] < b[i]) ? ((a[i] < c[i]) ? a[i] : c[i]) : ((b[i] < c[i]) ? b[i] : c[i]);
+        const double highest = (a[i] > b[i]) ? ((a[i] > c[i]) ? a[i] : c[i]) : ((b[i] > c[i]) ? b[i] : c[i]);
+
+        triangle->minimum[i] = lowest  - thickness;
+        triangle->maximum[i] = highest + thickness;
+    }
+
+    triangle->type = HAPTIC_PRIMITIVE_TRIANGLE;
+    return 0;
+}
+
+t_int
+haptic_scene_add_mesh(struct haptic_scene * scene, t_uint32 num_vertices, const double vertices[][3],
+                      t_uint32 num_triangles, const t_uint32 triangles[][3], double thickness,
+                      double stiffness, double damping)
+{
+    t_uint32 i;
+    t_int object;
+
+    if (!(thickness > 0) || num_triangles > scene->max_primitives - scene->num_primitives)
+        return -1;
+
+    for (i = 0; i < num_triangles; i++)
+    {
+        if (triangles[i][0] >= num_vertices || triangles[i][1] >= num_vertices || triangles[i][2] >= num_vertices)
+            return -1;
+    }
+
+    object = add_object(scene, stiffness, damping);
+    if (object < 0)
+        return -1;
+
+    for (i = 0; i < num_triangles; i++)
+    {
+        struct haptic_primitive * triangle = &scene->primitives[scene->num_primitives];
+
+        if (make_triangle(triangle, vertices[triangles[i][0]], vertices[triangles[i][1]], vertices[triangles[i][2]], thickness) == 0)
+        {
+            triangle->object = (t_uint32) object;
+            scene->num_primitives++;
+        }
+    }
+
+    return 0;
+}
+
+/*
+    Twice the centre of the bounds of a primitive along an axis.
+*/
+static double
+centroid(const struct haptic_primitive * primitive, int axis)
+{
+    return primitive->minimum[axis] + primitive->maximum[axis];
+}
+
+/*
+    Reorder the primitives so that the one at index k is where it would be if they were sorted by
+    the centres of their bounds along the axis, with none before it further along and none after
+    it less far along.
+*/
+static void
+select_median(struct haptic_primitive * primitives, t_int count, t_int k, int axis)
+{
+    t_int left  = 0;
+    t_int right = count - 1;
+
+    while (left < right)
+    {
+        const double pivot = centroid(&primitives[left + (right - left) / 2], axis);
+        t_int i = left;
+        t_int j = right;
+
+        while (i <= j)
+        {
+            while (centroid(&primitives[i], axis) < pivot)
+                i++;
+            while (centroid(&primitives[j], axis) > pivot)
+                j--;
+
+            if (i <= j)
+            {
+                struct haptic_primitive swap = primitives[i];
+                primitives[i] = primitives[j];
+                primitives[j] = swap;
+                i++;
+                j--;
+            }
+        }
+
+        if (k <= j)
+            right = j;
+        else if (k >= i)
+            left = i;
+        else
+            break;
+    }
+}
+
+/*
+    Build the node at the given index over a range of the primitives, splitting the range at the
+    median of the centres along the axis in which they are most spread out. Returns the index of
+    the next free node.
+*/
+static t_uint32
+build_node(struct haptic_scene * scene, t_uint32 index, t_uint32 first, t_uint32 count, t_uint32 depth)
+{
+    struct haptic_node * node = &scene->nodes[index];
+    double lowest[3], highest[3];
+    t_uint32 half, next, i;
+    int axis, j;
+
+    for (j = 0; j < 3; j++)
+    {
+        node->minimum[j] = scene->primitives[first].minimum[j];
+        node->maximum[j] = scene->primitives[first].maximum[j];
+        lowest[j] = highest[j] = centroid(&scene->primitives[first], j);
+    }
+
+    for (i = first + 1; i < first + count; i++)
+    {
+        const struct haptic_primitive * primitive = &scene->primitives[i];
+        for (j = 0; j < 3; j++)
+        {
+            const double center = centroid(primitive, j);
+
+            if (primitive->minimum[j] < node->minimum[j])
+                node->minimum[j] = primitive->minimum[j];
+            if (primitive->maximum[j] > node->maximum[j])
+                node->maximum[j] = primitive->maximum[j];
+            if (center < lowest[j])
+                lowest[j] = center;
+            if (center > highest[j])
+                highest[j] = center;
+        }
+    }
+
+    axis = 0;
+    for (j = 1; j < 3; j++)
+    {
+        if (highest[j] - lowest[j] > highest[axis] - lowest[axis])
+            axis = j;
+    }
+
+    /* The depth is bounded so that searching the hierarchy never overflows its stack */
+    if (count <= HAPTIC_SCENE_LEAF_SIZE || highest[axis] == lowest[axis] || depth + 2 >= HAPTIC_SCENE_MAX_DEPTH)
+    {
+        node->first = first;
+        node->count = count;
+        return index + 1;
+    }
+
+    half = count / 2;
+    select_median(scene->primitives + first, (t_int) count, (t_int) half, axis);
+
+    next = build_node(scene, index + 1, first, half, depth + 1);
+    node = &scene->nodes[index];
+    node->first = next;
+    node->count = 0;
+    return build_node(scene, next, first + half, count - half, depth + 1);
+}
+
+t_int
+haptic_scene_build(struct haptic_scene * scene)
+{
+    if (scene->nodes != NULL)
+        return -1;
+
+    /* A binary tree with a leaf per primitive has fewer than twice as many nodes as primitives */
+    scene->nodes = (struct haptic_node *) malloc(((scene->num_primitives > 0) ? 2 * scene->num_primitives : 1) * sizeof(struct haptic_node));
+    if (scene->nodes == NULL)
+        return -1;
+
+    scene->num_nodes   = (scene->num_primitives > 0) ? build_node(scene, 0, 0, scene->num_primitives, 0) : 0;
+    scene->cache_valid = false;
+    return 0;
+}
+
+static t_boolean
+overlaps(const double minimum[3], const double maximum[3], const double lower[3], const double upper[3])
+{
+    return minimum[0] <= upper[0] && maximum[0] >= lower[0]
+        && minimum[1] <= upper[1] && maximum[1] >= lower[1]
+        && minimum[2] <= upper[2] && maximum[2] >= lower[2];
+}
+
+/*
+    Find the primitives whose bounds overlap the box from lower to upper, storing the indices of
+    up to capacity of them. Returns the number found, which may exceed the capacity.
+*/
+static t_uint32
+gather(const struct haptic_scene * scene, const double lower[3], const double upper[3], t_uint32 * indices, t_uint32 capacity)
+{
+    t_uint32 stack[HAPTIC_SCENE_MAX_DEPTH];
+    t_uint32 top   = 0;
+    t_uint32 found = 0;
+
+    if (scene->num_nodes == 0)
+        return 0;
+
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        const t_uint32 index = stack[--top];
+        const struct haptic_node * node = &scene->nodes[index];
+
+        if (!overlaps(node->minimum, node->maximum, lower, upper))
+            continue;
+
+        if (node->count > 0)
+        {
+            t_uint32 i;
+            for (i = node->first; i < node->first + node->count; i++)
+            {
+                if (overlaps(scene->primitives[i].minimum, scene->primitives[i].maximum, lower, upper))
+                {
+                    if (found < capacity)
+                        indices[found] = i;
+                    found++;
+                }
+            }
+        }
+        else
+        {
+            stack[top++] = node->first;
+            stack[top++] = index + 1;
+        }
+    }
+
+    return found;
+}
+
+/*
+    Find the depth to which the point has penetrated the primitive and the outward normal of the
+    surface through which it should be pushed out. Returns the depth, or zero if the point is
+    outside the primitive.
+*/
+static double
+penetration(const struct haptic_primitive * primitive, const double point[3], double normal[3])
+{
+    double offset[3];
+    int i;
+
+    switch (primitive->type)
+    {
+        case HAPTIC_PRIMITIVE_PLANE:
+        {
+            const double height = dot(primitive->shape.plane.normal, point) - primitive->shape.plane.offset;
+            if (height >= 0)
+                return 0;
+
+            for (i = 0; i < 3; i++)
+                normal[i] = primitive->shape.plane.normal[i];
+            return -height;
+        }
+
+        case HAPTIC_PRIMITIVE_SPHERE:
+        {
+            const double radius = primitive->shape.sphere.radius;
+            double distance;
+
+            for (i = 0; i < 3; i++)
+                offset[i] = point[i] - primitive->shape.sphere.center[i];
+
+            distance = dot(offset, offset);
+            if (distance >= radius * radius)
+                return 0;
+
+            distance = sqrt(distance);
+            for (i = 0; i < 3; i++)
+                normal[i] = (distance > 0) ? offset[i] / distance : (i == 2);
+            return radius - distance;
+        }
+
+        case HAPTIC_PRIMITIVE_BOX:
+        {
+            double depth = 0;
+            int    face  = 0;
+
+            /* Push the point out through the nearest face */
+            for (i = 0; i < 3; i++)
+            {
+                const double below = point[i] - primitive->shape.box.minimum[i];
+                const double above = primitive->shape.box.maximum[i] - point[i];
+
+                if (below <= 0 || above <= 0)
+                    return 0;
+
+                if (i == 0 || below < depth)
+                {
+                    depth = below;
+                    face  = -(i + 1);
+                }
+                if (above < depth)
+                {
+                    depth = above;
+                    face  = i + 1;
+                }
+            }
+
+            normal[0] = normal[1] = normal[2] = 0;
+            normal[abs(face) - 1] = (face > 0) ? 1 : -1;
+            return depth;
+        }
+
+        case HAPTIC_PRIMITIVE_TRIANGLE:
+        {
+            const double * dots = primitive->shape.triangle.dots;
+            double height, u, v, along[2];
+
+            for (i = 0; i < 3; i++)
+                offset[i] = point[i] - primitive->shape.triangle.vertex[i];
+
+            height = dot(offset, primitive->shape.triangle.normal);
+            if (height >= 0 || height <= -primitive->shape.triangle.thickness)
+                return 0;
+
+            /* The normal component of the offset is orthogonal to the edges, so it does not affect the barycentric coordinates */
+            along[0] = dot(offset, primitive->shape.triangle.edges[0]);
+            along[1] = dot(offset, primitive->shape.triangle.edges[1]);
+            u = (dots[2] * along[0] - dots[1] * along[1]) * primitive->shape.triangle.inverse;
+            v = (dots[0] * along[1] - dots[1] * along[0]) * primitive->shape.triangle.inverse;
+            if (u < 0 || v < 0 || u + v > 1)
+                return 0;
+
+            for (i = 0; i < 3; i++)
+                normal[i] = primitive->shape.triangle.normal[i];
+            return -height;
+        }
+    }
+
+    return 0;
+}
+
+/*
+    Test the point against a primitive, keeping only the shallowest contact with each object, which
+    is the surface of the object nearest the point.
+*/
+static void
+touch(const struct haptic_primitive * primitive, const double point[3], struct contact * contacts, t_uint32 * num_contacts)
+{
+    double normal[3];
+    double depth = penetration(primitive, point, normal);
+    struct contact * contact;
+    t_uint32 i;
+
+    if (depth <= 0)
+        return;
+
+    for (i = 0; i < *num_contacts; i++)
+    {
+        if (contacts[i].object == primitive->object)
+            break;
+    }
+
+    if (i == *num_contacts)
+    {
+        if (*num_contacts >= HAPTIC_SCENE_MAX_CONTACTS)
+            return;
+        (*num_contacts)++;
+    }
+    else if (contacts[i].depth <= depth)
+        return;
+
+    contact = &contacts[i];
+    contact->object    = primitive->object;
+    contact->depth     = depth;
+    contact->normal[0] = normal[0];
+    contact->normal[1] = normal[1];
+    contact->normal[2] = normal[2];
+}
+
+/*
+    Sum the forces of the contacts found at a sample.
+*/
+static void
+push_out(const struct haptic_scene * scene, const struct contact * contacts, t_uint32 num_contacts,
+         const double velocity[3], double force[3])
+{
+    t_uint32 i;
+
+    force[0] = force[1] = force[2] = 0;
+
+    /* Push the end-effector out of each object, damping its motion into the object but never pulling it in */
+    for (i = 0; i < num_contacts; i++)
+    {
+        const struct haptic_object * object = &scene->objects[contacts[i].object];
+        double magnitude = object->stiffness * contacts[i].depth;
+
+        if (velocity != NULL)
+            magnitude -= object->damping * dot(velocity, contacts[i].normal);
+        if (magnitude > 0)
+        {
+            force[0] += magnitude * contacts[i].normal[0];
+            force[1] += magnitude * contacts[i].normal[1];
+            force[2] += magnitude * contacts[i].normal[2];
+        }
+    }
+}
+
+void
+haptic_scene_render(struct haptic_scene * scene, const double position[3], const double velocity[3], double force[3])
+{
+    struct contact contacts[HAPTIC_SCENE_MAX_CONTACTS];
+    t_uint32 num_contacts = 0;
+    t_uint32 i;
+
+    scene->renders++;
+
+    /*
+        Any primitive whose bounds contain the end-effector also lies within the margin of the
+        position at which the cache was filled, as long as the end-effector has not moved further
+        than the margin along any axis, so until then the cached primitives are the only ones that
+        can be touched. If too many lie within the margin to cache, only those whose bounds contain
+        the end-effector are gathered, and the hierarchy is searched again at the next sample.
+    */
+    if (!scene->cache_valid
+        || fabs(position[0] - scene->cache_center[0]) > HAPTIC_SCENE_MARGIN
+        || fabs(position[1] - scene->cache_center[1]) > HAPTIC_SCENE_MARGIN
+        || fabs(position[2] - scene->cache_center[2]) > HAPTIC_SCENE_MARGIN)
+    {
+        double lower[3], upper[3];
+        t_uint32 found;
+
+        for (i = 0; i < 3; i++)
+        {
+            lower[i] = position[i] - HAPTIC_SCENE_MARGIN;
+            upper[i] = position[i] + HAPTIC_SCENE_MARGIN;
+        }
+
+        found = gather(scene, lower, upper, scene->cache, HAPTIC_SCENE_CACHE_SIZE);
+        scene->cache_valid = (found <= HAPTIC_SCENE_CACHE_SIZE);
+        if (!scene->cache_valid)
+            found = gather(scene, position, position, scene->cache, HAPTIC_SCENE_CACHE_SIZE);
+
+        scene->num_cached      = (found < HAPTIC_SCENE_CACHE_SIZE) ? found : HAPTIC_SCENE_CACHE_SIZE;
+        scene->cache_center[0] = position[0];
+        scene->cache_center[1] = position[1];
+        scene->cache_center[2] = position[2];
+        scene->refreshes++;
+    }
+
+    for (i = 0; i < scene->num_cached; i++)
+        touch(&scene->primitives[scene->cache[i]], position, contacts, &num_contacts);
+    for (i = 0; i < scene->num_planes; i++)
+        touch(&scene->planes[i], position, contacts, &num_contacts);
+
+    push_out(scene, contacts, num_contacts, velocity, force);
+}
+
+void
+haptic_scene_render_exhaustive(const struct haptic_scene * scene, const double position[3], const double velocity[3], double force[3])
+{
+    struct contact contacts[HAPTIC_SCENE_MAX_CONTACTS];
+    t_uint32 num_contacts = 0;
+    t_uint32 i;
+
+    for (i = 0; i < scene->num_primitives; i++)
+        touch(&scene->primitives[i], position, contacts, &num_contacts);
+    for (i = 0; i < scene->num_planes; i++)
+        touch(&scene->planes[i], position, contacts, &num_contacts);
+
+    push_out(scene, contacts, num_contacts, velocity, force);
+}
@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_scene.h - header file
+//
+// Renders the forces of a virtual scene at the end-effector of the
+// Quanser 5DOF Haptic Wand, as used by the haptic_wand_example.
+//
+// A scene holds planes, spheres, axis-aligned boxes and triangle
+// meshes, each object with its own stiffness and damping. The
+// end-effector is treated as a point. Wherever it has penetrated an
+// object, the object pushes it back out along the surface normal with
+// a spring and damper acting on the depth of penetration. Planes are
+// solid half-spaces, spheres and boxes are solid, and each triangle of
+// a mesh is a one-sided surface with a thin solid shell behind it, so
+// the point is pushed out through the front of the nearest triangle.
+// Each object contributes only its contact nearest the surface, so the
+// point does not feel twice the force where two triangles of a mesh
+// meet.
+//
+// The scene is built once before the controller starts. Building it
+// allocates all the memory it needs and arranges every bounded
+// primitive in a bounding volume hierarchy, so the primitives near the
+// end-effector are found in time that grows with the logarithm of
+// their number. Since the end-effector moves little from one sample to
+// the next, the primitives whose bounds lie within a small margin of
+// the end-effector are gathered into a cache, and the hierarchy is
+// only searched again once the end-effector leaves that margin. In
+// between, rendering only tests the handful of cached primitives.
+// Rendering never allocates memory.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_scene_h
+#define _haptic_wand_scene_h
+
+#include "quanser_types.h"
+
+#define HAPTIC_SCENE_CACHE_SIZE     (256)       /* most primitives held in the contact cache */
+#define HAPTIC_SCENE_MAX_CONTACTS   (32)        /* most objects touched at once */
+#define HAPTIC_SCENE_MARGIN         (0.005)     /* distance the end-effector may move before the cache is refreshed, in m */
+#define HAPTIC_SCENE_LEAF_SIZE      (4)         /* most primitives in a leaf of the hierarchy */
+#define HAPTIC_SCENE_MAX_DEPTH      (64)        /* deepest hierarchy that can be searched */
+
+/*
+    The kinds of primitive held by a scene.
+*/
+enum haptic_primitive_type
+{
+    HAPTIC_PRIMITIVE_PLANE,
+    HAPTIC_PRIMITIVE_SPHERE,
+    HAPTIC_PRIMITIVE_BOX,
+    HAPTIC_PRIMITIVE_TRIANGLE
+};
+
+/*
+    One primitive of the scene. Planes are unbounded, so they are kept apart from the hierarchy
+    and tested at every sample.
+*/
+struct haptic_primitive
+{
+    t_uint32 type;                  /* one of the haptic_primitive_type values */
+    t_uint32 object;                /* index of the object to which the primitive belongs */
+    double   minimum[3];            /* lower corner of the bounds of the primitive */
+    double   maximum[3];            /* upper corner of the bounds of the primitive */
+
+    union
+    {
+        struct
+        {
+            double normal[3];       /* outward unit normal */
+            double offset;          /* the plane holds the points whose dot product with the normal is the offset */
+        } plane;
+
+        struct
+        {
+            double center[3];
+            double radius;
+        } sphere;
+
+        struct
+        {
+            double minimum[3];
+            double maximum[3];
+        } box;
+
+        struct
+        {
+            double vertex[3];       /* first vertex */
+            double edges[2][3];     /* second and third vertices less the first */
+            double normal[3];       /* outward unit normal, following the right-hand rule around the vertices */
+            double dots[3];         /* dot products of the edges with themselves and each other */
+            double inverse;         /* reciprocal of the determinant of the dot products */
+            double thickness;       /* depth of the solid shell behind the triangle */
+        } triangle;
+    } shape;
+};
+
+/*
+    The material of one object of the scene.
+*/
+struct haptic_object
+{
+    double stiffness;               /* force per unit depth of penetration in N/m */
+    double damping;                 /* force per unit velocity into the object in N-s/m */
+};
+
+/*
+    A node of the bounding volume hierarchy. A leaf holds a range of the primitives, and an inner
+    node holds two children, the first of which immediately follows it.
+*/
+struct haptic_node
+{
+    double   minimum[3];            /* lower corner of the bounds of everything below the node */
+    double   maximum[3];            /* upper corner of the bounds of everything below the node */
+    t_uint32 first;                 /* index of the first primitive of a leaf, or of the second child of an inner node */
+    t_uint32 count;                 /* number of primitives in a leaf, or zero for an inner node */
+};
+
+struct haptic_scene
+{
+    struct haptic_object    * objects;
+    struct haptic_primitive * primitives;       /* bounded primitives first, ordered by the hierarchy, once built */
+    struct haptic_primitive * planes;
+    struct haptic_node      * nodes;
+    t_uint32 num_objects,    max_objects;
+    t_uint32 num_primitives, max_primitives;
+    t_uint32 num_planes,     max_planes;
+    t_uint32 num_nodes;
+
+    /* Contact cache */
+    double    cache_center[3];                          /* position of the end-effector when the cache was filled */
+    t_uint32  cache[HAPTIC_SCENE_CACHE_SIZE];           /* primitives whose bounds lie within the margin of that position */
+    t_uint32  num_cached;
+    t_boolean cache_valid;
+
+    /* Statistics */
+    t_uint64  renders;                                  /* calls to haptic_scene_render */
+    t_uint64  refreshes;                                /* times the hierarchy was searched */
+};
+
+/*
+    Allocate an empty scene with room for the given numbers of objects, bounded primitives (each
+    sphere, box and triangle is one primitive) and planes. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+haptic_scene_create(struct haptic_scene * scene, t_uint32 max_objects, t_uint32 max_primitives, t_uint32 max_planes);
+
+/*
+    Free the memory of the scene.
+*/
+extern void
+haptic_scene_destroy(struct haptic_scene * scene);
+
+/*
+    Add a solid half-space bounded by the plane through the point with the given outward normal,
+    which need not be of unit length. Returns 0 on success and -1 if the scene is full or the normal
+    is zero.
+*/
+extern t_int
+haptic_scene_add_plane(struct haptic_scene * scene, const double point[3], const double normal[3],
+                       double stiffness, double damping);
+
+/*
+    Add a solid sphere. Returns 0 on success and -1 if the scene is full or the radius is not
+    positive.
+*/
+extern t_int
+haptic_scene_add_sphere(struct haptic_scene * scene, const double center[3], double radius,
+                        double stiffness, double damping);
+
+/*
+    Add a solid box aligned with the world axes, given by its lower and upper corners. Returns 0 on
+    success and -1 if the scene is full or the box is empty.
+*/
+extern t_int
+haptic_scene_add_box(struct haptic_scene * scene, const double minimum[3], const double maximum[3],
+                     double stiffness, double damping);
+
+/*
+    Add a mesh of triangles. Each triangle is given by three indices into the vertices, ordered
+    anticlockwise when seen from outside. The end-effector is pushed out of a triangle when it lies
+    behind it by less than the thickness, which should exceed the deepest penetration expected. For
+    a closed mesh the thickness may be as large as the mesh itself.
+    Degenerate triangles are ignored. Returns 0 on success and -1 if the scene is full or an index
+    is out of range.
+*/
+extern t_int
+haptic_scene_add_mesh(struct haptic_scene * scene, t_uint32 num_vertices, const double vertices[][3],
+                      t_uint32 num_triangles, const t_uint32 triangles[][3], double thickness,
+                      double stiffness, double damping);
+
+/*
+    Build the bounding volume hierarchy once every object has been added. Objects may not be added
+    afterwards. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+haptic_scene_build(struct haptic_scene * scene);
+
+/*
+    Compute the force in N on the end-effector at the given position in m moving with the given
+    velocity in m/s. The velocity may be NULL, in which case no damping is applied.
+*/
+extern void
+haptic_scene_render(struct haptic_scene * scene, const double position[3], const double velocity[3], double force[3]);
+
+/*
+    Compute the same force as haptic_scene_render by testing every primitive of the scene, without
+    the hierarchy or the cache. The time taken grows with the number of primitives, so it is meant
+    for checking haptic_scene_render rather than for rendering. The force may differ from that of
+    haptic_scene_render in the last place, since the contacts may be summed in a different order.
+*/
+extern void
+haptic_scene_render_exhaustive(const struct haptic_scene * scene, const double position[3], const double velocity[3], double force[3]);
+
+#endif
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_trig_table.c - C file
+//
+// Implements the tables of joint sines and cosines described in
+// haptic_wand_trig_table.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "haptic_wand_trig_table.h"
+
+#define COUNT_FACTOR    (2 * PI / HAPTIC_WAND_COUNTS_PER_REVOLUTION)    /* radians per encoder count */
+#define QUARTER         (HAPTIC_WAND_COUNTS_PER_REVOLUTION / 4)         /* counts in a quarter of a revolution */
+
+t_int
+haptic_wand_trig_table_create(struct haptic_wand_trig_table * table, const double factors[NUM_JOINTS], const double offsets[NUM_JOINTS])
+{
+    int joint, index;
+
+    memset(table, 0, sizeof(*table));
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        if (fabs(fabs(factors[joint]) - COUNT_FACTOR) > 1e-12 * COUNT_FACTOR)
+            return -1;
+    }
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        double * sines = (double *) malloc(HAPTIC_WAND_COUNTS_PER_REVOLUTION * sizeof(double));
+        if (sines == NULL)
+        {
+            haptic_wand_trig_table_destroy(table);
+            return -1;
+        }
+
+        /*
+            Entry k holds the sine of the angle k counts in the direction of increasing angle from
+            the calibration position. The angle is formed as the haptic_wand_example forms it from
+            a count, so that within the first revolution the sines match its joint angles exactly.
+        */
+        for (index = 0; index < HAPTIC_WAND_COUNTS_PER_REVOLUTION; index++)
+            sines[index] = sin(index * fabs(factors[joint]) + offsets[joint]);
+
+        table->sines[joint]      = sines;
+        table->directions[joint] = (factors[joint] < 0) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+void
+haptic_wand_trig_table_destroy(struct haptic_wand_trig_table * table)
+{
+    int joint;
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        free(table->sines[joint]);
+        table->sines[joint] = NULL;
+    }
+}
+
+void
+haptic_wand_trig_table_lookup(const struct haptic_wand_trig_table * table, const t_int32 counts[NUM_JOINTS],
+                              double sines[NUM_JOINTS], double cosines[NUM_JOINTS])
+{
+    int joint;
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        /* The encoders count many revolutions, so the count is reduced to one revolution first */
+        t_int32 index = (counts[joint] * table->directions[joint]) % HAPTIC_WAND_COUNTS_PER_REVOLUTION;
+        t_int32 quarter;
+
+        index  += (index < 0) ? HAPTIC_WAND_COUNTS_PER_REVOLUTION : 0;
+        quarter = index + QUARTER;
+        quarter -= (quarter >= HAPTIC_WAND_COUNTS_PER_REVOLUTION) ? HAPTIC_WAND_COUNTS_PER_REVOLUTION : 0;
+
+        sines[joint]   = table->sines[joint][index];
+        cosines[joint] = table->sines[joint][quarter];
+    }
+}
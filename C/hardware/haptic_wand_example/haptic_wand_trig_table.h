@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_trig_table.h - header file
+//
+// Tables of the sines and cosines of the joint angles of the Quanser
+// 5DOF Haptic Wand, indexed by encoder count, as used by the
+// haptic_wand_example when it is compiled with HAPTIC_WAND_TRIG_TABLE
+// defined.
+//
+// The joint angles come from encoders, so each joint only ever takes
+// one of HAPTIC_WAND_COUNTS_PER_REVOLUTION angles within a revolution,
+// offset by its angle at the calibration position. The table of each
+// joint holds the sine of every one of those angles. The cosine of an
+// angle is the sine of the angle a quarter of a revolution further on,
+// so it comes from the same table and the table of each joint takes
+// HAPTIC_WAND_COUNTS_PER_REVOLUTION doubles, 160 KB, rather than twice
+// that. A lookup replaces the twelve sines and cosines of a sample with
+// twelve loads.
+//
+// The tables take 960 KB in all, more than the level 1 and level 2
+// caches of most processors hold. The joints move by a few counts from
+// one sample to the next, so while the wand is held still or moved
+// smoothly, the loads of a sample hit the lines of the tables loaded at
+// the previous samples. After the rest of the controller has evicted the
+// tables, or when the wand is moved quickly, each load can miss every
+// cache and take longer than computing the sine or cosine directly. The
+// haptic_wand_kinematics_performance example measures both.
+//
+// Within the first revolution of each joint from the calibration
+// position the sines are exactly those computed from the joint angles
+// by sin. The cosines, and the sines beyond the first revolution, are
+// sines of angles that differ from the joint angles by multiples of
+// pi/2 and by the rounding of those angles, so they agree with sin and
+// cos of the joint angles to within a few units in the last place.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_trig_table_h
+#define _haptic_wand_trig_table_h
+
+#include "quanser_types.h"
+
+#include "haptic_wand.h"
+
+#define HAPTIC_WAND_COUNTS_PER_REVOLUTION   (20000)     /* encoder counts in one revolution of each joint */
+
+struct haptic_wand_trig_table
+{
+    double * sines[NUM_JOINTS];     /* sine of the joint angle at each count within a revolution, in the direction of increasing angle */
+    t_int32  directions[NUM_JOINTS];/* 1 if the joint angle increases with the count and -1 if it decreases */
+};
+
+/*
+    Build the tables for joint angles of counts[i] * factors[i] + offsets[i] radians. Each factor
+    must be plus or minus 2 pi / HAPTIC_WAND_COUNTS_PER_REVOLUTION. Returns 0 on success and -1 if
+    a factor is not or the tables cannot be allocated.
+*/
+extern t_int
+haptic_wand_trig_table_create(struct haptic_wand_trig_table * table, const double factors[NUM_JOINTS], const double offsets[NUM_JOINTS]);
+
+/*
+    Free the tables. The table may be destroyed whether or not it was created successfully.
+*/
+extern void
+haptic_wand_trig_table_destroy(struct haptic_wand_trig_table * table);
+
+/*
+    Look up the sines and cosines of the joint angles at the given encoder counts.
+*/
+extern void
+haptic_wand_trig_table_lookup(const struct haptic_wand_trig_table * table, const t_int32 counts[NUM_JOINTS],
+                              double sines[NUM_JOINTS], double cosines[NUM_JOINTS]);
+
+#endif
@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_velocity.c - C file
+//
+// Implements the velocity estimation described in
+// haptic_wand_velocity.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <math.h>
+
+#include "haptic_wand_velocity.h"
+
+t_int
+velocity_estimator_init_difference(struct velocity_estimator * estimator, t_uint32 num_channels,
+                                   double period, double cutoff_frequency)
+{
+    memset(estimator, 0, sizeof(*estimator));
+    if (num_channels == 0 || num_channels > VELOCITY_ESTIMATOR_MAX_CHANNELS || !(period > 0) || !(cutoff_frequency > 0))
+        return -1;
+
+    estimator->filter       = VELOCITY_FILTER_DIFFERENCE;
+    estimator->num_channels = num_channels;
+    estimator->window       = 2;
+    estimator->period       = period;
+    estimator->cutoff       = 2 * PI * cutoff_frequency;
+    estimator->smoothing    = 1 - exp(-estimator->cutoff * period); /* exact discretization of the first-order filter */
+    return 0;
+}
+
+t_int
+velocity_estimator_init_least_squares(struct velocity_estimator * estimator, t_uint32 num_channels,
+                                      double period, t_uint32 window)
+{
+    memset(estimator, 0, sizeof(*estimator));
+    if (num_channels == 0 || num_channels > VELOCITY_ESTIMATOR_MAX_CHANNELS || !(period > 0)
+        || window < 2 || window > VELOCITY_ESTIMATOR_MAX_WINDOW)
+        return -1;
+
+    estimator->filter       = VELOCITY_FILTER_LEAST_SQUARES;
+    estimator->num_channels = num_channels;
+    estimator->window       = window;
+    estimator->period       = period;
+    return 0;
+}
+
+/*
+    Smooth the backward difference of the two latest samples.
+*/
+static void
+update_difference(struct velocity_estimator * estimator, t_uint32 samples)
+{
+    const double * latest   = estimator->positions[estimator->head];
+    const double * previous = estimator->positions[estimator->head ^ 1];
+    const double   elapsed  = samples * estimator->period;
+    const double   gain     = (samples == 1) ? estimator->smoothing : 1 - exp(-estimator->cutoff * elapsed);
+
+    t_uint32 i;
+    for (i = 0; i < estimator->num_channels; i++)
+    {
+        const double difference = (latest[i] - previous[i]) / elapsed;
+        const double velocity   = estimator->velocities[i] + gain * (difference - estimator->velocities[i]);
+
+        /*
+            While a joint is still, its velocity decays geometrically towards zero and would soon
+            become a denormal, which is many times slower to compute with, so it is flushed to zero
+            once it is far below the resolution of the encoders.
+        */
+        estimator->velocities[i] = (fabs(velocity) < VELOCITY_ESTIMATOR_FLUSH) ? 0 : velocity;
+    }
+}
+
+/*
+    Fit a straight line to the samples held by least squares. The slope is the sum over the samples
+    of (t - tm) (x - xm) divided by the sum of (t - tm)^2, where tm and xm are the means of the
+    times and positions. The weights (t - tm) / sum (t - tm)^2 depend only on the times, so they
+    are computed once for all the channels, and since they sum to zero, xm drops out.
+*/
+static void
+update_least_squares(struct velocity_estimator * estimator)
+{
+    const t_uint32 count = estimator->count;
+
+    double weights[VELOCITY_ESTIMATOR_MAX_WINDOW];
+    t_uint32 indices[VELOCITY_ESTIMATOR_MAX_WINDOW];
+    double mean = 0, spread = 0;
+    t_uint32 i, k;
+
+    /* Times are measured back from the latest sample, so they stay small however long the controller runs */
+    for (k = 0; k < count; k++)
+    {
+        indices[k] = (estimator->head + estimator->window - k) % estimator->window;
+        weights[k] = -(double) (estimator->sample - estimator->samples[indices[k]]) * estimator->period;
+        mean      += weights[k];
+    }
+
+    mean /= count;
+    for (k = 0; k < count; k++)
+    {
+        weights[k] -= mean;
+        spread     += weights[k] * weights[k];
+    }
+
+    for (k = 0; k < count; k++)
+        weights[k] /= spread;
+
+    for (i = 0; i < estimator->num_channels; i++)
+    {
+        double slope = 0;
+        for (k = 0; k < count; k++)
+            slope += weights[k] * estimator->positions[indices[k]][i];
+        estimator->velocities[i] = slope;
+    }
+}
+
+void
+velocity_estimator_update(struct velocity_estimator * estimator, t_uint32 samples,
+                          const double positions[], double velocities[])
+{
+    t_uint32 i;
+
+    if (samples == 0)
+        samples = 1;
+
+    if (estimator->count > 0)
+    {
+        estimator->head    = (estimator->head + 1) % estimator->window;
+        estimator->sample += samples;
+    }
+
+    memcpy(estimator->positions[estimator->head], positions, estimator->num_channels * sizeof(double));
+    estimator->samples[estimator->head] = estimator->sample;
+    if (estimator->count < estimator->window)
+        estimator->count++;
+
+    if (estimator->count >= 2)
+    {
+        if (estimator->filter == VELOCITY_FILTER_DIFFERENCE)
+            update_difference(estimator, samples);
+        else
+            update_least_squares(estimator);
+    }
+
+    for (i = 0; i < estimator->num_channels; i++)
+        velocities[i] = estimator->velocities[i];
+}
+
+void
+haptic_wand_world_velocity(const double J[NUM_WORLD][NUM_JOINTS], const double omega[NUM_JOINTS], double V[NUM_WORLD])
+{
+    int i, j;
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        double sum = 0;
+        for (j = 0; j < NUM_JOINTS; j++)
+            sum += J[i][j] * omega[j];
+        V[i] = sum;
+    }
+}
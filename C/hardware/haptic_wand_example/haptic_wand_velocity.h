@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_velocity.h - header file
+//
+// Estimates the velocities of the joints of the Quanser 5DOF Haptic
+// Wand from their sampled angles, as used by the haptic_wand_example.
+//
+// The joint angles come from encoders, so they are quantized to a count
+// and the difference between two consecutive samples jumps between
+// whole counts. Two filters are offered. The first takes the backward
+// difference of consecutive samples and smooths it with a first-order
+// low-pass filter. The second fits a straight line to the last few
+// samples by least squares and takes its slope. The slope is exact
+// while the velocity is constant and lags by half the window when it
+// changes, and it rejects quantization better than the filtered
+// difference for the same lag.
+//
+// The estimator may be told that samples were skipped, as happens when
+// the controller falls behind, and accounts for the actual time between
+// the samples it was given. All of its state is held in fixed-size
+// arrays, so it never allocates memory. An update of the difference
+// filter costs a few operations per channel, plus an exponential after
+// skipped samples. An update of the least-squares fit costs a number of
+// operations proportional to the window times the number of channels,
+// so its time per sample is bounded by VELOCITY_ESTIMATOR_MAX_WINDOW.
+//
+// The velocity of the end-effector in world space is the product of the
+// Jacobian and the joint velocities, so it need not be found by
+// differentiating the end-effector coordinates.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_velocity_h
+#define _haptic_wand_velocity_h
+
+#include "quanser_types.h"
+
+#include "haptic_wand.h"
+
+#define VELOCITY_ESTIMATOR_MAX_CHANNELS (8)     /* most channels handled by one estimator */
+#define VELOCITY_ESTIMATOR_MAX_WINDOW   (32)    /* most samples in a least-squares window */
+#define VELOCITY_ESTIMATOR_FLUSH        (1e-9)  /* filtered velocities smaller than this are set to zero */
+
+/*
+    The filters offered by the velocity estimator.
+*/
+enum velocity_filter
+{
+    VELOCITY_FILTER_DIFFERENCE,                 /* backward difference smoothed by a first-order low-pass filter */
+    VELOCITY_FILTER_LEAST_SQUARES               /* slope of a straight line fitted to a sliding window of samples */
+};
+
+struct velocity_estimator
+{
+    t_uint32 filter;                            /* one of the velocity_filter values */
+    t_uint32 num_channels;
+    t_uint32 window;                            /* samples fitted by the least-squares filter */
+    double   period;                            /* sampling period in seconds */
+    double   cutoff;                            /* cutoff frequency of the low-pass filter in rad/s */
+    double   smoothing;                         /* gain of the low-pass filter over one sampling period */
+
+    /* State */
+    double   positions[VELOCITY_ESTIMATOR_MAX_WINDOW][VELOCITY_ESTIMATOR_MAX_CHANNELS];    /* latest samples, oldest overwritten first */
+    t_uint64 samples[VELOCITY_ESTIMATOR_MAX_WINDOW];                                    /* sample number of each of them */
+    t_uint64 sample;                            /* number of the latest sample */
+    t_uint32 head;                              /* index of the latest sample */
+    t_uint32 count;                             /* samples held, up to the window */
+    double   velocities[VELOCITY_ESTIMATOR_MAX_CHANNELS];                               /* latest estimate */
+};
+
+/*
+    Prepare an estimator that smooths the backward difference of num_channels channels sampled
+    every period seconds with a low-pass filter of the given cutoff frequency in Hz. Returns 0 on
+    success and -1 if the arguments are out of range.
+*/
+extern t_int
+velocity_estimator_init_difference(struct velocity_estimator * estimator, t_uint32 num_channels,
+                                   double period, double cutoff_frequency);
+
+/*
+    Prepare an estimator that fits a straight line to the last window samples of num_channels
+    channels sampled every period seconds. The window must be between 2 and
+    VELOCITY_ESTIMATOR_MAX_WINDOW. Returns 0 on success and -1 if the arguments are out of range.
+*/
+extern t_int
+velocity_estimator_init_least_squares(struct velocity_estimator * estimator, t_uint32 num_channels,
+                                      double period, t_uint32 window);
+
+/*
+    Add a sample of the positions taken the given number of sampling periods after the previous
+    one, normally 1, and compute the velocities. The velocities are zero until two samples have
+    been added.
+*/
+extern void
+velocity_estimator_update(struct velocity_estimator * estimator, t_uint32 samples,
+                          const double positions[], double velocities[]);
+
+/*
+    Compute the velocity of the end-effector in world space, V, from the Jacobian, J, and the joint
+    velocities, omega.
+*/
+extern void
+haptic_wand_world_velocity(const double J[NUM_WORLD][NUM_JOINTS], const double omega[NUM_JOINTS], double V[NUM_WORLD]);
+
+#endif
@@ -0,0 +1,2158 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_kinematics_performance.c - C file
+//
+// This example measures the kinematics and current limiter of the
+// Quanser 5DOF Haptic Wand without the wand, and checks them against
+// golden outputs. The kinematics and the limiter run every sampling
+// instant of the haptic wand controller, so the time they take comes
+// straight out of each period of the control loop.
+//
+// The kinematics are computed both by the expressions originally
+// generated for the haptic_wand_example, in haptic_wand_reference.c,
+// and by the restructured kinematics in haptic_wand_kinematics.c, which
+// compute each shared term once and form the Jacobian explicitly. The
+// forward kinematics, the inverse force kinematics and the work done at
+// each sampling instant of the controller are compared in turn. Each is
+// run over a joint-angle trajectory, either recorded from the wand or a
+// synthetic one that moves every joint through the workspace, for the
+// number of passes entered, and the time per call is reported. The
+// forces along the trajectory are those of a stiff spring holding the
+// end-effector at its home position, and the resulting motor currents
+// are used to time the current limiter. The original and restructured
+// limiters take only nanoseconds per call, so they are timed over
+// several rounds, taking turns to go first, and the fastest round of
+// each is reported.
+//
+// The single-precision kinematics in haptic_wand_kinematics_float.c,
+// used by the haptic_wand_example when it is compiled with
+// HAPTIC_WAND_SINGLE_PRECISION defined, are compared with the double-
+// precision kinematics along the trajectory, and the largest errors in
+// the position, orientation and Jacobian are checked against the bounds
+// documented in haptic_wand_kinematics_float.h.
+//
+// The tables of haptic_wand_trig_table.c, which the haptic_wand_example
+// uses when it is compiled with HAPTIC_WAND_TRIG_TABLE defined, look up
+// the sines and cosines of the joint angles by encoder count instead of
+// computing them. The sines and cosines from the tables are compared
+// with those of the joint angles, as is the Jacobian computed from them
+// along the trajectory, and both methods are timed along the
+// trajectory, where consecutive samples load nearby lines of the tables,
+// at random counts, where nearly every load misses the level 1 and
+// level 2 caches, and along the trajectory with those caches evicted
+// before every sample, as the rest of the controller does between
+// sampling instants.
+//
+// Recorded trajectories are analysed offline with the batch forward
+// kinematics, which take the joint angles of all the samples at once.
+// The batch kinematics are compared with calling the forward kinematics
+// for each sample. Starting the threads takes longer than computing a
+// trajectory of a few thousand samples, so the batch is also timed on
+// one thread and divided between the number of threads entered over a
+// million samples, the trajectory repeated, as a long recording would be.
+//
+// The velocity estimators of haptic_wand_velocity.c are checked against
+// the exact step response of each filter, with and without skipped
+// samples, and the time they take per sample is reported, together with
+// the velocity of the end-effector, for the filtered difference, with
+// and without skipped samples, and for the least-squares fit over the
+// window of the haptic_wand_example and over the largest window allowed,
+// which bounds the time it can take.
+//
+// The virtual scene of the haptic_wand_example is rendered against a
+// scene of thousands of spheres, boxes and terrain triangles filling the
+// workspace, along a random walk of the end-effector at the speeds of a
+// hand-held wand. Every force found through the bounding volume
+// hierarchy and the contact cache is compared with the force found by
+// testing every primitive, and both are timed, along with how often the
+// hierarchy had to be searched and the slowest single render.
+//
+// The golden output file holds poses spread across the workspace and
+// poses approaching the singularities of each linkage, with the
+// coordinates and torques computed by the generated expressions. Both
+// methods are checked against it, as are the single-precision
+// kinematics against their error bounds on the workspace poses, and the
+// output of the current
+// limiter over a synthetic current trace that drives every motor through
+// each of its limits. If the golden output file does not exist, it is
+// written from the generated expressions.
+//
+// A recorded trajectory is a text file with the six joint angles of one
+// sample, in radians, on each line. Lines starting with # are ignored.
+//
+// No hardware is required to run this example.
+//
+// This performance example demonstrates the use of the following functions:
+//    timeout_get_high_resolution_time
+//    qthread_create
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include "haptic_wand_kinematics_performance.h"
+
+#define MAX_SAMPLES         20000   /* most samples of a recorded trajectory used */
+#define SYNTHETIC_SAMPLES   10000   /* samples in the synthetic trajectory */
+#define PERIOD              0.001   /* sampling period of the haptic_wand_example in seconds */
+#define TOLERANCE           1e-12   /* largest difference allowed, relative to values above one */
+
+#define COLD_SAMPLES        1000    /* samples timed with the caches evicted before each */
+#define EVICTION_SIZE       (4 * 1024 * 1024)   /* bytes written to evict the level 1 and level 2 caches */
+
+#define NUM_WORKSPACE_POSES 100     /* golden poses spread across the workspace */
+#define LIMITER_SAMPLES     16000   /* samples in the synthetic current trace */
+#define LIMITER_ROUNDS      9       /* rounds of timing of each current limiter, of which the fastest is kept */
+#define SCENE_SAMPLES       20000   /* samples of the random walk of the end-effector through the virtual scene */
+#define SCENE_SPHERES       400     /* spheres scattered through the virtual scene */
+#define SCENE_BOXES         400     /* boxes scattered through the virtual scene */
+#define SCENE_GRID          40      /* vertices along each side of the terrain of the virtual scene */
+#define LONG_SAMPLES        1000000 /* samples of the repeated trajectory over which the threads are timed */
+#define LONG_ROUNDS         5       /* rounds of timing of the batch over the repeated trajectory, of which the fastest is kept */
+#define VELOCITY_CUTOFF     50      /* cutoff frequency of the filtered difference in Hz, as in the haptic_wand_example */
+#define VELOCITY_WINDOW     8       /* samples fitted by the least-squares estimate, as in the haptic_wand_example */
+#define VELOCITY_STEP       20      /* sample at which the joints start to move in the step response */
+#define VELOCITY_SAMPLES    400     /* samples of the step response */
+#define VELOCITY_TOLERANCE  1e-9    /* largest difference allowed from the exact velocity, relative to velocities above one rad/s */
+
+/*
+    A kinematic computation of the haptic wand from the joint angles, theta, and the end-effector
+    generalized forces, F. The output holds up to NUM_JOINTS values.
+*/
+typedef void (*t_kinematics)(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS]);
+
+/*
+    A computation done both by the generated expressions and by the restructured kinematics.
+*/
+struct comparison
+{
+    const char * name;          /* what is computed */
+    t_kinematics generated;     /* the expressions originally generated for the haptic_wand_example */
+    t_kinematics restructured;  /* the kinematics in haptic_wand_kinematics.c */
+    t_uint       num_outputs;   /* number of values in the output */
+};
+
+/*
+    The largest errors of the single-precision kinematics.
+*/
+struct single_error
+{
+    double position;        /* in the X, Y and Z coordinates in m */
+    double angle;           /* in the roll and pitch in radians */
+    double jacobian;        /* in the Jacobian, relative to the largest element in each of its rows */
+};
+
+/*
+    The largest differences from the golden outputs over one class of poses.
+*/
+struct golden_result
+{
+    t_uint num_poses;
+    double generated;       /* largest difference of the generated expressions */
+    double restructured;    /* largest difference of the restructured kinematics */
+    double batch;           /* largest difference of the batch forward kinematics */
+    struct single_error single; /* largest errors of the single-precision kinematics */
+};
+
+/* Joint angles at the calibration position, as set up by the haptic_wand_example */
+static const double calibration[NUM_JOINTS] = { 0.12760527954869, 3.0139873740411, 0.12760527954869, 3.0139873740411, 0.0000, 0.0000 };
+
+/* Radians per encoder count of each joint, as in the haptic_wand_example */
+static const double count_factors[NUM_JOINTS] = { 2*PI/20000, 2*PI/20000, -2*PI/20000, -2*PI/20000, 2*PI/20000, 2*PI/20000 };
+
+/* Classes of golden poses */
+static const char * const pose_classes[] = { "workspace", "singular" };
+
+static double trajectory[MAX_SAMPLES][NUM_JOINTS];
+static double forces[MAX_SAMPLES][NUM_WORLD];
+static double currents[MAX_SAMPLES][NUM_JOINTS];
+static double joint_angles[NUM_JOINTS][MAX_SAMPLES];   /* the trajectory as a structure of arrays */
+static double batch_X[NUM_WORLD][MAX_SAMPLES];
+static double * long_angles[NUM_JOINTS];    /* the trajectory repeated to LONG_SAMPLES samples as a structure of arrays */
+static double * long_X[NUM_WORLD];
+static t_int32 trajectory_counts[MAX_SAMPLES][NUM_JOINTS];  /* the trajectory as encoder counts */
+static t_int32 random_counts[MAX_SAMPLES][NUM_JOINTS];      /* encoder counts spread over several revolutions */
+static struct haptic_wand_trig_table trig_table;
+static t_ubyte eviction[EVICTION_SIZE];
+static struct haptic_scene scene;
+static double walk_positions[SCENE_SAMPLES][3];     /* positions of the end-effector along the random walk in m */
+static double walk_velocities[SCENE_SAMPLES][3];    /* velocities of the end-effector along the random walk in m/s */
+static t_uint num_samples;
+
+static void
+generated_forward(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS])
+{
+    reference_forward_kinematics(theta, output);
+}
+
+static void
+restructured_forward(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS])
+{
+    haptic_wand_forward_kinematics(theta, output);
+}
+
+/*
+    Everything the haptic_wand_example computes at each sampling instant: the end-effector
+    coordinates, and the joint torques that produce the forces. The coordinates are returned after
+    the torques that fit in the output.
+*/
+static void
+generated_sample(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS])
+{
+    double X[NUM_WORLD];
+
+    reference_forward_kinematics(theta, X);
+    reference_inverse_force_kinematics(theta, F, output);
+    output[NUM_JOINTS - 1] = X[0];  /* the last torque is always zero */
+}
+
+static void
+restructured_sample(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS])
+{
+    double X[NUM_WORLD];
+    double J[NUM_WORLD][NUM_JOINTS];
+
+    haptic_wand_jacobian(theta, X, J);
+    haptic_wand_joint_torques(J, F, output);
+    output[NUM_JOINTS - 1] = X[0];  /* the last torque is always zero */
+}
+
+/*
+    Everything the haptic_wand_example computes at each sampling instant when it is compiled with
+    HAPTIC_WAND_SINGLE_PRECISION defined, including the conversions to and from single precision.
+*/
+static void
+single_sample(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double output[NUM_JOINTS])
+{
+    float theta_float[NUM_JOINTS], F_float[NUM_WORLD];
+    float X[NUM_WORLD], J[NUM_WORLD][NUM_JOINTS], tau[NUM_JOINTS];
+    t_uint i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        theta_float[i] = (float) theta[i];
+    for (i = 0; i < NUM_WORLD; i++)
+        F_float[i] = (float) F[i];
+
+    haptic_wand_jacobian_float(theta_float, X, J);
+    haptic_wand_joint_torques_float(J, F_float, tau);
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        output[i] = tau[i];
+    output[NUM_JOINTS - 1] = X[0];  /* the last torque is always zero */
+}
+
+static const struct comparison comparisons[] =
+{
+    { "Forward kinematics",       generated_forward,                  restructured_forward,                 NUM_WORLD },
+    { "Inverse force kinematics", reference_inverse_force_kinematics, haptic_wand_inverse_force_kinematics, NUM_JOINTS },
+    { "Both, once per sample",    generated_sample,                   restructured_sample,                  NUM_JOINTS }
+};
+
+/*
+    Read a line from the console, using the default if nothing is entered.
+*/
+static void
+read_line(char * line, size_t length, const char * default_line)
+{
+    size_t end;
+
+    /* Use fgets to avoid deprecation warnings that occur on some systems. At the end of the input nothing is read, so use the default. */
+    if (fgets(line, (int) length, stdin) == NULL)
+    {
+        string_copy(line, length, default_line);
+        return;
+    }
+
+    end = string_length(line, length);
+    if (end > 0 && line[end - 1] == '\n')
+        line[end - 1] = '\0';
+    if (line[0] == '\0')
+        string_copy(line, length, default_line);
+}
+
+/*
+    Returns the next value from a fixed pseudo-random sequence, between -0.5 and 0.5.
+*/
+static double
+next_random(t_uint32 * state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return (*state >> 8) / 16777216.0 - 0.5;
+}
+
+/*
+    Fold a value into a checksum of the bit patterns of the values.
+*/
+static t_uint64
+update_checksum(t_uint64 checksum, double value)
+{
+    t_uint64 bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return (checksum ^ bits) * 0x100000001B3ull;
+}
+
+/*
+    Returns the difference between a value and its golden value, relative to the golden value if
+    it is larger than one.
+*/
+static double
+relative_difference(double value, double golden)
+{
+    const double magnitude = fabs(golden);
+    return fabs(value - golden) / ((magnitude > 1) ? magnitude : 1);
+}
+
+/*
+    Generate a synthetic trajectory in which each joint swings sinusoidally about the calibration
+    position at its own frequency, so the wand sweeps through the workspace.
+*/
+static void
+generate_trajectory(void)
+{
+    static const double amplitudes[NUM_JOINTS]  = { 0.4, 0.4, 0.4, 0.4, 0.6, 0.6 };         /* radians */
+    static const double frequencies[NUM_JOINTS] = { 0.50, 0.37, 0.61, 0.43, 0.29, 0.23 };   /* Hz */
+
+    t_uint sample, joint;
+
+    for (sample = 0; sample < SYNTHETIC_SAMPLES; sample++)
+    {
+        const double time = sample * PERIOD;
+
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+            trajectory[sample][joint] = calibration[joint] + amplitudes[joint] * sin(2 * PI * frequencies[joint] * time + joint);
+    }
+
+    num_samples = SYNTHETIC_SAMPLES;
+}
+
+/*
+    Load a recorded trajectory of joint angles. Returns 0 on success and -1 if the file cannot be
+    read or holds no samples.
+*/
+static t_int
+load_trajectory(const char * filename)
+{
+    char   text[1024];
+    FILE * file;
+
+    if (stdfile_open(filename, "rt", &file) != 0)
+        return -1;
+
+    num_samples = 0;
+    while (num_samples < MAX_SAMPLES && fgets(text, sizeof(text), file) != NULL)
+    {
+        char * position = text;
+        t_uint joint;
+
+        if (text[0] == '#')
+            continue;
+
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+        {
+            char * end;
+
+            while (*position == ',' || *position == ' ' || *position == '\t')
+                position++;
+
+            trajectory[num_samples][joint] = strtod(position, &end);
+            if (end == position)
+                break;
+
+            position = end;
+        }
+
+        if (joint == NUM_JOINTS)
+            num_samples++;
+    }
+
+    stdfile_close(file);
+    return (num_samples > 0) ? 0 : -1;
+}
+
+/*
+    Compute the forces of a stiff spring holding the end-effector at the home position used by the
+    haptic_wand_example, and the motor currents that produce them, along the trajectory.
+*/
+static void
+compute_forces(void)
+{
+    static const double k[NUM_WORLD]                 = { 200, 200, 200, 2, 2 };     /* spring constants in N/m and N-m/rad */
+    static const double home[NUM_WORLD]              = { 0.25, 0, 0, 0, 0 };        /* home position, in front of calibration position */
+    static const double torque_constants[NUM_JOINTS] = { KT_SMALL, KT_SMALL, KT_SMALL, KT_SMALL, KT_LARGE, KT_LARGE };
+
+    t_uint sample, i;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        double X[NUM_WORLD];
+        double J[NUM_WORLD][NUM_JOINTS];
+        double tau[NUM_JOINTS];
+
+        haptic_wand_jacobian(trajectory[sample], X, J);
+        for (i = 0; i < NUM_WORLD; i++)
+            forces[sample][i] = -k[i] * (X[i] - home[i]);
+
+        haptic_wand_joint_torques(J, forces[sample], tau);
+        for (i = 0; i < NUM_JOINTS; i++)
+            currents[sample][i] = tau[i] / torque_constants[i];
+    }
+}
+
+/*
+    Returns the largest difference between the outputs of the two methods over the trajectory.
+*/
+static double
+compare_methods(const struct comparison * comparison)
+{
+    double largest = 0;
+    t_uint sample, i;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        double generated[NUM_JOINTS];
+        double restructured[NUM_JOINTS];
+
+        comparison->generated(trajectory[sample], forces[sample], generated);
+        comparison->restructured(trajectory[sample], forces[sample], restructured);
+
+        for (i = 0; i < comparison->num_outputs; i++)
+        {
+            const double difference = relative_difference(restructured[i], generated[i]);
+            if (!(difference <= largest))
+                largest = difference;   /* also catches a NaN from either method */
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Compare the single-precision kinematics at one pose with the given double-precision
+    coordinates, X, and Jacobian, J, updating the largest errors. The joint angles are rounded to
+    single precision first, as the haptic_wand_example does, so the errors include that rounding.
+*/
+static void
+compare_single_pose(const double theta[NUM_JOINTS], const double X[NUM_WORLD], const double J[NUM_WORLD][NUM_JOINTS],
+                    struct single_error * error)
+{
+    float theta_float[NUM_JOINTS];
+    float single_X[NUM_WORLD], single_J[NUM_WORLD][NUM_JOINTS];
+    t_uint i, j;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        theta_float[i] = (float) theta[i];
+
+    haptic_wand_jacobian_float(theta_float, single_X, single_J);
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        const double difference = fabs(single_X[i] - X[i]);
+        double * largest = (i < 3) ? &error->position : &error->angle;
+        double row = 0;
+
+        if (!(difference <= *largest))
+            *largest = difference;
+
+        for (j = 0; j < NUM_JOINTS; j++)
+        {
+            if (fabs(J[i][j]) > row)
+                row = fabs(J[i][j]);
+        }
+
+        for (j = 0; j < NUM_JOINTS; j++)
+        {
+            const double relative = fabs(single_J[i][j] - J[i][j]) / row;
+            if (!(relative <= error->jacobian))
+                error->jacobian = relative;
+        }
+    }
+}
+
+/*
+    Returns whether the largest errors of the single-precision kinematics are within their
+    documented bounds.
+*/
+static t_boolean
+within_single_bounds(const struct single_error * error)
+{
+    return error->position <= HAPTIC_WAND_FLOAT_POSITION_ERROR
+        && error->angle <= HAPTIC_WAND_FLOAT_ANGLE_ERROR
+        && error->jacobian <= HAPTIC_WAND_FLOAT_JACOBIAN_ERROR;
+}
+
+/*
+    Find the largest errors of the single-precision kinematics over the trajectory.
+*/
+static void
+compare_single(struct single_error * error)
+{
+    t_uint sample;
+
+    memset(error, 0, sizeof(*error));
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        double X[NUM_WORLD];
+        double J[NUM_WORLD][NUM_JOINTS];
+
+        haptic_wand_jacobian(trajectory[sample], X, J);
+        compare_single_pose(trajectory[sample], X, J, error);
+    }
+}
+
+/*
+    Convert the trajectory to the encoder counts closest to it, and generate counts at random over
+    several revolutions of each joint.
+*/
+static void
+quantize_trajectory(void)
+{
+    t_uint32 state = 24680;
+    t_uint sample, joint;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+        {
+            trajectory_counts[sample][joint] = (t_int32) floor((trajectory[sample][joint] - calibration[joint]) / count_factors[joint] + 0.5);
+            random_counts[sample][joint]     = (t_int32) (4 * HAPTIC_WAND_COUNTS_PER_REVOLUTION * next_random(&state));
+        }
+    }
+}
+
+/*
+    Compute the coordinates and the Jacobian at the given encoder counts from the joint angles, as
+    the haptic_wand_example does by default.
+*/
+static void
+direct_jacobian(const t_int32 counts[NUM_JOINTS], double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS])
+{
+    double theta[NUM_JOINTS];
+    t_uint joint;
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+        theta[joint] = counts[joint] * count_factors[joint] + calibration[joint];
+
+    haptic_wand_jacobian(theta, X, J);
+}
+
+/*
+    Compute the coordinates and the Jacobian at the given encoder counts from the tables, as the
+    haptic_wand_example does when compiled with HAPTIC_WAND_TRIG_TABLE defined.
+*/
+static void
+table_jacobian(const t_int32 counts[NUM_JOINTS], double X[NUM_WORLD], double J[NUM_WORLD][NUM_JOINTS])
+{
+    double sines[NUM_JOINTS];
+    double cosines[NUM_JOINTS];
+
+    haptic_wand_trig_table_lookup(&trig_table, counts, sines, cosines);
+    haptic_wand_jacobian_trig(sines, cosines, X, J);
+}
+
+/*
+    Returns the largest difference between the sines and cosines looked up in the tables and those
+    computed from the joint angles, over the trajectory and the random counts, and between the
+    coordinates and Jacobians computed from them along the trajectory. The random counts include
+    poses close to the singularities, where the Jacobian magnifies the last place of the sines and
+    cosines, so only their sines and cosines are compared.
+*/
+static double
+compare_trig_table(void)
+{
+    double largest = 0;
+    t_uint sample, i, j;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        const t_int32 * const counts[] = { trajectory_counts[sample], random_counts[sample] };
+
+        double direct_X[NUM_WORLD], direct_J[NUM_WORLD][NUM_JOINTS];
+        double table_X[NUM_WORLD], table_J[NUM_WORLD][NUM_JOINTS];
+        double sines[NUM_JOINTS], cosines[NUM_JOINTS];
+        double difference;
+
+        for (i = 0; i < ARRAY_LENGTH(counts); i++)
+        {
+            haptic_wand_trig_table_lookup(&trig_table, counts[i], sines, cosines);
+            for (j = 0; j < NUM_JOINTS; j++)
+            {
+                const double theta = counts[i][j] * count_factors[j] + calibration[j];
+
+                difference = fabs(sines[j] - sin(theta)) + fabs(cosines[j] - cos(theta));
+                if (!(difference <= largest))
+                    largest = difference;
+            }
+        }
+
+        direct_jacobian(trajectory_counts[sample], direct_X, direct_J);
+        table_jacobian(trajectory_counts[sample], table_X, table_J);
+
+        for (i = 0; i < NUM_WORLD; i++)
+        {
+            difference = relative_difference(table_X[i], direct_X[i]);
+            if (!(difference <= largest))
+                largest = difference;
+
+            for (j = 0; j < NUM_JOINTS; j++)
+            {
+                difference = relative_difference(table_J[i][j], direct_J[i][j]);
+                if (!(difference <= largest))
+                    largest = difference;
+            }
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Compute the Jacobian at each of the given encoder counts for the given number of passes, from
+    the tables or from the joint angles. Returns the time taken in seconds.
+*/
+static double
+time_trig(t_boolean table, const t_int32 counts[][NUM_JOINTS], t_uint passes, double * sum)
+{
+    t_timeout start_time, stop_time, interval;
+    double total = 0;
+    t_uint pass, sample;
+
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        for (sample = 0; sample < num_samples; sample++)
+        {
+            double X[NUM_WORLD];
+            double J[NUM_WORLD][NUM_JOINTS];
+
+            if (table)
+                table_jacobian(counts[sample], X, J);
+            else
+                direct_jacobian(counts[sample], X, J);
+            total += X[0] + J[1][0];
+        }
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    *sum = total;
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Compute the Jacobian at COLD_SAMPLES samples spread along the trajectory, from the tables or
+    from the joint angles, evicting the level 1 and level 2 caches before each. Each sample is
+    timed on its own, less the time taken to read the clock. Returns the average time per sample
+    in seconds.
+*/
+static double
+time_trig_cold(t_boolean table, double * sum)
+{
+    t_timeout start_time, stop_time, interval;
+    double elapsed = 0, overhead = 0;
+    double total = 0;
+    t_uint sample, k;
+
+    for (sample = 0; sample < COLD_SAMPLES; sample++)
+    {
+        const t_uint index = (t_uint) ((t_uint64) sample * num_samples / COLD_SAMPLES);
+        double X[NUM_WORLD];
+        double J[NUM_WORLD][NUM_JOINTS];
+
+        for (k = 0; k < EVICTION_SIZE; k += 64)
+            eviction[k] = (t_ubyte) (eviction[k] + 1);
+
+        timeout_get_high_resolution_time(&start_time);
+        if (table)
+            table_jacobian(trajectory_counts[index], X, J);
+        else
+            direct_jacobian(trajectory_counts[index], X, J);
+        timeout_get_high_resolution_time(&stop_time);
+
+        timeout_subtract(&interval, &stop_time, &start_time);
+        elapsed += interval.seconds + interval.nanoseconds * 1e-9;
+        total   += X[0] + J[1][0];
+
+        timeout_get_high_resolution_time(&start_time);
+        timeout_get_high_resolution_time(&stop_time);
+        timeout_subtract(&interval, &stop_time, &start_time);
+        overhead += interval.seconds + interval.nanoseconds * 1e-9;
+    }
+
+    *sum = total;
+    return (elapsed - overhead) / COLD_SAMPLES;
+}
+
+/*
+    Run a method over the trajectory for the given number of passes. Returns the time taken in
+    seconds. The outputs are summed so that the calls cannot be optimized away.
+*/
+static double
+time_method(t_kinematics method, t_uint num_outputs, t_uint passes, double * sum)
+{
+    t_timeout start_time, stop_time, interval;
+    double total = 0;
+    t_uint pass, sample, i;
+
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        for (sample = 0; sample < num_samples; sample++)
+        {
+            double output[NUM_JOINTS];
+
+            method(trajectory[sample], forces[sample], output);
+            for (i = 0; i < num_outputs; i++)
+                total += output[i];
+        }
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    *sum = total;
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Run a current limiter over the motor currents along the trajectory for the given number of
+    passes, either the original state machine or the restructured limiter. Returns the time taken
+    in seconds.
+*/
+static double
+time_limiter(t_boolean original, t_uint passes, double * sum)
+{
+    struct limiter_state limiters[NUM_JOINTS];
+    struct current_limiter limiter;
+    t_timeout start_time, stop_time, interval;
+    double total = 0;
+    t_uint pass, sample, i;
+
+    memset(limiters, 0, sizeof(limiters));
+    haptic_wand_current_limiter_init(&limiter);
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        for (sample = 0; sample < num_samples; sample++)
+        {
+            double limited[NUM_JOINTS];
+
+            memcpy(limited, currents[sample], sizeof(limited));
+            if (original)
+                reference_limit_currents(limiters, PERIOD, limited);
+            else
+                current_limiter_apply(&limiter, PERIOD, limited);
+
+            for (i = 0; i < NUM_JOINTS; i++)
+                total += limited[i];
+        }
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    *sum = total;
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Prepare a velocity estimator with the filtered difference or a least-squares fit over the given
+    window.
+*/
+static void
+init_velocity_estimator(struct velocity_estimator * estimator, t_boolean least_squares, t_uint32 window)
+{
+    if (least_squares)
+        velocity_estimator_init_least_squares(estimator, NUM_JOINTS, PERIOD, window);
+    else
+        velocity_estimator_init_difference(estimator, NUM_JOINTS, PERIOD, VELOCITY_CUTOFF);
+}
+
+/*
+    Run a velocity estimator over a step response, in which every joint is still until sample
+    VELOCITY_STEP and then turns at a constant rate of its own. If skip is greater than one, every
+    fifth update once the joints are moving comes skip samples after the previous one, as when the
+    controller falls behind. The estimates are compared with the exact response of each filter:
+    the filtered difference approaches the rate as 1 - exp(-2 pi fc t) from the start of the step,
+    and the least-squares slope is zero while the window holds no moving samples and equals the
+    rate once it holds only moving samples. Returns the largest difference, relative to the rate if
+    it is larger than one rad/s.
+*/
+static double
+compare_velocity_step(t_boolean least_squares, t_uint32 skip)
+{
+    static struct velocity_estimator estimator;
+
+    t_uint64 samples[VELOCITY_ESTIMATOR_MAX_WINDOW];
+    double largest = 0;
+    t_uint64 sample = 0;
+    t_uint update;
+
+    init_velocity_estimator(&estimator, least_squares, VELOCITY_WINDOW);
+    for (update = 0; update < VELOCITY_SAMPLES; update++)
+    {
+        double rates[NUM_JOINTS], positions[NUM_JOINTS], velocities[NUM_JOINTS];
+        t_uint32 step = 1;
+        t_uint joint;
+
+        if (update > 0)
+        {
+            if (skip > 1 && sample >= VELOCITY_STEP && update % 5 == 0)
+                step = skip;
+            sample += step;
+        }
+
+        samples[update % VELOCITY_WINDOW] = sample;
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+        {
+            rates[joint]     = ((joint % 2 == 0) ? 1 : -1) * (0.5 + 0.4 * joint);   /* up to 2.5 rad/s */
+            positions[joint] = calibration[joint] + ((sample > VELOCITY_STEP) ? rates[joint] * (double) (sample - VELOCITY_STEP) * PERIOD : 0);
+        }
+
+        velocity_estimator_update(&estimator, step, positions, velocities);
+
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+        {
+            double expected;
+
+            if (!least_squares)
+                expected = (sample > VELOCITY_STEP) ? rates[joint] * (1 - exp(-2 * PI * VELOCITY_CUTOFF * (double) (sample - VELOCITY_STEP) * PERIOD)) : 0;
+            else if (sample <= VELOCITY_STEP)
+                expected = 0;
+            else if (update >= VELOCITY_WINDOW && samples[(update + 1) % VELOCITY_WINDOW] >= VELOCITY_STEP)
+                expected = rates[joint];    /* the oldest sample in the window is on the ramp */
+            else
+                continue;                   /* the window spans the start of the step */
+
+            if (!(relative_difference(velocities[joint], expected) <= largest))
+                largest = relative_difference(velocities[joint], expected);
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Estimate the joint velocities along the trajectory and map them to the velocity of the
+    end-effector, as the haptic_wand_example does every sample, for the given number of passes.
+    Each update comes skip samples after the previous one. Returns the time taken in seconds.
+*/
+static double
+time_velocity(t_boolean least_squares, t_uint32 window, t_uint32 skip, t_uint passes, double * sum)
+{
+    static struct velocity_estimator estimator;
+
+    t_timeout start_time, stop_time, interval;
+    double X[NUM_WORLD];
+    double J[NUM_WORLD][NUM_JOINTS];
+    double total = 0;
+    t_uint pass, sample;
+
+    /* The time taken by the product of the Jacobian and the joint velocities does not depend on the pose */
+    haptic_wand_jacobian(trajectory[0], X, J);
+    init_velocity_estimator(&estimator, least_squares, window);
+
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        for (sample = 0; sample < num_samples; sample++)
+        {
+            double omega[NUM_JOINTS];
+            double V[NUM_WORLD];
+
+            velocity_estimator_update(&estimator, skip, trajectory[sample], omega);
+            haptic_wand_world_velocity(J, omega, V);
+            total += V[0];
+        }
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    *sum = total;
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Build a virtual scene of thousands of primitives filling the workspace: a floor, a terrain of
+    triangles just above it, and spheres and boxes of assorted sizes scattered at random. Returns
+    0 on success and -1 on failure.
+*/
+static t_int
+build_scene(void)
+{
+    static const double floor_point[3]  = { 0.25, 0, -0.08 };
+    static const double floor_normal[3] = { 0, 0, 1 };
+    static const double stiffness = 300;    /* N/m */
+    static const double damping   = 2;      /* N-s/m */
+    static const double thickness = 0.02;   /* m */
+
+    static double   vertices[SCENE_GRID * SCENE_GRID][3];
+    static t_uint32 triangles[2 * (SCENE_GRID - 1) * (SCENE_GRID - 1)][3];
+
+    t_uint32 state = 7;
+    t_uint32 num_triangles = 0;
+    t_uint   i, j;
+
+    if (haptic_scene_create(&scene, SCENE_SPHERES + SCENE_BOXES + 2, SCENE_SPHERES + SCENE_BOXES + ARRAY_LENGTH(triangles), 1) != 0)
+        return -1;
+
+    /* A rolling terrain over the whole workspace, with its triangles facing up */
+    for (i = 0; i < SCENE_GRID; i++)
+    {
+        for (j = 0; j < SCENE_GRID; j++)
+        {
+            double * vertex = vertices[i * SCENE_GRID + j];
+
+            vertex[0] = 0.15 + 0.20 * i / (SCENE_GRID - 1);
+            vertex[1] = -0.15 + 0.30 * j / (SCENE_GRID - 1);
+            vertex[2] = -0.065 + 0.01 * sin(60 * vertex[0]) * cos(40 * vertex[1]);
+        }
+    }
+
+    for (i = 0; i + 1 < SCENE_GRID; i++)
+    {
+        for (j = 0; j + 1 < SCENE_GRID; j++)
+        {
+            const t_uint32 corner = (t_uint32) (i * SCENE_GRID + j);
+
+            triangles[num_triangles][0] = corner;
+            triangles[num_triangles][1] = corner + SCENE_GRID;
+            triangles[num_triangles][2] = corner + SCENE_GRID + 1;
+            num_triangles++;
+
+            triangles[num_triangles][0] = corner;
+            triangles[num_triangles][1] = corner + SCENE_GRID + 1;
+            triangles[num_triangles][2] = corner + 1;
+            num_triangles++;
+        }
+    }
+
+    if (haptic_scene_add_plane(&scene, floor_point, floor_normal, stiffness, damping) != 0
+        || haptic_scene_add_mesh(&scene, ARRAY_LENGTH(vertices), vertices, num_triangles, triangles, thickness, stiffness, damping) != 0)
+    {
+        haptic_scene_destroy(&scene);
+        return -1;
+    }
+
+    for (i = 0; i < SCENE_SPHERES + SCENE_BOXES; i++)
+    {
+        double center[3], minimum[3], maximum[3];
+        double size;
+        t_int  result;
+
+        center[0] = 0.25 + 0.20 * next_random(&state);
+        center[1] = 0.30 * next_random(&state);
+        center[2] = 0.01 + 0.14 * next_random(&state);
+        size      = 0.008 + 0.008 * next_random(&state);
+
+        if (i < SCENE_SPHERES)
+            result = haptic_scene_add_sphere(&scene, center, size, stiffness, damping);
+        else
+        {
+            for (j = 0; j < 3; j++)
+            {
+                minimum[j] = center[j] - size;
+                maximum[j] = center[j] + size;
+            }
+            result = haptic_scene_add_box(&scene, minimum, maximum, stiffness, damping);
+        }
+
+        if (result != 0)
+        {
+            haptic_scene_destroy(&scene);
+            return -1;
+        }
+    }
+
+    if (haptic_scene_build(&scene) != 0)
+    {
+        haptic_scene_destroy(&scene);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+    Generate a random walk of the end-effector through the workspace. The velocity wanders at
+    random, up to half a metre per second along each axis, and reverses at the edges of the
+    workspace, so the end-effector moves a fraction of a millimetre per sample, as it does when
+    the wand is held, and passes into and out of the objects of the scene.
+*/
+static void
+generate_walk(void)
+{
+    static const double lower[3] = { 0.15, -0.15, -0.09 };
+    static const double upper[3] = { 0.35,  0.15,  0.09 };
+
+    double position[3] = { 0.25, 0, 0 };
+    double velocity[3] = { 0, 0, 0 };
+    t_uint32 state = 11;
+    t_uint sample, i;
+
+    for (sample = 0; sample < SCENE_SAMPLES; sample++)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            velocity[i] += 0.05 * next_random(&state);
+            if (velocity[i] > 0.5)
+                velocity[i] = 0.5;
+            else if (velocity[i] < -0.5)
+                velocity[i] = -0.5;
+
+            position[i] += velocity[i] * PERIOD;
+            if ((position[i] < lower[i] && velocity[i] < 0) || (position[i] > upper[i] && velocity[i] > 0))
+                velocity[i] = -velocity[i];
+
+            walk_positions[sample][i]  = position[i];
+            walk_velocities[sample][i] = velocity[i];
+        }
+    }
+}
+
+/*
+    Render the scene along the random walk both through the hierarchy and the contact cache and by
+    testing every primitive. Returns the largest difference between the forces, and the number of
+    samples at which the end-effector felt a force.
+*/
+static double
+compare_scene(t_uint * num_touching)
+{
+    double largest = 0;
+    t_uint sample, i;
+
+    *num_touching = 0;
+    for (sample = 0; sample < SCENE_SAMPLES; sample++)
+    {
+        double rendered[3], exhaustive[3];
+
+        haptic_scene_render(&scene, walk_positions[sample], walk_velocities[sample], rendered);
+        haptic_scene_render_exhaustive(&scene, walk_positions[sample], walk_velocities[sample], exhaustive);
+
+        if (exhaustive[0] != 0 || exhaustive[1] != 0 || exhaustive[2] != 0)
+            (*num_touching)++;
+
+        for (i = 0; i < 3; i++)
+        {
+            const double difference = relative_difference(rendered[i], exhaustive[i]);
+            if (difference > largest)
+                largest = difference;
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Render the scene along the random walk for the given number of passes, either through the
+    hierarchy and the contact cache or by testing every primitive. Returns the time taken by all
+    the passes in seconds.
+*/
+static double
+time_scene(t_boolean exhaustive, t_uint passes, double * sum)
+{
+    t_timeout start_time, stop_time, interval;
+    double total = 0;
+    t_uint pass, sample;
+
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+    {
+        for (sample = 0; sample < SCENE_SAMPLES; sample++)
+        {
+            double force[3];
+
+            if (exhaustive)
+                haptic_scene_render_exhaustive(&scene, walk_positions[sample], walk_velocities[sample], force);
+            else
+                haptic_scene_render(&scene, walk_positions[sample], walk_velocities[sample], force);
+
+            total += force[0] + force[1] + force[2];
+        }
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    *sum = total;
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Time each render along the random walk on its own. Returns the longest time taken by any one
+    render in seconds, less the time taken to read the clock.
+*/
+static double
+time_scene_slowest(void)
+{
+    t_timeout start_time, stop_time, interval;
+    double slowest = 0, overhead = -1;
+    t_uint sample;
+
+    for (sample = 0; sample < SCENE_SAMPLES; sample++)
+    {
+        double force[3];
+        double elapsed;
+
+        timeout_get_high_resolution_time(&start_time);
+        timeout_get_high_resolution_time(&stop_time);
+        timeout_subtract(&interval, &stop_time, &start_time);
+        elapsed = interval.seconds + interval.nanoseconds * 1e-9;
+        if (overhead < 0 || elapsed < overhead)
+            overhead = elapsed;
+
+        timeout_get_high_resolution_time(&start_time);
+        haptic_scene_render(&scene, walk_positions[sample], walk_velocities[sample], force);
+        timeout_get_high_resolution_time(&stop_time);
+        timeout_subtract(&interval, &stop_time, &start_time);
+
+        elapsed = interval.seconds + interval.nanoseconds * 1e-9;
+        if (elapsed > slowest)
+            slowest = elapsed;
+    }
+
+    return slowest - overhead;
+}
+
+/*
+    Arrange the joint angles of the trajectory as a structure of arrays for the batch kinematics.
+*/
+static void
+arrange_joint_angles(void)
+{
+    t_uint sample, joint;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+            joint_angles[joint][sample] = trajectory[sample][joint];
+    }
+}
+
+/*
+    Compute the batch forward kinematics over the trajectory, dividing the samples between the given
+    number of threads. One thread computes the batch directly.
+*/
+static t_error
+run_batch(t_uint num_threads)
+{
+    const double * theta[NUM_JOINTS];
+    double * X[NUM_WORLD];
+    t_uint i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        theta[i] = joint_angles[i];
+    for (i = 0; i < NUM_WORLD; i++)
+        X[i] = batch_X[i];
+
+    if (num_threads <= 1)
+    {
+        haptic_wand_forward_kinematics_batch(num_samples, theta, X);
+        return 0;
+    }
+
+    return haptic_wand_forward_kinematics_parallel(num_samples, theta, X, num_threads);
+}
+
+/*
+    Returns the largest difference between the batch forward kinematics, as last computed by
+    run_batch, and the forward kinematics of each sample.
+*/
+static double
+compare_batch(void)
+{
+    double largest = 0;
+    t_uint sample, i;
+
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        double X[NUM_WORLD];
+
+        haptic_wand_forward_kinematics(trajectory[sample], X);
+        for (i = 0; i < NUM_WORLD; i++)
+        {
+            const double difference = relative_difference(batch_X[i][sample], X[i]);
+            if (!(difference <= largest))
+                largest = difference;
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Run the batch forward kinematics over the trajectory for the given number of passes. Returns
+    the time taken in seconds.
+*/
+static double
+time_batch(t_uint num_threads, t_uint passes)
+{
+    t_timeout start_time, stop_time, interval;
+    t_uint pass;
+
+    timeout_get_high_resolution_time(&start_time);
+
+    for (pass = 0; pass < passes; pass++)
+        run_batch(num_threads);
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Repeat the trajectory, arranged by arrange_joint_angles, to LONG_SAMPLES samples. Returns 0 on
+    success and -1 if the arrays cannot be allocated.
+*/
+static t_int
+create_long_trajectory(void)
+{
+    t_uint sample, i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+    {
+        long_angles[i] = (double *) malloc(LONG_SAMPLES * sizeof(double));
+        if (long_angles[i] == NULL)
+            return -1;
+
+        for (sample = 0; sample < LONG_SAMPLES; sample++)
+            long_angles[i][sample] = joint_angles[i][sample % num_samples];
+    }
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        long_X[i] = (double *) malloc(LONG_SAMPLES * sizeof(double));
+        if (long_X[i] == NULL)
+            return -1;
+    }
+
+    return 0;
+}
+
+/*
+    Free the repeated trajectory. It may be destroyed whether or not it was created successfully.
+*/
+static void
+destroy_long_trajectory(void)
+{
+    t_uint i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+    {
+        free(long_angles[i]);
+        long_angles[i] = NULL;
+    }
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        free(long_X[i]);
+        long_X[i] = NULL;
+    }
+}
+
+/*
+    Run the batch forward kinematics once over the repeated trajectory, dividing the samples between
+    the given number of threads. Returns the time taken in seconds.
+*/
+static double
+time_long_batch(t_uint num_threads)
+{
+    const double * theta[NUM_JOINTS];
+    double * X[NUM_WORLD];
+    t_timeout start_time, stop_time, interval;
+    t_uint i;
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        theta[i] = long_angles[i];
+    for (i = 0; i < NUM_WORLD; i++)
+        X[i] = long_X[i];
+
+    timeout_get_high_resolution_time(&start_time);
+
+    if (num_threads <= 1)
+        haptic_wand_forward_kinematics_batch(LONG_SAMPLES, theta, X);
+    else
+        haptic_wand_forward_kinematics_parallel(LONG_SAMPLES, theta, X, num_threads);
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    return interval.seconds + interval.nanoseconds * 1e-9;
+}
+
+/*
+    Returns the largest difference between the batch forward kinematics over the repeated
+    trajectory, as last computed by time_long_batch, and over the trajectory itself.
+*/
+static double
+compare_long_batch(void)
+{
+    double largest = 0;
+    t_uint sample, i;
+
+    for (sample = 0; sample < LONG_SAMPLES; sample++)
+    {
+        for (i = 0; i < NUM_WORLD; i++)
+        {
+            const double difference = relative_difference(long_X[i][sample], batch_X[i][sample % num_samples]);
+            if (!(difference <= largest))
+                largest = difference;
+        }
+    }
+
+    return largest;
+}
+
+/*
+    Print the speed of one method.
+*/
+static void
+print_result(const char * method, double elapsed, t_uint passes)
+{
+    printf("    %-14s %f seconds (%.1f nsecs per call)\n", method, elapsed, elapsed / ((double) passes * num_samples) * 1e9);
+}
+
+/*
+    The motor currents at the given sample of a synthetic trace that drives every limiter through
+    all of its states. The currents exceed the peak limits for three seconds, which forces the
+    motors to cool, stay below the continuous limits long enough for them to recover, and then
+    alternate between peaks and quiet periods. Each current is a triangle wave stepping in sixty-
+    fourths, scaled by a power of two times a whole number, so every current is exact and the
+    checksum of the limited currents is the same on every platform.
+*/
+static void
+limiter_trace(t_uint sample, double motor_currents[NUM_JOINTS])
+{
+    static const double peak_limits[NUM_JOINTS] = { LIMIT_1_SMALL, LIMIT_1_SMALL, LIMIT_1_SMALL, LIMIT_1_SMALL, LIMIT_1_LARGE, LIMIT_1_LARGE };
+
+    const double time = sample * PERIOD;
+    const double envelope = (time < 3) ? 1.25 : (time < 14) ? 0.25 : ((sample / 150) % 2 != 0) ? 1.25 : 0.125;
+    t_uint joint;
+
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        const t_uint phase = (sample + 37 * joint) % 256;
+        const double wave  = ((phase < 128) ? phase : 256 - phase) / 64.0 - 1;
+
+        motor_currents[joint] = envelope * peak_limits[joint] * wave;
+    }
+}
+
+/*
+    Run a current limiter over the synthetic current trace, either the original state machine or
+    the restructured limiter. Returns a checksum of the limited currents.
+*/
+static t_uint64
+limiter_checksum(t_boolean original)
+{
+    struct limiter_state limiters[NUM_JOINTS];
+    struct current_limiter limiter;
+    t_uint64 checksum = 0xCBF29CE484222325ull;
+    t_uint sample, joint;
+
+    memset(limiters, 0, sizeof(limiters));
+    haptic_wand_current_limiter_init(&limiter);
+    for (sample = 0; sample < LIMITER_SAMPLES; sample++)
+    {
+        double motor_currents[NUM_JOINTS];
+
+        limiter_trace(sample, motor_currents);
+        if (original)
+            reference_limit_currents(limiters, PERIOD, motor_currents);
+        else
+            current_limiter_apply(&limiter, PERIOD, motor_currents);
+
+        for (joint = 0; joint < NUM_JOINTS; joint++)
+            checksum = update_checksum(checksum, motor_currents[joint]);
+    }
+
+    return checksum;
+}
+
+/*
+    Apply the original and the restructured current limiters to the same motor currents. Returns
+    true if the limited currents and the states of the limiters are exactly the same.
+*/
+static t_boolean
+compare_limiter_sample(struct limiter_state limiters[NUM_JOINTS], struct current_limiter * limiter, const double motor_currents[NUM_JOINTS])
+{
+    double original[NUM_JOINTS];
+    double restructured[NUM_JOINTS];
+    t_boolean same;
+    t_uint joint;
+
+    memcpy(original, motor_currents, sizeof(original));
+    memcpy(restructured, motor_currents, sizeof(restructured));
+
+    reference_limit_currents(limiters, PERIOD, original);
+    current_limiter_apply(limiter, PERIOD, restructured);
+
+    same = (memcmp(original, restructured, sizeof(original)) == 0);
+    for (joint = 0; joint < NUM_JOINTS; joint++)
+    {
+        same = same
+            && limiters[joint].state == limiter->state[joint]
+            && limiters[joint].time == limiter->time[joint]
+            && limiters[joint].count == limiter->count[joint]
+            && limiters[joint].mean == limiter->mean[joint];
+    }
+
+    return same;
+}
+
+/*
+    Returns the number of samples of the trajectory and of the synthetic current trace at which the
+    original and restructured current limiters differ.
+*/
+static t_uint
+compare_limiters(void)
+{
+    struct limiter_state limiters[NUM_JOINTS];
+    struct current_limiter limiter;
+    t_uint differences = 0;
+    t_uint sample;
+
+    memset(limiters, 0, sizeof(limiters));
+    haptic_wand_current_limiter_init(&limiter);
+    for (sample = 0; sample < num_samples; sample++)
+    {
+        if (!compare_limiter_sample(limiters, &limiter, currents[sample]))
+            differences++;
+    }
+
+    memset(limiters, 0, sizeof(limiters));
+    haptic_wand_current_limiter_init(&limiter);
+    for (sample = 0; sample < LIMITER_SAMPLES; sample++)
+    {
+        double motor_currents[NUM_JOINTS];
+
+        limiter_trace(sample, motor_currents);
+        if (!compare_limiter_sample(limiters, &limiter, motor_currents))
+            differences++;
+    }
+
+    return differences;
+}
+
+/*
+    Returns the determinant of the planar Jacobian of one linkage when its joints are spread apart
+    from the calibration position by the given angle. The linkage is singular where the determinant
+    is zero. The rows of the Jacobian for X and Y are obtained from the generated expressions by
+    applying unit forces along X and Y. The linkage is not rotated, so these rows hold the
+    derivatives of the end point of the linkage in its own plane.
+*/
+static double
+linkage_determinant(t_uint linkage, double spread)
+{
+    static const double unit_x[NUM_WORLD] = { 1, 0, 0, 0, 0 };
+    static const double unit_y[NUM_WORLD] = { 0, 1, 0, 0, 0 };
+
+    const t_uint a = 2 * linkage;
+    const t_uint b = 2 * linkage + 1;
+    double theta[NUM_JOINTS];
+    double row_x[NUM_JOINTS];
+    double row_y[NUM_JOINTS];
+
+    memcpy(theta, calibration, sizeof(theta));
+    theta[a] -= spread;
+    theta[b] += spread;
+
+    reference_inverse_force_kinematics(theta, unit_x, row_x);
+    reference_inverse_force_kinematics(theta, unit_y, row_y);
+
+    return row_x[a] * row_y[b] - row_x[b] * row_y[a];
+}
+
+/*
+    Returns the spread of the joints of one linkage at which the linkage is closest to singular.
+*/
+static double
+find_singular_spread(t_uint linkage)
+{
+    const double step = 0.001;
+    double best = 0.9;
+    double lower, upper, spread;
+    t_uint iteration;
+
+    /* Find the neighbourhood of the singularity and then narrow it down by a ternary search */
+    for (spread = 0.9; spread < 1.7; spread += step)
+    {
+        if (fabs(linkage_determinant(linkage, spread)) < fabs(linkage_determinant(linkage, best)))
+            best = spread;
+    }
+
+    lower = best - step;
+    upper = best + step;
+    for (iteration = 0; iteration < 100; iteration++)
+    {
+        const double left  = lower + (upper - lower) / 3;
+        const double right = upper - (upper - lower) / 3;
+
+        if (fabs(linkage_determinant(linkage, left)) < fabs(linkage_determinant(linkage, right)))
+            upper = right;
+        else
+            lower = left;
+    }
+
+    return (lower + upper) / 2;
+}
+
+/*
+    Write one golden pose, computing its outputs with the generated expressions.
+*/
+static void
+write_golden_pose(FILE * file, const char * pose_class, const double theta[NUM_JOINTS], const double F[NUM_WORLD])
+{
+    double X[NUM_WORLD];
+    double tau[NUM_JOINTS];
+    t_uint i;
+
+    reference_forward_kinematics(theta, X);
+    reference_inverse_force_kinematics(theta, F, tau);
+
+    fprintf(file, "%s", pose_class);
+    for (i = 0; i < NUM_JOINTS; i++)
+        fprintf(file, " %.17g", theta[i]);
+    for (i = 0; i < NUM_WORLD; i++)
+        fprintf(file, " %.17g", F[i]);
+    for (i = 0; i < NUM_WORLD; i++)
+        fprintf(file, " %.17g", X[i]);
+    for (i = 0; i < NUM_JOINTS; i++)
+        fprintf(file, " %.17g", tau[i]);
+    fprintf(file, "\n");
+}
+
+/*
+    Write the golden outputs from the generated expressions. Returns 0 on success and -1 if the
+    file cannot be written.
+*/
+static t_int
+write_golden(const char * filename)
+{
+    static const double ranges[NUM_JOINTS]      = { 2.0, 2.0, 2.0, 2.0, 2.4, 2.4 };
+    static const double force_ranges[NUM_WORLD] = { 20, 20, 20, 2, 2 };  /* forces in N and torques in N-m */
+    static const double offsets[]               = { 0, 1e-6, -1e-6, 1e-3, -1e-3 };
+    static const double rotations[][2]          = { { 0, 0 }, { 0.5, -0.4 } };
+
+    t_uint32 state = 54321;
+    t_uint64 checksum;
+    double theta[NUM_JOINTS];
+    double F[NUM_WORLD];
+    FILE * file;
+    t_uint pose, linkage, rotation, offset, i;
+
+    if (stdfile_open(filename, "wt", &file) != 0)
+        return -1;
+
+    fprintf(file, "# Golden outputs of the haptic wand kinematics and current limiter, computed by the generated\n");
+    fprintf(file, "# expressions in haptic_wand_reference.c. Each pose holds its class, the 6 joint angles, the 5\n");
+    fprintf(file, "# generalized forces, the 5 world coordinates and the 6 joint torques. The limiter line holds the\n");
+    fprintf(file, "# number of samples in the synthetic current trace and the checksum of the limited currents.\n");
+
+    /* Poses spread across the workspace */
+    for (pose = 0; pose < NUM_WORKSPACE_POSES; pose++)
+    {
+        for (i = 0; i < NUM_JOINTS; i++)
+            theta[i] = calibration[i] + ranges[i] * next_random(&state);
+        for (i = 0; i < NUM_WORLD; i++)
+            F[i] = force_ranges[i] * next_random(&state);
+
+        write_golden_pose(file, pose_classes[0], theta, F);
+    }
+
+    /* Poses at and around the singularity of each linkage, with the linkage planes rotated and not */
+    for (linkage = 0; linkage < 2; linkage++)
+    {
+        const double spread = find_singular_spread(linkage);
+
+        for (rotation = 0; rotation < ARRAY_LENGTH(rotations); rotation++)
+        {
+            for (offset = 0; offset < ARRAY_LENGTH(offsets); offset++)
+            {
+                memcpy(theta, calibration, sizeof(theta));
+                theta[2 * linkage]     -= spread + offsets[offset];
+                theta[2 * linkage + 1] += spread + offsets[offset];
+                theta[4] = rotations[rotation][0];
+                theta[5] = rotations[rotation][1];
+
+                for (i = 0; i < NUM_WORLD; i++)
+                    F[i] = force_ranges[i] * next_random(&state);
+
+                write_golden_pose(file, pose_classes[1], theta, F);
+            }
+        }
+    }
+
+    checksum = limiter_checksum(true);
+    fprintf(file, "limiter %u %08lx%08lx\n", LIMITER_SAMPLES, (unsigned long) (checksum >> 32), (unsigned long) (checksum & 0xFFFFFFFFu));
+
+    if (ferror(file))
+    {
+        stdfile_close(file);
+        return -1;
+    }
+
+    stdfile_close(file);
+    return 0;
+}
+
+/*
+    Check both methods and the batch forward kinematics against one golden pose.
+*/
+static void
+check_golden_pose(const double values[], struct golden_result * result)
+{
+    const double * theta     = &values[0];
+    const double * F         = &values[NUM_JOINTS];
+    const double * golden_X  = &values[NUM_JOINTS + NUM_WORLD];
+    const double * golden_t  = &values[NUM_JOINTS + 2 * NUM_WORLD];
+
+    double generated_X[NUM_WORLD], generated_tau[NUM_JOINTS];
+    double forward_X[NUM_WORLD], jacobian_X[NUM_WORLD], tau[NUM_JOINTS];
+    double J[NUM_WORLD][NUM_JOINTS];
+    double batch_output[NUM_WORLD];
+    const double * batch_theta[NUM_JOINTS];
+    double * batch_pose[NUM_WORLD];
+    t_uint i;
+
+    reference_forward_kinematics(theta, generated_X);
+    reference_inverse_force_kinematics(theta, F, generated_tau);
+
+    haptic_wand_forward_kinematics(theta, forward_X);
+    haptic_wand_jacobian(theta, jacobian_X, J);
+    haptic_wand_joint_torques(J, F, tau);
+
+    for (i = 0; i < NUM_JOINTS; i++)
+        batch_theta[i] = &theta[i];
+    for (i = 0; i < NUM_WORLD; i++)
+        batch_pose[i] = &batch_output[i];
+    haptic_wand_forward_kinematics_batch(1, batch_theta, batch_pose);
+
+    /* The golden outputs hold no Jacobian, so the single-precision Jacobian is compared with the restructured one */
+    compare_single_pose(theta, golden_X, J, &result->single);
+
+    for (i = 0; i < NUM_JOINTS; i++)
+    {
+        const double generated    = relative_difference(generated_tau[i], golden_t[i]);
+        const double restructured = relative_difference(tau[i], golden_t[i]);
+
+        if (!(generated <= result->generated))
+            result->generated = generated;
+        if (!(restructured <= result->restructured))
+            result->restructured = restructured;
+    }
+
+    for (i = 0; i < NUM_WORLD; i++)
+    {
+        const double generated = relative_difference(generated_X[i], golden_X[i]);
+        const double forward   = relative_difference(forward_X[i], golden_X[i]);
+        const double jacobian  = relative_difference(jacobian_X[i], golden_X[i]);
+        const double batch     = relative_difference(batch_output[i], golden_X[i]);
+
+        if (!(generated <= result->generated))
+            result->generated = generated;
+        if (!(forward <= result->restructured))
+            result->restructured = forward;
+        if (!(jacobian <= result->restructured))
+            result->restructured = jacobian;
+        if (!(batch <= result->batch))
+            result->batch = batch;
+    }
+
+    result->num_poses++;
+}
+
+/*
+    Check the kinematics and the current limiter against the golden outputs, printing the results.
+    Returns 1 if every check passed, 0 if any failed and -1 if the file cannot be read.
+*/
+static t_int
+check_golden(const char * filename)
+{
+    struct golden_result results[ARRAY_LENGTH(pose_classes)];
+    t_boolean passed          = true;
+    t_boolean limiter_checked = false;
+    char   text[1024];
+    FILE * file;
+    t_uint index;
+
+    if (stdfile_open(filename, "rt", &file) != 0)
+        return -1;
+
+    memset(results, 0, sizeof(results));
+    while (fgets(text, sizeof(text), file) != NULL)
+    {
+        char name[16];
+        int  consumed;
+
+        if (text[0] == '#' || sscanf(text, "%15s%n", name, &consumed) != 1)
+            continue;
+
+        if (strcmp(name, "limiter") == 0)
+        {
+            unsigned long high, low;
+            unsigned int  samples;
+
+            if (sscanf(text + consumed, "%u %8lx%8lx", &samples, &high, &low) == 3)
+            {
+                const t_uint64  golden_checksum = ((t_uint64) high << 32) | low;
+                const t_boolean original        = samples == LIMITER_SAMPLES && limiter_checksum(true) == golden_checksum;
+                const t_boolean restructured    = samples == LIMITER_SAMPLES && limiter_checksum(false) == golden_checksum;
+                const t_boolean matches         = original && restructured;
+
+                printf("    Current limiters over %u samples: %s\n", LIMITER_SAMPLES,
+                    matches ? "the limited currents match" : (original ? "the restructured limiter DIFFERS" : "the limited currents DIFFER"));
+                passed          = passed && matches;
+                limiter_checked = true;
+            }
+        }
+        else
+        {
+            double values[2 * NUM_JOINTS + 2 * NUM_WORLD];
+            char * position = text + consumed;
+
+            for (index = 0; index < ARRAY_LENGTH(values); index++)
+            {
+                char * end;
+
+                values[index] = strtod(position, &end);
+                if (end == position)
+                    break;
+                position = end;
+            }
+
+            if (index < ARRAY_LENGTH(values))
+                continue;
+
+            for (index = 0; index < ARRAY_LENGTH(pose_classes); index++)
+            {
+                if (strcmp(name, pose_classes[index]) == 0)
+                {
+                    check_golden_pose(values, &results[index]);
+                    break;
+                }
+            }
+        }
+    }
+
+    stdfile_close(file);
+
+    printf("    %-12s %8s %14s %14s %14s\n", "Poses", "Count", "Generated", "Restructured", "Batch");
+    for (index = 0; index < ARRAY_LENGTH(pose_classes); index++)
+    {
+        const struct golden_result * result = &results[index];
+
+        printf("    %-12s %8u %14.3g %14.3g %14.3g\n", pose_classes[index], result->num_poses, result->generated, result->restructured, result->batch);
+        passed = passed && result->num_poses > 0 && result->generated <= TOLERANCE && result->restructured <= TOLERANCE && result->batch <= TOLERANCE;
+    }
+    printf("    %-12s %8s %14g %14g %14g\n", "tolerance", "", TOLERANCE, TOLERANCE, TOLERANCE);
+
+    /*
+        The single-precision kinematics are only required to be within their bounds across the
+        workspace. Close to the singularities their errors are reported but not checked.
+    */
+    printf("\n    %-12s %8s %14s %14s %14s\n", "Single", "Count", "Position", "Angle", "Jacobian");
+    for (index = 0; index < ARRAY_LENGTH(pose_classes); index++)
+    {
+        const struct golden_result * result = &results[index];
+
+        printf("    %-12s %8u %14.3g %14.3g %14.3g\n", pose_classes[index], result->num_poses,
+            result->single.position, result->single.angle, result->single.jacobian);
+    }
+    printf("    %-12s %8s %14g %14g %14g  (%s poses only)\n", "tolerance", "",
+        HAPTIC_WAND_FLOAT_POSITION_ERROR, HAPTIC_WAND_FLOAT_ANGLE_ERROR, HAPTIC_WAND_FLOAT_JACOBIAN_ERROR, pose_classes[0]);
+
+    if (!within_single_bounds(&results[0].single))
+        printf("    The single-precision kinematics EXCEED their error bounds on the workspace poses.\n");
+    passed = passed && within_single_bounds(&results[0].single);
+
+    if (!limiter_checked)
+        printf("    The current limiter has no golden output.\n");
+
+    return (passed && limiter_checked) ? 1 : 0;
+}
+
+int main(int argc, char * argv[])
+{
+    static const char default_passes[] = "100";
+    static const char default_golden[] = "haptic_wand_golden.txt";
+    static const char default_threads[] = "4";
+
+    double original_time, restructured_time;
+    double original_sum, restructured_sum;
+    t_uint limiter_differences;
+    t_uint round;
+    t_uint num_touching;
+    double scene_difference;
+    double rendered_time, exhaustive_time, slowest_time;
+    double rendered_sum, exhaustive_sum;
+    t_uint64 renders, refreshes;
+    double sample_time, batch_time, sample_sum;
+    double batch_difference, parallel_difference, long_difference;
+    double long_batch_time, long_parallel_time;
+    double double_time, single_time, double_sum, single_sum;
+    double direct_time, table_time, direct_sum, table_sum;
+    double table_difference;
+    double velocity_difference, velocity_time, velocity_sum;
+    struct single_error single_error;
+    char   filename[_MAX_PATH];
+    char   golden[_MAX_PATH];
+    char   line[64];
+    char   message[512];
+    t_uint passes;
+    t_uint num_threads;
+    t_uint index;
+    t_int  result;
+
+    printf("This example measures and checks the kinematics and current limiter of the haptic wand.\n\n");
+
+    printf("Enter the file of recorded joint angles, or press Enter for a synthetic trajectory:\n");
+    read_line(filename, sizeof(filename), "");
+
+    printf("Enter the number of passes over the trajectory [%s]:\n", default_passes);
+    read_line(line, sizeof(line), default_passes);
+    passes = (t_uint) strtoul(line, NULL, 10);
+    if (passes == 0)
+        passes = (t_uint) strtoul(default_passes, NULL, 10);
+
+    printf("Enter the number of threads for the batch kinematics [%s]:\n", default_threads);
+    read_line(line, sizeof(line), default_threads);
+    num_threads = (t_uint) strtoul(line, NULL, 10);
+    if (num_threads == 0 || num_threads > HAPTIC_WAND_MAX_THREADS)
+        num_threads = (t_uint) strtoul(default_threads, NULL, 10);
+
+    printf("Enter the golden output file [%s]:\n", default_golden);
+    read_line(golden, sizeof(golden), default_golden);
+
+    if (filename[0] == '\0')
+    {
+        generate_trajectory();
+        printf("\nUsing a synthetic trajectory of %u samples.\n", num_samples);
+    }
+    else if (load_trajectory(filename) == 0)
+        printf("\nUsing %u samples recorded in \"%s\".\n", num_samples, filename);
+    else
+    {
+        generate_trajectory();
+        printf("\nUnable to read joint angles from \"%s\". Using a synthetic trajectory of %u samples.\n", filename, num_samples);
+    }
+
+    compute_forces();
+    arrange_joint_angles();
+
+    for (index = 0; index < ARRAY_LENGTH(comparisons); index++)
+    {
+        const struct comparison * comparison = &comparisons[index];
+        const double largest_difference = compare_methods(comparison);
+
+        double generated_time, restructured_time;
+        double generated_sum, restructured_sum;
+
+        printf("\n%s:\n", comparison->name);
+        if (largest_difference <= TOLERANCE)
+            printf("    Both methods agree on all %u samples. The largest difference is %.3g.\n", num_samples, largest_difference);
+        else
+            printf("    The results DIFFER by up to %.3g, more than the tolerance of %g.\n", largest_difference, TOLERANCE);
+
+        /* Warm up the caches and branch predictors before timing */
+        time_method(comparison->generated, comparison->num_outputs, 1, &generated_sum);
+        time_method(comparison->restructured, comparison->num_outputs, 1, &restructured_sum);
+
+        generated_time    = time_method(comparison->generated, comparison->num_outputs, passes, &generated_sum);
+        restructured_time = time_method(comparison->restructured, comparison->num_outputs, passes, &restructured_sum);
+
+        print_result("generated:", generated_time, passes);
+        print_result("restructured:", restructured_time, passes);
+        printf("    The restructured kinematics are %.1f times as fast (sums %.6f and %.6f).\n",
+            generated_time / restructured_time, generated_sum, restructured_sum);
+    }
+
+    compare_single(&single_error);
+
+    printf("\nSingle-precision kinematics:\n");
+    printf("    The largest errors over %u samples are %.3g m in position, %.3g rad in orientation and %.3g of the Jacobian.\n",
+        num_samples, single_error.position, single_error.angle, single_error.jacobian);
+    if (within_single_bounds(&single_error))
+        printf("    They are within the bounds of %g m, %g rad and %g.\n",
+            HAPTIC_WAND_FLOAT_POSITION_ERROR, HAPTIC_WAND_FLOAT_ANGLE_ERROR, HAPTIC_WAND_FLOAT_JACOBIAN_ERROR);
+    else
+        printf("    They EXCEED the bounds of %g m, %g rad and %g.\n",
+            HAPTIC_WAND_FLOAT_POSITION_ERROR, HAPTIC_WAND_FLOAT_ANGLE_ERROR, HAPTIC_WAND_FLOAT_JACOBIAN_ERROR);
+
+    time_method(restructured_sample, NUM_JOINTS, 1, &double_sum);
+    time_method(single_sample, NUM_JOINTS, 1, &single_sum);
+
+    double_time = time_method(restructured_sample, NUM_JOINTS, passes, &double_sum);
+    single_time = time_method(single_sample, NUM_JOINTS, passes, &single_sum);
+
+    print_result("double:", double_time, passes);
+    print_result("single:", single_time, passes);
+    printf("    The single-precision kinematics are %.1f times as fast (sums %.6f and %.6f).\n",
+        double_time / single_time, double_sum, single_sum);
+
+    printf("\nSine and cosine tables by encoder count:\n");
+    if (haptic_wand_trig_table_create(&trig_table, count_factors, calibration) != 0)
+        printf("    Unable to build the tables.\n");
+    else
+    {
+        quantize_trajectory();
+        table_difference = compare_trig_table();
+        if (table_difference <= TOLERANCE)
+            printf("    The tables agree with the joint angles on all %u samples. The largest difference is %.3g.\n", 2 * num_samples, table_difference);
+        else
+            printf("    The tables DIFFER from the joint angles by up to %.3g, more than the tolerance of %g.\n", table_difference, TOLERANCE);
+
+        printf("    %-28s %14s %14s\n", "(nsecs per sample)", "Direct", "Tables");
+
+        time_trig(false, trajectory_counts, 1, &direct_sum);
+        time_trig(true, trajectory_counts, 1, &table_sum);
+        direct_time = time_trig(false, trajectory_counts, passes, &direct_sum);
+        table_time  = time_trig(true, trajectory_counts, passes, &table_sum);
+        printf("    %-28s %14.1f %14.1f\n", "along the trajectory", direct_time / ((double) passes * num_samples) * 1e9,
+            table_time / ((double) passes * num_samples) * 1e9);
+
+        direct_time = time_trig(false, random_counts, passes, &direct_sum);
+        table_time  = time_trig(true, random_counts, passes, &table_sum);
+        printf("    %-28s %14.1f %14.1f\n", "at random counts", direct_time / ((double) passes * num_samples) * 1e9,
+            table_time / ((double) passes * num_samples) * 1e9);
+
+        direct_time = time_trig_cold(false, &direct_sum);
+        table_time  = time_trig_cold(true, &table_sum);
+        printf("    %-28s %14.1f %14.1f\n", "with the caches evicted", direct_time * 1e9, table_time * 1e9);
+        printf("    The tables take %u KB, %u KB for each joint.\n",
+            (unsigned) (NUM_JOINTS * HAPTIC_WAND_COUNTS_PER_REVOLUTION * sizeof(double) / 1000),
+            (unsigned) (HAPTIC_WAND_COUNTS_PER_REVOLUTION * sizeof(double) / 1000));
+
+        haptic_wand_trig_table_destroy(&trig_table);
+    }
+
+    run_batch(1);
+    batch_difference = compare_batch();
+    result = run_batch(num_threads);
+    parallel_difference = compare_batch();
+
+    printf("\nBatch forward kinematics:\n");
+    if (result != 0)
+    {
+        msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+        printf("    Unable to start every thread, so the calling thread computed their samples. %s Error %d.\n", message, -result);
+    }
+
+    if (batch_difference <= TOLERANCE && parallel_difference <= TOLERANCE)
+        printf("    The batch agrees with each sample on all %u samples. The largest difference is %.3g.\n", num_samples,
+            (batch_difference > parallel_difference) ? batch_difference : parallel_difference);
+    else
+        printf("    The batch DIFFERS from each sample by up to %.3g, more than the tolerance of %g.\n",
+            (batch_difference > parallel_difference) ? batch_difference : parallel_difference, TOLERANCE);
+
+    time_method(restructured_forward, NUM_WORLD, 1, &sample_sum);
+    time_batch(1, 1);
+
+    sample_time = time_method(restructured_forward, NUM_WORLD, passes, &sample_sum);
+    batch_time  = time_batch(1, passes);
+
+    print_result("each sample:", sample_time, passes);
+    print_result("batch:", batch_time, passes);
+    printf("    The batch is %.1f times as fast as each sample.\n", sample_time / batch_time);
+
+    /*
+        Over a few thousand samples the time to start the threads outweighs the samples each one
+        computes, so the threads are timed over the trajectory repeated to a million samples. Each
+        round times the batch on one thread and divided between the threads, taking turns to go
+        first, and the fastest time of each is kept.
+    */
+    run_batch(1);
+    if (create_long_trajectory() != 0)
+        printf("    Unable to allocate the trajectory repeated to %u samples.\n", LONG_SAMPLES);
+    else
+    {
+        time_long_batch(num_threads);
+        long_difference = compare_long_batch();
+
+        long_batch_time    = -1;
+        long_parallel_time = -1;
+        for (round = 0; round < LONG_ROUNDS; round++)
+        {
+            double batch_round, parallel_round;
+
+            if (round % 2 == 0)
+            {
+                batch_round    = time_long_batch(1);
+                parallel_round = time_long_batch(num_threads);
+            }
+            else
+            {
+                parallel_round = time_long_batch(num_threads);
+                batch_round    = time_long_batch(1);
+            }
+
+            if (long_batch_time < 0 || batch_round < long_batch_time)
+                long_batch_time = batch_round;
+            if (long_parallel_time < 0 || parallel_round < long_parallel_time)
+                long_parallel_time = parallel_round;
+        }
+
+        printf("    Over the trajectory repeated to %u samples:\n", LONG_SAMPLES);
+        if (!(long_difference <= TOLERANCE))
+            printf("    The threads DIFFER from the batch on the trajectory by up to %.3g.\n", long_difference);
+        printf("    %-14s %f seconds (%.1f nsecs per call on one thread)\n", "batch:", long_batch_time,
+            long_batch_time / LONG_SAMPLES * 1e9);
+        printf("    %-14s %f seconds (%.1f nsecs per call on %u threads)\n", "parallel:", long_parallel_time,
+            long_parallel_time / LONG_SAMPLES * 1e9, num_threads);
+        printf("    Divided between %u threads the batch is %.1f times as fast as on one thread, and %.1f times as fast as each sample.\n",
+            num_threads, long_batch_time / long_parallel_time,
+            (sample_time / ((double) passes * num_samples)) / (long_parallel_time / LONG_SAMPLES));
+    }
+    destroy_long_trajectory();
+
+    limiter_differences = compare_limiters();
+
+    printf("\nCurrent limiter:\n");
+    if (limiter_differences == 0)
+        printf("    Both limiters give exactly the same currents and states on all %u samples.\n", num_samples + LIMITER_SAMPLES);
+    else
+        printf("    The limiters DIFFER on %u of %u samples.\n", limiter_differences, num_samples + LIMITER_SAMPLES);
+
+    time_limiter(true, 1, &original_sum);
+    time_limiter(false, 1, &restructured_sum);
+
+    /*
+        Each limiter takes only a few nanoseconds per call, so one timing of each is easily swayed
+        by interrupts, frequency changes and by whichever limiter ran just before it. The limiters
+        are timed over several rounds, taking turns to go first, and the fastest time of each is
+        kept.
+    */
+    original_time     = -1;
+    restructured_time = -1;
+    for (round = 0; round < LIMITER_ROUNDS; round++)
+    {
+        double original_round, restructured_round;
+
+        if (round % 2 == 0)
+        {
+            original_round     = time_limiter(true, passes, &original_sum);
+            restructured_round = time_limiter(false, passes, &restructured_sum);
+        }
+        else
+        {
+            restructured_round = time_limiter(false, passes, &restructured_sum);
+            original_round     = time_limiter(true, passes, &original_sum);
+        }
+
+        if (original_time < 0 || original_round < original_time)
+            original_time = original_round;
+        if (restructured_time < 0 || restructured_round < restructured_time)
+            restructured_time = restructured_round;
+    }
+
+    print_result("original:", original_time, passes);
+    print_result("restructured:", restructured_time, passes);
+    printf("    The restructured limiter is %.1f times as fast (sums %.6f and %.6f).\n",
+        original_time / restructured_time, original_sum, restructured_sum);
+
+    printf("\nVelocity estimation:\n");
+    velocity_difference = 0;
+    for (index = 0; index < 4; index++)
+    {
+        const double difference = compare_velocity_step(index >= 2, (index % 2 == 0) ? 1 : 3);
+        if (!(difference <= velocity_difference))
+            velocity_difference = difference;
+    }
+
+    if (velocity_difference <= VELOCITY_TOLERANCE)
+        printf("    Both filters follow the exact step response, with and without skipped samples. The largest difference is %.3g.\n",
+            velocity_difference);
+    else
+        printf("    The filters DIFFER from the exact step response by up to %.3g, more than the tolerance of %g.\n",
+            velocity_difference, VELOCITY_TOLERANCE);
+
+    /*
+        The filtered difference computes an exponential after skipped samples, and the least-squares
+        fit takes time in proportion to its window, so the largest window bounds the time per sample.
+    */
+    printf("    %-44s %14s\n", "(nsecs per sample, with world velocity)", "Time");
+    for (index = 0; index < 4; index++)
+    {
+        static const char * const names[] = { "filtered difference", "filtered difference, skipping", "least squares", "least squares, largest window" };
+        const t_boolean least_squares = (index >= 2);
+        const t_uint32  window        = (index == 3) ? VELOCITY_ESTIMATOR_MAX_WINDOW : VELOCITY_WINDOW;
+        const t_uint32  skip          = (index == 1) ? 2 : 1;
+        char name[64];
+
+        if (least_squares)
+            snprintf(name, sizeof(name), "%s (%u samples)", names[index], window);
+        else
+            snprintf(name, sizeof(name), "%s", names[index]);
+
+        time_velocity(least_squares, window, skip, 1, &velocity_sum);
+        velocity_time = time_velocity(least_squares, window, skip, passes, &velocity_sum);
+        printf("    %-44s %14.1f\n", name, velocity_time / ((double) passes * num_samples) * 1e9);
+    }
+
+    printf("\nVirtual scene:\n");
+    if (build_scene() != 0)
+        printf("    Unable to build the virtual scene.\n");
+    else
+    {
+        generate_walk();
+        printf("    The scene holds %u objects: a floor and %u spheres, boxes and triangles in a hierarchy of %u nodes.\n",
+            scene.num_objects, scene.num_primitives, scene.num_nodes);
+
+        scene_difference = compare_scene(&num_touching);
+        if (scene_difference <= TOLERANCE)
+            printf("    Rendering agrees with testing every primitive on all %u samples of a random walk, %u of them in contact. The largest difference is %.3g.\n",
+                SCENE_SAMPLES, num_touching, scene_difference);
+        else
+            printf("    Rendering DIFFERS from testing every primitive by up to %.3g, more than the tolerance of %g.\n", scene_difference, TOLERANCE);
+
+        time_scene(false, 1, &rendered_sum);
+        renders   = scene.renders;
+        refreshes = scene.refreshes;
+
+        rendered_time   = time_scene(false, passes, &rendered_sum);
+        exhaustive_time = time_scene(true, 1, &exhaustive_sum);
+        slowest_time    = time_scene_slowest();
+
+        renders   = scene.renders - renders;
+        refreshes = scene.refreshes - refreshes;
+
+        /* The exhaustive search is only timed for one pass of the walk, so only the times per render are comparable */
+        rendered_time   /= (double) passes * SCENE_SAMPLES;
+        exhaustive_time /= SCENE_SAMPLES;
+
+        printf("    %-14s %.1f nsecs per render\n", "rendered:", rendered_time * 1e9);
+        printf("    %-14s %.1f nsecs per render\n", "exhaustive:", exhaustive_time * 1e9);
+        printf("    Rendering is %.1f times as fast as testing every primitive (sums %.6f and %.6f).\n",
+            exhaustive_time / rendered_time, rendered_sum / passes, exhaustive_sum);
+        printf("    The hierarchy was searched at %.2f%% of the renders. The slowest render took %.1f usecs of the %.0f usec sampling period.\n",
+            100.0 * (double) refreshes / (double) renders, slowest_time * 1e6, PERIOD * 1e6);
+
+        haptic_scene_destroy(&scene);
+    }
+
+    printf("\nChecking against the golden outputs in \"%s\":\n", golden);
+    result = check_golden(golden);
+    if (result < 0)
+    {
+        if (write_golden(golden) == 0)
+            printf("    The file does not exist, so it has been written from the generated expressions.\n");
+        else
+            printf("    Unable to read or write the file.\n");
+    }
+    else if (result > 0)
+        printf("    PASSED: every result is within the tolerance of its group and the limited currents match exactly.\n");
+    else
+        printf("    FAILED: some results differ from the golden outputs by more than the tolerance of their group.\n");
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+//////////////////////////////////////////////////////////////////
+//
+//	haptic_wand_kinematics_performance.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "quanser_types.h"
+#include "quanser_file.h"
+#include "quanser_messages.h"
+#include "quanser_string.h"
+#include "quanser_time.h"
+
+#include "haptic_wand.h"
+#include "haptic_wand_kinematics.h"
+#include "haptic_wand_kinematics_float.h"
+#include "haptic_wand_limiter.h"
+#include "haptic_wand_scene.h"
+#include "haptic_wand_trig_table.h"
+#include "haptic_wand_velocity.h"
+#include "haptic_wand_reference.h"
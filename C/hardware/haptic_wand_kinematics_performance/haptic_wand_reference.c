@@ -0,0 +1,697 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_reference.c - C file
+//
+// The kinematics of the Quanser 5DOF Haptic Wand exactly as they were
+// generated by a computer algebra system for the haptic_wand_example.
+// They serve as the reference against which the kinematics in
+// haptic_wand_kinematics.c are checked and timed. The current limiter
+// as it was originally written for the haptic_wand_example serves the
+// same purpose for the limiter in haptic_wand_limiter.c.
+//
+// Copyright (C) 2008 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <math.h>
+
+#include "haptic_wand_reference.h"
+
+static const double l[7] = { L1, L2, L3, L4, L5, L6, L7 }; /* link lengths of the haptic wand links */
+
+/*
+    Compute the end-effector position and orientation, X, from the joint angles, theta.
+*/
+void
+reference_forward_kinematics(const double theta[NUM_JOINTS], double X[NUM_WORLD])
+{
+    X[0] = l[4] / 0.2e1 + cos(theta[2]) * l[0] / 0.2e1 + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1] / 0.2e1 + cos(theta[0]) * l[0] / 0.2e1 + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] / 0.2e1;
+    X[1] = cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[5]) * (-l[6] + l[3]) / 0.2e1 + cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[4]) * (l[6] - l[3]) / 0.2e1;
+    X[2] = sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 + cos(theta[5]) * (-l[6] + l[3]) / 0.2e1 + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 + cos(theta[4]) * (l[6] - l[3]) / 0.2e1;
+    X[3] = -atan((cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])));
+    X[4] = atan((cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])));
+}
+
+/*
+    Compute the motor torques, tau, from the end-effector generalized forces, F. Since this conversion
+    is configuration-dependent, the joint tangles, theta, are required.
+*/
+void
+reference_inverse_force_kinematics(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS])
+{
+    double J[NUM_WORLD][NUM_JOINTS]; /* Jacobian */
+
+    J[0][0] = -sin(theta[0]) * l[0] / 0.2e1 - sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin
+      (theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * 
+      (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 *
+      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * 
+      pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), 
+      -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4
+      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4]
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[0][1] = -sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
+      ], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[
+      0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 
+      0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1
+      ]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0
+      ]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0
+      ] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[0][2] = -sin(theta[2]) * l[0] / 0.2e1
+      - sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(
+      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3
+      ]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[
+      0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l
+      [0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) *
+      l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
+      [0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[0][3] = -sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin
+      (theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * 
+      (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * 
+      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * 
+      pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), 
+      -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[
+      4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4
+      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[0][4] = 0.0e0;
+
+    J[0][5] = 0.0e0;
+  
+    J[1][0] = cos(theta[4]) * (cos(theta[0]) * 
+      l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 
+      0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - 
+      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]
+      ) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0
+      ]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta
+      [1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[
+      1]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
+
+    J[1][1] = cos(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin
+      (theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 
+      0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * 
+      cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) 
+      * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) *
+      l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[1][2] = cos(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
+      [0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0])
+      * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(
+      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4]
+      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1)
+      * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1
+      ))) * l[1]) / 0.2e1;
+
+    J[1][3] = cos(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] 
+      - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) 
+      * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1
+      * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0
+      ]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1
+      ), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * 
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * 
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / 0.2e1;
+
+    J[1][4] = -sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[
+      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[
+      0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) / 0.2e1 - cos(theta[4]) * (l[6] - l[3]) / 0.2e1;
+
+    J[1][5] = -sin(
+      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3
+      ]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1
+      - cos(theta[5]) * (-l[6] + l[3]) / 0.2e1;
+
+    J[2][0] = sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) 
+      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] +
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]
+      ) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[
+      0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - 
+      sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + 
+      (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta
+      [0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
+
+    J[2][1] = sin(theta[4]) * cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
+      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[
+      1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) *
+      l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - 
+      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] 
+      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
+      ], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
+      , -0.2e1))) * l[1] / 0.2e1;
+
+    J[2][2] = sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
+       + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * 
+      l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
+      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3
+      ]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
+      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l
+      [0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / 0.2e1;
+
+    J[2][3] = sin(theta[5]) * cos(PI - acos(sqrt
+      (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2
+      ]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
+      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(
+      theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) *
+      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin
+      (theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[
+      1] / 0.2e1;
+
+    J[2][4] = cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) 
+      * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta
+      [1]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[4]) * (l[6] - l[3]) / 0.2e1;
+
+    J[2][5] = cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) / 0.2e1 - sin(theta[5]) * (-l[6] + l[3]) / 0.2e1;
+
+    J[3][0] = -(cos(theta[4
+      ]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[
+      0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (
+      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) 
+      / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[
+      0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0
+      ]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos
+      (theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l
+      [4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(
+      l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * 
+      l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[4]) * (sin(theta[
+      0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin
+      (theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1
+      ]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
+      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0]
+      - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(
+      PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
+      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * 
+      sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow
+      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4
+      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(
+      0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1)
+      , -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow
+      (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(
+      l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
+      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] +
+      sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
+      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) *
+      pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0
+      ] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))
+      ) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0],
+      0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2])
+      * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[3][1] = -(cos(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0])
+      * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) 
+      * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l
+      [0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * 
+      (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / 
+      (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]
+      ) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0
+      ], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4
+      ]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta
+      [2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]
+      ) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)
+      ) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6
+      ] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[
+      0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0])
+      )) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] 
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
+      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] 
+      - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[4]) * cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l
+      [0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) 
+      * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0]
+      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0
+      ], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
+      , -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) +
+      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] -
+      cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] -
+      cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) /
+      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + 
+      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
+      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
+      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
+      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(
+      theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[3][2] = -(-cos(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * 
+      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0
+      ], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(
+      theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * 
+      l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0
+      ] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin
+      (theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[
+      3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
+      cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + 
+      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] 
+      - cos(theta[1]) * l[0]))) * l[
+      1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1
+      ) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[
+      0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + 
+      sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + 
+      atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) 
+      * sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (
+      l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * 
+      pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1
+      ), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * 
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow
+      (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
+      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] 
+      + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1)
+      * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l
+      [0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]
+      ))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0
+      ], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[
+      2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[3][3] = -(-cos(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) 
+      * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) 
+      * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2
+      ]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 
+      * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - 
+      cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) 
+      / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(
+      theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1])
+      * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(
+      theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(
+      theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(
+      theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos
+      (theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1
+      )) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[
+      6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l
+      [0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]
+      ))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4]
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
+      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] 
+      - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[5]) * cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
+      [0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) 
+      * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(
+      theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0
+      ] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l
+      [0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[
+      0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1)
+      + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0]
+      - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0]
+      - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0])
+      / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] +
+      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
+      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
+      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
+      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5])
+      * (-l[6] + l[3]), -0.2e1));
+
+    J[3][4] = -((-sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) *
+      l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - cos(theta[4]) * (l[6] - l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4]
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] 
+      - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[
+      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - 
+      (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) 
+      - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + 
+      pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] -
+      cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta
+      [0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta
+      [1]) * l[0]) / (l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (cos(theta[4]) * (sin(theta[
+      0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[
+      1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[
+      3]))) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta
+      [0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]
+      ) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3
+      ]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (
+      sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0
+      ], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5
+      ]) * (-l[6] + l[3]), -0.2e1));
+
+    J[3][5] = -((sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0
+      ], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[
+      2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + cos(theta[5]) * (-l[6] + l[3])) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] +
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - 
+      sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0]
+      + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos
+      (theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[
+      1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) - 
+      sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos
+      (theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]
+      ) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]
+      ) * l[0]) / (l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (-cos(theta[5]) * (sin(theta
+      [2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l
+      [1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + 
+      l[3]))) / (0.1e1 + pow(cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[
+      1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3]) - cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta
+      [3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3]), 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * 
+      (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l
+      [0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta
+      [5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[4][0] = ((-sin(theta[0]) * l[0] - sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1
+      ]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[
+      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] +
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1
+      - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1)
+      / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0]
+      - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0])
+      / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]
+      ) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[0]) * l[0] + 
+      cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1]
+      / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI 
+      - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[
+      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - 
+      sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta
+      [3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
+      cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[4]) * (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1)
+      + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) *
+      l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)
+      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[0]) * l[0] + 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1
+      ]) * l[0]) * cos(theta[0]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * 
+      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[0]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) + (sin(theta
+      [0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[0]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l
+      [0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI -
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4
+      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0
+      ] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI 
+      - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) 
+      * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0],
+      0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) 
+      * (-l[6] + l[3]), -0.2e1));
+
+    J[4][1] = (-sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(
+      theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(
+      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l
+      [4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * 
+      pow(0.4e1 - (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1
+      / 0.2e1) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4]
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] +
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * 
+      l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * 
+      l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos
+      (sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
+      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) - (cos(theta[0]) * l
+      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(
+      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]
+      ) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta
+      [2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l
+      [1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + 
+      l[3]), -0.2e1) * sin(theta[4]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) 
+      * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * (pow(pow(l[4] 
+      + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos
+      (theta[0]) * l[0] - cos(theta[1]) * l[0]) * sin(theta[1]) * l[0] - 0.2e1 * (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * cos(theta[1]) * l[0]) * pow(0.4e1 -
+      (pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1
+      ) / 0.2e1 + (-cos(theta[1]) * l[0] / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]) - (sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) * pow(l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1) * sin(theta[1]) * l[0]) / (0.1e1 + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1) * pow(l[4] + 
+      cos(theta[0]) * l[0] - cos(theta[1]) * l[0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4
+      ] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 
+      0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2])
+      * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(
+      theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[
+      4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l
+      [4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l
+      [0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[4][2] = ((sin(
+      theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) /
+      l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * 
+      l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0]
+      - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(
+      theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - 
+      cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos
+      (theta[3]) * l[0], -0.2e1))) * l[1]) / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[
+      0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta
+      [0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[0]) * l[0] + cos(PI - acos(sqrt(
+      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] 
+      / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI 
+      - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[
+      0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - 
+      sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta
+      [3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - 
+      cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * sin(theta[5]) * (cos(theta[2]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1)
+      + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) *
+      l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
+      , -0.1e1 / 0.2e1) / l[1] * (-0.2e1 * (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[2]) * l[0] + 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3
+      ]) * l[0]) * cos(theta[2]) * l[0]) * pow(0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
+      l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1) / 0.2e1 + (cos(theta[2]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) + (sin(theta[
+      2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[2]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[
+      0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4
+      ] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0
+      ] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI 
+      - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((
+      sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) 
+      * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0],
+      0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) 
+      * (-l[6] + l[3]), -0.2e1));
+
+    J[4][3] = (sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[
+      4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow
+      (0.4e1 - (pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1
+      / 0.2e1) / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] 
+      + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] +
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1] / (l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * 
+      l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * 
+      l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos
+      (sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
+      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3])) + (cos(theta[0]) * l
+      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(
+      pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0])
+      * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2
+      ]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1
+      ] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[
+      3]), -0.2e1) * sin(theta[5]) * cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * 
+      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * (pow(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1), -0.1e1 / 0.2e1) / l[1] * (0.2e1 * (l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0]) * sin(theta[3]) * l[0] - 0.2e1 * (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * cos(theta[3]) * l[0]) * pow(0.4e1 - (
+      pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) * pow(l[1], -0.2e1), -0.1e1 / 0.2e1)
+      / 0.2e1 + (-cos(theta[3]) * l[0] / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]) - (sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) * pow(l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0], -0.2e1) * sin(theta[3]) * l[0]) / (0.1e1 + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1) * pow(l[4] + cos(theta
+      [2]) * l[0] - cos(theta[3]) * l[0], -0.2e1))) * l[1]) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1])
+      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + 
+      pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] -
+      cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1])
+      * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(
+      theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(
+      theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    J[4][4] = -(cos(theta[0]) * l
+      [0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+      + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
+      theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] +
+      sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) +
+      atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(
+      theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) *
+      l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(
+      theta[5]) * (-l[6] + l[3]), -0.2e1) * (cos(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) +
+      pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] -
+      cos(theta[1]) * l[0]))) * l[1]) - sin(theta[4]) * (l[6] - l[3])) / (0.1e1 + pow(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - 
+      cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (
+      l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + 
+      cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (
+      sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)
+      ) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (
+      -l[6] + l[3]), -0.2e1));
+
+    J[4][5] = -(cos(theta[0]) * l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(
+      theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1
+      ]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - 
+      sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[
+      1]) * pow(l[5] + sin(theta[4]) * (sin(theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0])
+      * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l
+      [0]))) * l[1]) + cos(theta[4]) * (l[6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * 
+      l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(
+      theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1) * (-cos(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l
+      [4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l
+      [0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1]) + sin(theta[5]) * (-l[6] + l[3])) / (0.1e1 + pow(cos(theta[0]) * 
+      l[0] + cos(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1)) / l[1] / 0.2e1)
+       + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1] - cos(theta[2]) * l[0] - cos(PI - 
+      acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l[0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) 
+      + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]))) * l[1], 0.2e1) * pow(l[5] + sin(theta[4]) * (sin
+      (theta[0]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0], 0.2e1) + pow(sin(theta[0]) * l[0] - sin(theta[1]) * l[0], 0.2e1
+      )) / l[1] / 0.2e1) + atan((sin(theta[0]) * l[0] - sin(theta[1]) * l[0]) / (l[4] + cos(theta[0]) * l[0] - cos(theta[1]) * l[0]))) * l[1]) + cos(theta[4]) * (l[
+      6] - l[3]) - sin(theta[5]) * (sin(theta[2]) * l[0] + sin(PI - acos(sqrt(pow(l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0], 0.2e1) + pow(sin(theta[2]) * l
+      [0] - sin(theta[3]) * l[0], 0.2e1)) / l[1] / 0.2e1) + atan((sin(theta[2]) * l[0] - sin(theta[3]) * l[0]) / (l[4] + cos(theta[2]) * l[0] - cos(theta[3]) * l[0]
+      ))) * l[1]) - cos(theta[5]) * (-l[6] + l[3]), -0.2e1));
+
+    tau[0] = J[0][0]*F[0] + J[1][0]*F[1] + J[2][0]*F[2] + J[3][0]*F[3] + J[4][0]*F[4];
+	tau[1] = J[0][1]*F[0] + J[1][1]*F[1] + J[2][1]*F[2] + J[3][1]*F[3] + J[4][1]*F[4];
+	tau[2] = J[0][2]*F[0] + J[1][2]*F[1] + J[2][2]*F[2] + J[3][2]*F[3] + J[4][2]*F[4];
+	tau[3] = J[0][3]*F[0] + J[1][3]*F[1] + J[2][3]*F[2] + J[3][3]*F[3] + J[4][3]*F[4];
+	tau[4] = J[0][4]*F[0] + J[1][4]*F[1] + J[2][4]*F[2] + J[3][4]*F[3] + J[4][4]*F[4];
+	tau[5] = J[0][5]*F[0] + J[1][5]*F[1] + J[2][5]*F[2] + J[3][5]*F[3] + J[4][5]*F[4]; 
+}
+
+/*
+    Limit the motor currents with the original state machine of each motor.
+*/
+void
+reference_limit_currents(struct limiter_state current_limiters[NUM_JOINTS], double dt, double motor_currents[NUM_JOINTS])
+{
+    static const double current_limit_1[NUM_JOINTS]  = {LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_SMALL,   LIMIT_1_LARGE,   LIMIT_1_LARGE};
+    static const double current_limit_2[NUM_JOINTS]  = {LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_SMALL,   LIMIT_2_LARGE,   LIMIT_2_LARGE};
+    static const double timeout_1[NUM_JOINTS]        = {TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_SMALL, TIMEOUT_1_LARGE, TIMEOUT_1_LARGE};
+    static const double timeout_2[NUM_JOINTS]        = {TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_SMALL, TIMEOUT_2_LARGE, TIMEOUT_2_LARGE};
+
+    int index;
+    for (index = NUM_JOINTS-1; index >= 0; --index)
+    {
+        double value = fabs(motor_currents[index]);
+
+        switch (current_limiters[index].state)
+        {
+        case 0: // Limiting to the upper limits and waiting for input to exceed lower limits
+            if (value > current_limit_2[index])
+            {
+                current_limiters[index].state = 1;
+                current_limiters[index].time  = 0;
+                current_limiters[index].count = 0;
+                current_limiters[index].mean  = value;
+
+                if (value > current_limit_1[index])
+                    motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
+                else
+                    motor_currents[index] = motor_currents[index];
+            }
+            else
+                motor_currents[index] = motor_currents[index];
+
+            break;
+
+        case 1: // Limiting to the upper limits and waiting for peak time limit
+            current_limiters[index].mean += value;
+            current_limiters[index].time += dt;
+            current_limiters[index].count++;
+
+            if (current_limiters[index].time >= timeout_1[index])
+            {
+                current_limiters[index].mean /= current_limiters[index].count + 1;
+                if (current_limiters[index].mean > current_limit_2[index])
+                {
+                    current_limiters[index].state = 2;
+                    current_limiters[index].time  = 0;
+                    current_limiters[index].count = 0;
+                    motor_currents[index] = (motor_currents[index] > 0) ? current_limit_2[index] : -current_limit_2[index];
+                }
+                else
+                {
+                    current_limiters[index].state = 0;
+                    motor_currents[index] = motor_currents[index];
+                }
+            }
+            else if (value > current_limit_1[index])
+                motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
+            else
+                motor_currents[index] = motor_currents[index];
+
+            break;
+
+        case 2: // Limiting to the lower limits and waiting for motors to recover
+            current_limiters[index].time += dt;
+            current_limiters[index].count++;
+
+            if (current_limiters[index].time >= timeout_2[index])
+            {
+                if (value > current_limit_2[index])
+                {
+                    current_limiters[index].state = 1;
+                    current_limiters[index].time  = 0;
+                    current_limiters[index].count = 0;
+                    current_limiters[index].mean  = value;
+
+                    if (value > current_limit_1[index])
+                        motor_currents[index] = (motor_currents[index] > 0) ? current_limit_1[index] : -current_limit_1[index];
+                    else
+                        motor_currents[index] = motor_currents[index];
+                }
+                else
+                {
+                    current_limiters[index].state = 0;
+                    motor_currents[index] = motor_currents[index];
+                }
+            }
+            else if (value > current_limit_2[index])
+                motor_currents[index] = (motor_currents[index] > 0) ? current_limit_2[index] : -current_limit_2[index];
+            else
+                motor_currents[index] = motor_currents[index];
+
+            break;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////
+//
+// haptic_wand_reference.h - header file
+//
+// The kinematics and current limiter of the Quanser 5DOF Haptic Wand as
+// originally written for the haptic_wand_example, kept for comparison.
+//
+// Copyright (C) 2008 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _haptic_wand_reference_h
+#define _haptic_wand_reference_h
+
+#include "haptic_wand.h"
+
+/*
+    Compute the end-effector position and orientation, X, from the joint angles, theta.
+*/
+extern void
+reference_forward_kinematics(const double theta[NUM_JOINTS], double X[NUM_WORLD]);
+
+/*
+    Compute the motor torques, tau, from the end-effector generalized forces, F, at the joint
+    angles, theta.
+*/
+extern void
+reference_inverse_force_kinematics(const double theta[NUM_JOINTS], const double F[NUM_WORLD], double tau[NUM_JOINTS]);
+
+/*
+    The state of the current limiter of one motor. Zero the structure before the first call.
+*/
+struct limiter_state
+{
+    double mean;    /* sum and then mean of the currents while at the peak limit */
+    double time;    /* time spent in the current state in seconds */
+    int    count;   /* samples spent in the current state */
+    int    state;   /* 0 when below the continuous limit, 1 at the peak limit, 2 while cooling */
+};
+
+/*
+    Limit the motor currents such that the thermal rating for the motors is not exceeded
+    while continuing to provide the peak torque when necessary. The currents are in amps and dt
+    is the time since the previous call in seconds.
+*/
+extern void
+reference_limit_currents(struct limiter_state current_limiters[NUM_JOINTS], double dt, double motor_currents[NUM_JOINTS]);
+
+#endif
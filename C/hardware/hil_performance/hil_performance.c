@@ -0,0 +1,735 @@
+//////////////////////////////////////////////////////////////////
+//
+// hil_performance.c - C file
+//
+// This example measures how quickly the immediate I/O functions may be
+// called, combining the hil_read_analog_performance,
+// hil_read_digital_performance, hil_read_encoder_performance,
+// hil_write_analog_performance and hil_write_digital_performance
+// examples into a single benchmark that also covers hil_read and
+// hil_write.
+//
+// The sweep benchmark is run by default. The board, the operations, the
+// channel counts and the iteration counts are entered at the start, and
+// every operation is run for every combination of channel count and
+// iteration count. The first channel_count channels of the board are
+// used. The default runs every operation with 1, 2, 4 and 8 channels.
+// The time taken by each call is recorded in a latency histogram, and
+// one table comparing all the runs is printed, so the I/O path of a new
+// board or kernel may be qualified with a single run.
+//
+// The scaling benchmark instead reads 1, 2, 3 and so on up to the
+// largest channel count entered with hil_read_analog, hil_read_digital,
+// hil_read_encoder and hil_read, and fits a straight line to the median
+// latency at each count. The intercept is the fixed cost of each call
+// and the slope the cost of each extra channel. From these it prints
+// whether the controllers should merge their separate reads into a
+// single hil_read, and above or below how many channels of each type.
+//
+// If a file name is given on the command line, the results of every
+// run, including their latency histograms, are also written to that
+// file as JSON so that runs may be compared by a script.
+//
+// This performance example demonstrates the use of the following functions:
+//    hil_open
+//    hil_read_analog
+//    hil_read_digital
+//    hil_read_encoder
+//    hil_write_analog
+//    hil_write_digital
+//    hil_read
+//    hil_write
+//    hil_close
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include "hil_performance.h"
+
+#define MAX_CHANNELS        16      /* most channels of each type used in a call */
+#define MAX_COUNTS          16      /* most channel counts or iteration counts entered */
+#define WARM_UP_ITERATIONS  100     /* calls made before each run that are not timed */
+
+/*
+    The channels used by a run and the values read or written.
+*/
+struct io_buffers
+{
+    t_uint32  channels[MAX_CHANNELS];
+    t_double  voltages[MAX_CHANNELS];
+    t_int32   counts[MAX_CHANNELS];
+    t_boolean values[MAX_CHANNELS];
+};
+
+typedef t_error (*t_io_function)(t_card board, struct io_buffers * buffers, t_uint32 num_channels);
+
+static t_error
+perform_read_analog(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_read_analog(board, buffers->channels, num_channels, buffers->voltages);
+}
+
+static t_error
+perform_read_digital(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_read_digital(board, buffers->channels, num_channels, buffers->values);
+}
+
+static t_error
+perform_read_encoder(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_read_encoder(board, buffers->channels, num_channels, buffers->counts);
+}
+
+static t_error
+perform_write_analog(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_write_analog(board, buffers->channels, num_channels, buffers->voltages);
+}
+
+static t_error
+perform_write_digital(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_write_digital(board, buffers->channels, num_channels, buffers->values);
+}
+
+/*
+    Reads num_channels analog inputs, encoder inputs and digital inputs in one call.
+*/
+static t_error
+perform_read(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_read(board, buffers->channels, num_channels, buffers->channels, num_channels,
+        buffers->channels, num_channels, NULL, 0, buffers->voltages, buffers->counts, buffers->values, NULL);
+}
+
+/*
+    Writes num_channels analog outputs and digital outputs in one call.
+*/
+static t_error
+perform_write(t_card board, struct io_buffers * buffers, t_uint32 num_channels)
+{
+    return hil_write(board, buffers->channels, num_channels, NULL, 0,
+        buffers->channels, num_channels, NULL, 0, buffers->voltages, NULL, buffers->values, NULL);
+}
+
+/*
+    The operations that may be benchmarked, in the order in which they are run. The operation_type
+    enumeration must be kept in the same order as the table.
+*/
+enum operation_type
+{
+    OPERATION_READ_ANALOG,
+    OPERATION_READ_DIGITAL,
+    OPERATION_READ_ENCODER,
+    OPERATION_WRITE_ANALOG,
+    OPERATION_WRITE_DIGITAL,
+    OPERATION_READ,
+    OPERATION_WRITE
+};
+
+static const struct
+{
+    const char *  name;
+    t_io_function perform;
+} operations[] =
+{
+    { "hil_read_analog",   perform_read_analog   },
+    { "hil_read_digital",  perform_read_digital  },
+    { "hil_read_encoder",  perform_read_encoder  },
+    { "hil_write_analog",  perform_write_analog  },
+    { "hil_write_digital", perform_write_digital },
+    { "hil_read",          perform_read          },
+    { "hil_write",         perform_write         }
+};
+
+#define NUM_OPERATIONS  ARRAY_LENGTH(operations)
+
+static int stop = 0;
+
+void signal_handler(int signal)
+{
+    stop = 1;
+}
+
+/*
+    Read a line from the console, using the default if nothing is entered.
+*/
+static void
+read_line(char * line, size_t length, const char * default_line)
+{
+    fgets(line, (int) length, stdin); /* use fgets to avoid deprecation warnings that occur on some systems */
+    line[string_length(line, length) - 1] = '\0';
+    if (line[0] == '\0')
+        string_copy(line, length, default_line);
+}
+
+/*
+    Parse a list of positive numbers separated by commas or spaces. Returns the number of numbers
+    parsed or -1 if the list is invalid.
+*/
+static t_int
+parse_counts(const char * line, t_uint32 counts[], t_uint32 max_counts, t_uint32 max_value)
+{
+    t_uint32 num_counts = 0;
+    char * end;
+
+    for (;;)
+    {
+        unsigned long count;
+
+        line += strspn(line, ", \t");
+        if (*line == '\0')
+            break;
+
+        count = strtoul(line, &end, 10);
+        if (end == line || count == 0 || count > max_value || num_counts == max_counts)
+            return -1;
+
+        counts[num_counts++] = (t_uint32) count;
+        line = end;
+    }
+
+    return (num_counts > 0) ? (t_int) num_counts : -1;
+}
+
+/*
+    Select the operations named in a list separated by commas or spaces, or every operation
+    if the list is "all". Returns the number of operations selected or -1 if a name is not
+    recognized.
+*/
+static t_int
+parse_operations(const char * line, t_boolean selected[])
+{
+    t_int num_selected = 0;
+    t_uint index;
+
+    line += strspn(line, ", \t");
+    if (strcmp(line, "all") == 0)
+    {
+        for (index = 0; index < NUM_OPERATIONS; index++)
+            selected[index] = true;
+        return NUM_OPERATIONS;
+    }
+
+    memset(selected, 0, NUM_OPERATIONS * sizeof(selected[0]));
+    while (*line != '\0')
+    {
+        const size_t length = strcspn(line, ", \t");
+
+        for (index = 0; index < NUM_OPERATIONS; index++)
+        {
+            /* The "hil_" prefix may be omitted */
+            const char * name = operations[index].name + 4;
+            if ((length == strlen(name) && strncmp(line, name, length) == 0)
+                || (length == strlen(operations[index].name) && strncmp(line, operations[index].name, length) == 0))
+                break;
+        }
+
+        if (index == NUM_OPERATIONS)
+            return -1;
+
+        if (!selected[index])
+        {
+            selected[index] = true;
+            num_selected++;
+        }
+
+        line += length;
+        line += strspn(line, ", \t");
+    }
+
+    return (num_selected > 0) ? num_selected : -1;
+}
+
+/*
+    Call the operation the given number of times, recording the time taken by each call in the
+    histogram. Returns the result of the last call, which is negative if a call failed.
+*/
+static t_error
+run_operation(t_card board, t_io_function perform, struct io_buffers * buffers, t_uint32 num_channels,
+              t_uint32 iterations, struct latency_histogram * histogram)
+{
+    t_timeout previous_time;
+    t_error result = 0;
+    t_uint32 index;
+
+    /* Warm up the driver and caches so the first calls do not skew the results */
+    for (index = WARM_UP_ITERATIONS; index > 0 && result >= 0; --index)
+        result = perform(board, buffers, num_channels);
+
+    latency_histogram_start(histogram, &previous_time);
+
+    for (index = iterations; index > 0 && result >= 0 && !stop; --index)
+    {
+        result = perform(board, buffers, num_channels);
+        latency_histogram_record_call(histogram, &previous_time);
+    }
+
+    return result;
+}
+
+static void
+print_table_header(void)
+{
+    printf("%-18s %8s %10s %10s %9s %9s %9s %9s %9s %9s %9s\n", "Operation", "Channels", "Iterations",
+        "Rate (Hz)", "Mean", "Min", "p50", "p99", "p99.9", "Max", "Std dev");
+    printf("%-18s %8s %10s %10s %9s %9s %9s %9s %9s %9s %9s\n", "", "", "", "", "(usecs)", "(usecs)",
+        "(usecs)", "(usecs)", "(usecs)", "(usecs)", "(usecs)");
+}
+
+static void
+print_table_row(const char * operation, t_uint32 num_channels, const struct latency_histogram * histogram)
+{
+    const t_double mean = latency_histogram_mean(histogram);
+
+    printf("%-18s %8u %10.0f %10.0f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n", operation, num_channels,
+        (double) histogram->count, (mean > 0) ? 1e9 / mean : 0.0, mean * 1e-3, histogram->minimum * 1e-3,
+        latency_histogram_percentile(histogram, 50) * 1e-3, latency_histogram_percentile(histogram, 99) * 1e-3,
+        latency_histogram_percentile(histogram, 99.9) * 1e-3, histogram->maximum * 1e-3,
+        latency_histogram_standard_deviation(histogram) * 1e-3);
+}
+
+
+/*
+    Run each selected operation for every combination of channel count and iteration count,
+    printing a row of the table for each run.
+*/
+static void
+run_sweep(t_card board, struct io_buffers * buffers, const t_boolean selected[],
+          const t_uint32 channel_counts[], t_uint32 num_channel_counts,
+          const t_uint32 iteration_counts[], t_uint32 num_iteration_counts, FILE * json)
+{
+    static struct latency_histogram histogram;
+    static char message[512];
+
+    const char * separator = "";
+    t_uint operation, channel_index, iteration_index;
+    t_error result;
+
+    if (json != NULL)
+        fprintf(json, "\"results\": [");
+
+    print_table_header();
+
+    for (operation = 0; operation < NUM_OPERATIONS && !stop; operation++)
+    {
+        if (!selected[operation])
+            continue;
+
+        for (channel_index = 0; channel_index < num_channel_counts && !stop; channel_index++)
+        {
+            for (iteration_index = 0; iteration_index < num_iteration_counts && !stop; iteration_index++)
+            {
+                const t_uint32 num_channels = channel_counts[channel_index];
+
+                result = run_operation(board, operations[operation].perform, buffers, num_channels,
+                    iteration_counts[iteration_index], &histogram);
+                if (result < 0)
+                {
+                    /* Boards have different numbers of channels, so report the failure and carry on */
+                    msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+                    printf("%-18s %8u  failed. %s Error %d.\n", operations[operation].name, num_channels, message, -result);
+                    break;
+                }
+
+                print_table_row(operations[operation].name, num_channels, &histogram);
+                if (json != NULL)
+                {
+                    fprintf(json, "%s\n{\n\"channels\": %u,\n\"latency\": ", separator, num_channels);
+                    latency_histogram_write_json(&histogram, operations[operation].name, json);
+                    fprintf(json, "}");
+                    separator = ",";
+                }
+            }
+        }
+    }
+
+    if (json != NULL)
+        fprintf(json, "\n]\n");
+}
+
+/*
+    The cost of an operation as a function of the number of channels, fixed_cost + channel_cost * channels,
+    fitted to the median latency measured at each channel count.
+*/
+struct cost_model
+{
+    t_double fixed_cost;        /* cost of each call in usecs */
+    t_double channel_cost;      /* additional cost of each channel in usecs */
+    t_double r_squared;         /* fraction of the variation in the latencies explained by the model */
+    t_uint32 num_points;        /* number of channel counts measured */
+};
+
+/*
+    Fit a straight line to the points by least squares. Returns 0 on success and -1 if there are
+    fewer than two points.
+*/
+static t_int
+fit_cost_model(const t_double channels[], const t_double latencies[], t_uint32 num_points, struct cost_model * model)
+{
+    t_double mean_channels = 0, mean_latency = 0;
+    t_double covariance = 0, variance = 0, total = 0, residual = 0;
+    t_uint32 index;
+
+    model->num_points = num_points;
+    if (num_points < 2)
+        return -1;
+
+    for (index = 0; index < num_points; index++)
+    {
+        mean_channels += channels[index];
+        mean_latency  += latencies[index];
+    }
+
+    mean_channels /= num_points;
+    mean_latency  /= num_points;
+
+    for (index = 0; index < num_points; index++)
+    {
+        covariance += (channels[index] - mean_channels) * (latencies[index] - mean_latency);
+        variance   += (channels[index] - mean_channels) * (channels[index] - mean_channels);
+    }
+
+    model->channel_cost = covariance / variance;
+    model->fixed_cost   = mean_latency - model->channel_cost * mean_channels;
+
+    for (index = 0; index < num_points; index++)
+    {
+        const t_double error = latencies[index] - (model->fixed_cost + model->channel_cost * channels[index]);
+
+        residual += error * error;
+        total    += (latencies[index] - mean_latency) * (latencies[index] - mean_latency);
+    }
+
+    model->r_squared = (total > 0) ? 1.0 - residual / total : 1.0;
+    return 0;
+}
+
+/*
+    Print how the reads should be batched, given the cost models of the separate reads and of hil_read.
+*/
+static void
+print_batching_recommendation(const struct cost_model models[])
+{
+    static const enum operation_type separate_reads[] = { OPERATION_READ_ANALOG, OPERATION_READ_DIGITAL, OPERATION_READ_ENCODER };
+
+    const struct cost_model * combined = &models[OPERATION_READ];
+    t_double separate_fixed_cost = 0, separate_channel_cost = 0;
+    t_double crossover;
+    t_uint32 max_channels = combined->num_points;
+    t_uint index;
+
+    printf("Recommended batching strategy:\n");
+
+    for (index = 0; index < ARRAY_LENGTH(separate_reads); index++)
+    {
+        const struct cost_model * model = &models[separate_reads[index]];
+
+        if (model->num_points < 2)
+            continue;
+
+        /* Splitting the channels of one type across several calls adds the fixed cost for every extra call */
+        if (model->fixed_cost > 0)
+            printf("  %s: each extra call costs %.3f usecs, %.0f%% of reading %u channels in one call, so read all the channels in one call.\n",
+                operations[separate_reads[index]].name, model->fixed_cost,
+                100.0 * model->fixed_cost / (model->fixed_cost + model->channel_cost * model->num_points), model->num_points);
+        else
+            printf("  %s: calls have no measurable fixed cost, so the channels may be read in as many calls as is convenient.\n",
+                operations[separate_reads[index]].name);
+
+        separate_fixed_cost   += model->fixed_cost;
+        separate_channel_cost += model->channel_cost;
+        if (model->num_points < max_channels)
+            max_channels = model->num_points;
+    }
+
+    for (index = 0; index < ARRAY_LENGTH(separate_reads); index++)
+    {
+        if (models[separate_reads[index]].num_points < 2)
+        {
+            printf("  Not every read could be measured, so hil_read cannot be compared with separate reads.\n");
+            return;
+        }
+    }
+
+    if (combined->num_points < 2)
+    {
+        printf("  hil_read could not be measured, so it cannot be compared with separate reads.\n");
+        return;
+    }
+
+    /* Reading n channels of each type costs separate_fixed_cost + separate_channel_cost * n with three calls */
+    printf("  Reading 1 channel of each type takes %.3f usecs with hil_read and %.3f usecs with three calls.\n",
+        combined->fixed_cost + combined->channel_cost, separate_fixed_cost + separate_channel_cost);
+    printf("  Reading %u channels of each type takes %.3f usecs with hil_read and %.3f usecs with three calls.\n", max_channels,
+        combined->fixed_cost + combined->channel_cost * max_channels, separate_fixed_cost + separate_channel_cost * max_channels);
+
+    if (combined->channel_cost == separate_channel_cost)
+    {
+        /* Neither approach gains on the other as channels are added, so the fixed costs decide */
+        if (combined->fixed_cost <= separate_fixed_cost)
+            printf("  Merge the reads into a single hil_read in the controllers.\n");
+        else
+            printf("  Keep the separate reads in the controllers.\n");
+        return;
+    }
+
+    /* The number of channels of each type at which both approaches cost the same */
+    crossover = (combined->fixed_cost - separate_fixed_cost) / (separate_channel_cost - combined->channel_cost);
+
+    if (combined->channel_cost < separate_channel_cost)
+    {
+        if (crossover <= 1)
+            printf("  Merge the reads into a single hil_read in the controllers.\n");
+        else if (crossover < max_channels)
+            printf("  Merge the reads into a single hil_read when reading more than %.1f channels of each type.\n", crossover);
+        else
+            printf("  Keep the separate reads in the controllers.\n");
+    }
+    else
+    {
+        if (crossover <= 1)
+            printf("  Keep the separate reads in the controllers.\n");
+        else if (crossover < max_channels)
+            printf("  Merge the reads into a single hil_read when reading fewer than %.1f channels of each type.\n", crossover);
+        else
+            printf("  Merge the reads into a single hil_read in the controllers.\n");
+    }
+}
+
+/*
+    Run each read operation with 1 to max_channels channels, fit a cost model to the median latencies
+    and print the recommended batching strategy.
+*/
+static void
+run_scaling(t_card board, struct io_buffers * buffers, t_uint32 max_channels, t_uint32 iterations, FILE * json)
+{
+    static const enum operation_type scaled_operations[] = { OPERATION_READ_ANALOG, OPERATION_READ_DIGITAL, OPERATION_READ_ENCODER, OPERATION_READ };
+    static struct latency_histogram histogram;
+    static char message[512];
+
+    struct cost_model models[NUM_OPERATIONS];
+    t_double channels[MAX_CHANNELS];
+    t_double medians[MAX_CHANNELS];
+    t_double means[MAX_CHANNELS];
+    const char * separator = "";
+    t_uint index;
+
+    memset(models, 0, sizeof(models));
+
+    if (json != NULL)
+        fprintf(json, "\"scaling\": [");
+
+    printf("%-18s %8s %10s %10s %10s\n", "Operation", "Channels", "p50", "Mean", "Fitted");
+    printf("%-18s %8s %10s %10s %10s\n", "", "", "(usecs)", "(usecs)", "(usecs)");
+
+    for (index = 0; index < ARRAY_LENGTH(scaled_operations) && !stop; index++)
+    {
+        const enum operation_type operation = scaled_operations[index];
+        struct cost_model * model = &models[operation];
+        t_uint32 num_points = 0;
+        t_uint32 num_channels;
+        t_uint32 point;
+        t_error result;
+
+        for (num_channels = 1; num_channels <= max_channels && !stop; num_channels++)
+        {
+            result = run_operation(board, operations[operation].perform, buffers, num_channels, iterations, &histogram);
+            if (result < 0)
+            {
+                /* The board has fewer channels, so fit the channel counts that worked */
+                msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+                printf("%-18s %8u  failed. %s Error %d.\n", operations[operation].name, num_channels, message, -result);
+                break;
+            }
+
+            /* The median is fitted rather than the mean so that an occasional preemption does not skew the fit */
+            channels[num_points] = num_channels;
+            medians[num_points]  = latency_histogram_percentile(&histogram, 50) * 1e-3;
+            means[num_points]    = latency_histogram_mean(&histogram) * 1e-3;
+            num_points++;
+        }
+
+        if (fit_cost_model(channels, medians, num_points, model) != 0)
+        {
+            printf("%-18s at least two channel counts are needed to fit a cost model.\n\n", operations[operation].name);
+            continue;
+        }
+
+        for (point = 0; point < num_points; point++)
+            printf("%-18s %8.0f %10.3f %10.3f %10.3f\n", operations[operation].name, channels[point], medians[point], means[point],
+                model->fixed_cost + model->channel_cost * channels[point]);
+        printf("%-18s fixed cost %.3f usecs per call + %.3f usecs per channel (R^2 = %.4f)\n\n",
+            operations[operation].name, model->fixed_cost, model->channel_cost, model->r_squared);
+
+        if (json != NULL)
+        {
+            fprintf(json, "%s\n{\n\"operation\": \"%s\",\n\"fixed_cost_ns\": %.1f,\n\"channel_cost_ns\": %.1f,\n\"r_squared\": %.6f,\n\"p50_ns\": [",
+                separator, operations[operation].name, model->fixed_cost * 1e3, model->channel_cost * 1e3, model->r_squared);
+            for (point = 0; point < num_points; point++)
+                fprintf(json, "%s[%.0f, %.0f]", (point == 0) ? "" : ", ", channels[point], medians[point] * 1e3);
+            fprintf(json, "]\n}");
+            separator = ",";
+        }
+    }
+
+    if (json != NULL)
+        fprintf(json, "\n]\n");
+
+    if (!stop)
+        print_batching_recommendation(models);
+}
+
+int main(int argc, char * argv[])
+{
+    static const char default_board_type[]       = "q8_usb";
+    static const char default_board_identifier[] = "0";
+    static const char default_benchmark[]        = "sweep";
+    static const char default_operations[]       = "all";
+    static const char default_channel_counts[]   = "1,2,4,8";
+    static const char default_iteration_counts[] = "100000";
+    static const char default_max_channels[]     = "8";
+    static const char default_iterations[]       = "10000";
+
+    static char board_type[64];
+    static char board_identifier[64];
+    static char line[256];
+    static char message[512];
+    static struct io_buffers buffers;
+
+    t_boolean selected[NUM_OPERATIONS];
+    t_uint32 channel_counts[MAX_COUNTS];
+    t_uint32 iteration_counts[MAX_COUNTS];
+    t_int num_channel_counts = 0;
+    t_int num_iteration_counts = 0;
+    t_boolean scaling;
+
+    FILE * json = NULL;
+    qsigaction_t action;
+    t_card board;
+    t_int  result;
+
+    /* Catch Ctrl+C so that the benchmark stops cleanly and hil_close gets called */
+    action.sa_handler = signal_handler;
+    action.sa_flags   = 0;
+    qsigemptyset(&action.sa_mask);
+
+    qsigaction(SIGINT, &action, NULL);
+
+    printf("Enter the board type [%s]:\n", default_board_type);
+    read_line(board_type, sizeof(board_type), default_board_type);
+
+    printf("Enter the board identifier [%s]:\n", default_board_identifier);
+    read_line(board_identifier, sizeof(board_identifier), default_board_identifier);
+
+    printf("Enter the benchmark to run, sweep or scaling [%s]:\n", default_benchmark);
+    read_line(line, sizeof(line), default_benchmark);
+    scaling = (strncmp(line, "sc", 2) == 0);
+
+    if (scaling)
+    {
+        /* Scaling runs every read with 1 to the largest channel count, using the same lists as a sweep */
+        printf("Enter the largest channel count [%s]:\n", default_max_channels);
+        read_line(line, sizeof(line), default_max_channels);
+        if (parse_counts(line, channel_counts, 1, MAX_CHANNELS) < 0 || channel_counts[0] < 2)
+        {
+            printf("Invalid channel count: \"%s\". The count must be from 2 to %d.\n", line, MAX_CHANNELS);
+            return -1;
+        }
+
+        printf("Enter the iterations per channel count [%s]:\n", default_iterations);
+        read_line(line, sizeof(line), default_iterations);
+        if (parse_counts(line, iteration_counts, 1, 0xFFFFFFFFu) < 0)
+        {
+            printf("Invalid iteration count: \"%s\".\n", line);
+            return -1;
+        }
+    }
+    else
+    {
+        printf("Enter the operations, separated by commas, from read_analog, read_digital, read_encoder,\n");
+        printf("write_analog, write_digital, read and write [%s]:\n", default_operations);
+        read_line(line, sizeof(line), default_operations);
+        if (parse_operations(line, selected) < 0)
+        {
+            printf("Invalid list of operations: \"%s\".\n", line);
+            return -1;
+        }
+
+        printf("Enter the channel counts, separated by commas [%s]:\n", default_channel_counts);
+        read_line(line, sizeof(line), default_channel_counts);
+        num_channel_counts = parse_counts(line, channel_counts, MAX_COUNTS, MAX_CHANNELS);
+        if (num_channel_counts < 0)
+        {
+            printf("Invalid list of channel counts: \"%s\". Each count must be from 1 to %d.\n", line, MAX_CHANNELS);
+            return -1;
+        }
+
+        printf("Enter the iteration counts, separated by commas [%s]:\n", default_iteration_counts);
+        read_line(line, sizeof(line), default_iteration_counts);
+        num_iteration_counts = parse_counts(line, iteration_counts, MAX_COUNTS, 0xFFFFFFFFu);
+        if (num_iteration_counts < 0)
+        {
+            printf("Invalid list of iteration counts: \"%s\".\n", line);
+            return -1;
+        }
+    }
+
+    if (argc > 1 && stdfile_open(argv[1], "wt", &json) != 0)
+    {
+        printf("Unable to create the file '%s'.\n", argv[1]);
+        return -1;
+    }
+
+    result = hil_open(board_type, board_identifier, &board);
+    if (result == 0)
+    {
+        qsched_param_t scheduling_parameters;
+        t_uint32 channel;
+
+        for (channel = 0; channel < MAX_CHANNELS; channel++)
+        {
+            buffers.channels[channel] = channel;
+            buffers.voltages[channel] = 0.0;
+            buffers.values[channel]   = false;
+        }
+
+        scheduling_parameters.sched_priority = qsched_get_priority_max(QSCHED_FIFO);
+        qthread_setschedparam(qthread_self(), QSCHED_FIFO, &scheduling_parameters);
+
+        if (json != NULL)
+            fprintf(json, "{\n\"board_type\": \"%s\",\n\"board_identifier\": \"%s\",\n", board_type, board_identifier);
+
+        printf("\nBenchmarking %s board %s. Press CTRL-C to stop.\n\n", board_type, board_identifier);
+        if (scaling)
+            run_scaling(board, &buffers, channel_counts[0], iteration_counts[0], json);
+        else
+            run_sweep(board, &buffers, selected, channel_counts, num_channel_counts, iteration_counts, num_iteration_counts, json);
+
+        if (stop)
+            printf("\nThe benchmark was stopped before all the runs were complete.\n");
+
+        if (json != NULL)
+        {
+            fprintf(json, "}\n");
+            if (ferror(json))
+                printf("Unable to write the results to '%s'.\n", argv[1]);
+        }
+
+        hil_close(board);
+    }
+    else
+    {
+        msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+        printf("Unable to open board. %s Error %d.\n", message, -result);
+    }
+
+    if (json != NULL)
+        stdfile_close(json);
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+//////////////////////////////////////////////////////////////////
+//
+//	hil_performance.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hil.h"
+#include "quanser_signal.h"
+#include "quanser_messages.h"
+#include "quanser_thread.h"
+#include "quanser_time.h"
+#include "quanser_file.h"
+#include "quanser_string.h"
+
+#include "latency_histogram.h"
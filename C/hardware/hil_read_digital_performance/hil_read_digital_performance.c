@@ -11,6 +11,11 @@
 //    hil_read_digital
 //    hil_close
 //
+// The time taken by each call is recorded in a latency histogram, and the
+// percentiles, jitter and slowest calls are printed after the average.
+// If a file name is given on the command line, the histogram is also
+// written to that file as JSON so that runs may be compared by a script.
+//
 // Copyright (C) 2008 Quanser Inc.
 //////////////////////////////////////////////////////////////////
     
@@ -21,6 +26,7 @@ int main(int argc, char* argv[])
     static const char  board_type[] = "q8_usb";
     static const char  board_identifier[] = "0";
     static char        message[512];
+    static struct latency_histogram histogram;
 
     qsigaction_t action;
     t_card board;
@@ -46,16 +52,21 @@ int main(int argc, char* argv[])
         t_uint    index;
 
         t_timeout start_time, stop_time, interval;
+        t_timeout previous_time;
 
         printf("Running %d iterations of hil_read_digital.\n", iterations);
 
         scheduling_parameters.sched_priority = qsched_get_priority_max(QSCHED_FIFO);
         qthread_setschedparam(qthread_self(), QSCHED_FIFO, &scheduling_parameters);
 
-        timeout_get_high_resolution_time(&start_time);
+        latency_histogram_start(&histogram, &previous_time);
+        start_time = previous_time;
 
         for (index = iterations; index > 0 && result >= 0; --index)
+        {
             result = hil_read_digital(board, channels, NUM_CHANNELS, values);
+            latency_histogram_record_call(&histogram, &previous_time);
+        }
 
         timeout_get_high_resolution_time(&stop_time);
         timeout_subtract(&interval, &stop_time, &start_time);
@@ -65,6 +76,22 @@ int main(int argc, char* argv[])
             double time = interval.seconds + interval.nanoseconds * 1e-9;
             printf("%d iterations took %f seconds\n(%.0f Hz or %.1f usecs per call)\n", iterations,
                 time, iterations / time, time / iterations * 1e6);
+
+            latency_histogram_print(&histogram);
+            if (argc > 1)
+            {
+                FILE * file;
+
+                if (stdfile_open(argv[1], "wt", &file) == 0)
+                {
+                    if (latency_histogram_write_json(&histogram, "hil_read_digital", file) != 0)
+                        printf("Unable to write the latency histogram to '%s'.\n", argv[1]);
+
+                    stdfile_close(file);
+                }
+                else
+                    printf("Unable to create the file '%s'.\n", argv[1]);
+            }
         }
         else
         {
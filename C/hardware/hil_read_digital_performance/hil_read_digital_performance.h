@@ -16,3 +16,6 @@
 #include "quanser_messages.h"
 #include "quanser_thread.h"
 #include "quanser_time.h"
+#include "quanser_file.h"
+
+#include "latency_histogram.h"
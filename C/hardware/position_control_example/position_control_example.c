@@ -9,6 +9,17 @@
 //
 // This example runs until Ctrl+C is pressed.
 //
+// The timing of every iteration of the controller is measured: the time
+// between wake-ups, the time spent computing and the time spent in
+// hil_write_analog. Statistics and overrun counts are printed when the
+// controller stops. If a file name is given on the command line, the
+// timing of the last iterations is also written to that file as
+// comma-separated values.
+//
+// If the controller falls behind, loop_timing_drain_encoder skips the
+// samples queued in the task buffer so that the controller acts on the
+// freshest one, and the number skipped is reported with the timing.
+//
 // This example demonstrates the use of the following functions:
 //    hil_open
 //    hil_set_encoder_counts
@@ -26,6 +37,7 @@
 #include "position_control_example.h"
 
 static int stop = 0;
+static struct loop_timing timing;   /* timing of each iteration of the controller */
 
 void signal_handler(int signal)
 {
@@ -59,6 +71,7 @@ int main(int argc, char* argv[])
         const t_double sine_frequency       = 0.5; /* frequency of command signal */
         const t_uint32 samples_in_buffer    = (t_uint32)(0.1 * frequency);
         const t_double period               = 1.0 / frequency;
+        const t_boolean drain_backlog       = true; /* skip to the freshest sample when the controller falls behind */
 
         t_int32  count;
         t_double voltage;
@@ -73,10 +86,13 @@ int main(int argc, char* argv[])
         result = hil_set_encoder_counts(board, &encoder_channel, 1, &count);
         if (result == 0)
         {
-            qsched_param_t scheduling_parameters;
+            struct realtime_options realtime_options;
+            struct realtime_report  realtime_report;
 
-            scheduling_parameters.sched_priority = qsched_get_priority_max(QSCHED_FIFO);
-            qthread_setschedparam(qthread_self(), QSCHED_FIFO, &scheduling_parameters);
+            /* Pin the controller thread, lock and prefault its memory and raise its priority */
+            realtime_default_options(&realtime_options);
+            realtime_setup(&realtime_options, &realtime_report);
+            realtime_print_report(&realtime_report);
 
             result = hil_task_create_encoder_reader(board, samples_in_buffer, &encoder_channel, 1, &task);
             if (result == 0)
@@ -91,18 +107,38 @@ int main(int argc, char* argv[])
                     t_double command = 0;
                     t_double time = 0;
 
+                    loop_timing_init(&timing, period);
+
                     samples_read = hil_task_read_encoder(task, 1, &count);
                     while (samples_read > 0 && stop == 0)
                     {
+                        loop_timing_wake(&timing);
+
+                        /* Controlling on stale samples is worse than dropping them, so skip any backlog */
+                        if (drain_backlog && loop_timing_backlog(&timing) > 0)
+                        {
+                            samples_read = loop_timing_drain_encoder(&timing, task, 1, &count);
+                            if (samples_read < 0)
+                                break;
+
+                            /* Keep the command in step with the sample now being processed */
+                            time   += samples_read * period;
+                            command = 45 * sin(2*M_PI*sine_frequency*time);
+                        }
+
                         position = count * 360 / 4096;     /* convert counts to degrees */
                         error    = command - position;     /* compute error in position */
                         voltage  = -gain * error;          /* apply proportional control */
                         
+                        loop_timing_write_begin(&timing);
                         hil_write_analog(board, &analog_channel, 1, &voltage);
+                        loop_timing_write_end(&timing);
                     
                         /* Compute command signal for next sampling instant */
                         time += period;
                         command = 45 * sin(2*M_PI*sine_frequency*time);
+
+                        loop_timing_sleep(&timing);
                         samples_read = hil_task_read_encoder(task, 1, &count);
                     }
 
@@ -112,6 +148,23 @@ int main(int argc, char* argv[])
                     voltage = 0;
                     hil_write_analog(board, &analog_channel, 1, &voltage);
 
+                    /* Report the timing of the controller, and save the last iterations if a file name was given */
+                    loop_timing_print(&timing);
+                    if (argc > 1)
+                    {
+                        FILE * file;
+
+                        if (stdfile_open(argv[1], "wt", &file) == 0)
+                        {
+                            if (loop_timing_write_csv(&timing, file) != 0)
+                                printf("Unable to write the loop timing to '%s'.\n", argv[1]);
+
+                            stdfile_close(file);
+                        }
+                        else
+                            printf("Unable to create the file '%s'.\n", argv[1]);
+                    }
+
                     if (samples_read < 0)
                     {
                         msg_get_error_message(NULL, samples_read, message, ARRAY_LENGTH(message));
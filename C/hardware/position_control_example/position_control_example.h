@@ -16,3 +16,8 @@
 #include "quanser_signal.h"
 #include "quanser_messages.h"
 #include "quanser_thread.h"
+#include "quanser_time.h"
+#include "quanser_file.h"
+
+#include "realtime.h"
+#include "loop_timing.h"
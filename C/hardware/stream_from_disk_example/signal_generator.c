@@ -0,0 +1,449 @@
+//////////////////////////////////////////////////////////////////
+//
+// signal_generator.c - C file
+//
+// Implements the signal generator described in signal_generator.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+#include <string.h>
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "signal_generator.h"
+
+#define MAX_PEAK_SAMPLES    (1000000)   /* most samples examined to find the peak of a multisine */
+
+/*
+    The maximum-length sequences that may be generated, as the order and second tap of the
+    feedback polynomial x^order + x^tap + 1.
+*/
+static const t_uint32 prbs_polynomials[][2] =
+{
+    { 7, 6 }, { 9, 5 }, { 11, 9 }, { 15, 14 }, { 20, 3 }, { 23, 18 }, { 31, 28 }
+};
+
+/*
+    Reduce a phase in cycles to the range [0, 1).
+*/
+static t_double
+wrap_phase(t_double phase)
+{
+    return phase - floor(phase);
+}
+
+/*
+    Set the phase advanced by a tone each sample, in cycles, and the matching rotation.
+*/
+static void
+set_increment(struct signal_generator * generator, t_uint32 tone, t_double increment)
+{
+    generator->increment[tone]   = increment;
+    generator->step_cosine[tone] = cos(2 * M_PI * increment);
+    generator->step_sine[tone]   = sin(2 * M_PI * increment);
+}
+
+/*
+    Restart the oscillators from the phase accumulators.
+*/
+static void
+start_oscillators(struct signal_generator * generator)
+{
+    t_uint32 tone;
+    t_uint32 channel;
+
+    for (tone = 0; tone < generator->num_tones; tone++)
+    {
+        for (channel = 0; channel < generator->num_channels; channel++)
+        {
+            generator->cosine[tone][channel] = cos(2 * M_PI * generator->phase[tone][channel]);
+            generator->sine[tone][channel]   = sin(2 * M_PI * generator->phase[tone][channel]);
+        }
+    }
+}
+
+/*
+    Advance the phase accumulators of tones with a fixed increment by the given number of samples.
+*/
+static void
+advance_phases(struct signal_generator * generator, t_uint32 num_samples)
+{
+    t_uint32 tone;
+    t_uint32 channel;
+
+    for (tone = 0; tone < generator->num_tones; tone++)
+    {
+        const t_double advance = wrap_phase(num_samples * generator->increment[tone]);
+
+        for (channel = 0; channel < generator->num_channels; channel++)
+            generator->phase[tone][channel] = wrap_phase(generator->phase[tone][channel] + advance);
+    }
+}
+
+/*
+    Find the largest magnitude of the unscaled multisine of channel 0 over one period of its
+    fundamental, so that the multisine can be scaled to its amplitude.
+*/
+static t_double
+multisine_peak(const struct signal_generator * generator)
+{
+    t_double period = floor(1 / generator->increment[0] + 0.5);
+    t_double peak   = 0;
+    t_uint32 num_samples;
+    t_uint32 index;
+    t_uint32 tone;
+
+    num_samples = (period > MAX_PEAK_SAMPLES) ? MAX_PEAK_SAMPLES : (t_uint32) period;
+    for (index = 0; index < num_samples; index++)
+    {
+        t_double value = 0;
+
+        for (tone = 0; tone < generator->num_tones; tone++)
+            value += sin(2 * M_PI * (generator->phase[tone][0] + index * generator->increment[tone]));
+
+        if (fabs(value) > peak)
+            peak = fabs(value);
+    }
+
+    return (peak > 0) ? peak : 1;
+}
+
+t_int
+signal_generator_init(struct signal_generator * generator, const struct signal_parameters * parameters)
+{
+    const t_double sample_frequency = parameters->sample_frequency;
+    const t_double nyquist          = sample_frequency / 2;
+
+    t_uint32 channel;
+    t_uint32 tone;
+
+    if (parameters->num_channels == 0 || parameters->num_channels > SIGNAL_GENERATOR_MAX_CHANNELS
+        || sample_frequency <= 0 || parameters->frequency <= 0)
+        return -1;
+
+    memset(generator, 0, sizeof(*generator));
+    generator->type         = parameters->type;
+    generator->num_channels = parameters->num_channels;
+    generator->num_tones    = 1;
+
+    for (channel = 0; channel < parameters->num_channels; channel++)
+    {
+        generator->offset[channel]       = parameters->offset[channel];
+        generator->amplitude[0][channel] = parameters->amplitude[channel];
+        generator->phase[0][channel]     = wrap_phase(parameters->phase[channel]);
+    }
+
+    switch (parameters->type)
+    {
+        case SIGNAL_TYPE_SINE:
+        case SIGNAL_TYPE_SQUARE:
+            if (parameters->frequency >= nyquist)
+                return -1;
+
+            set_increment(generator, 0, parameters->frequency / sample_frequency);
+            break;
+
+        case SIGNAL_TYPE_CHIRP:
+            if (parameters->frequency >= nyquist || parameters->end_frequency <= 0
+                || parameters->end_frequency >= nyquist || parameters->sweep_time <= 0)
+                return -1;
+
+            generator->sweep_samples = (t_uint64) floor(parameters->sweep_time * sample_frequency + 0.5);
+            if (generator->sweep_samples == 0)
+                generator->sweep_samples = 1;
+
+            generator->start_increment = parameters->frequency / sample_frequency;
+            generator->rate            = (parameters->end_frequency - parameters->frequency) / sample_frequency / generator->sweep_samples;
+
+            /* The oscillator's own rotation changes every sample, so the step holds the change in that rotation */
+            set_increment(generator, 0, generator->rate);
+            break;
+
+        case SIGNAL_TYPE_MULTISINE:
+        {
+            t_double scale;
+
+            if (parameters->num_tones == 0 || parameters->num_tones > SIGNAL_GENERATOR_MAX_TONES
+                || parameters->num_tones * parameters->frequency >= nyquist)
+                return -1;
+
+            generator->num_tones = parameters->num_tones;
+
+            /* Schroeder phases keep the peak of the sum low. The phase of a channel shifts each tone in proportion to its frequency */
+            for (tone = 0; tone < generator->num_tones; tone++)
+            {
+                const t_double schroeder_phase = -(t_double) tone * (tone + 1) / (2.0 * generator->num_tones);
+
+                set_increment(generator, tone, (tone + 1) * parameters->frequency / sample_frequency);
+                for (channel = 0; channel < generator->num_channels; channel++)
+                    generator->phase[tone][channel] = wrap_phase(schroeder_phase + (tone + 1) * parameters->phase[channel]);
+            }
+
+            scale = 1 / multisine_peak(generator);
+            for (tone = 0; tone < generator->num_tones; tone++)
+                for (channel = 0; channel < generator->num_channels; channel++)
+                    generator->amplitude[tone][channel] = parameters->amplitude[channel] * scale;
+            break;
+        }
+
+        case SIGNAL_TYPE_PRBS:
+        {
+            t_uint32 mask;
+            t_uint32 index;
+
+            for (index = 0; index < sizeof(prbs_polynomials) / sizeof(prbs_polynomials[0]); index++)
+            {
+                if (prbs_polynomials[index][0] == parameters->order)
+                    break;
+            }
+
+            if (index == sizeof(prbs_polynomials) / sizeof(prbs_polynomials[0]) || parameters->frequency > sample_frequency)
+                return -1;
+
+            generator->order           = prbs_polynomials[index][0];
+            generator->tap             = prbs_polynomials[index][1];
+            generator->samples_per_bit = (t_uint32) floor(sample_frequency / parameters->frequency + 0.5);
+
+            /* Start each channel at a different point in the sequence. The register must never be zero */
+            mask = ((t_uint32) 1 << generator->order) - 1;
+            for (channel = 0; channel < generator->num_channels; channel++)
+            {
+                generator->register_state[channel] = (0x9E3779B9u * (channel + 1)) & mask;
+                if (generator->register_state[channel] == 0)
+                    generator->register_state[channel] = 1;
+            }
+            break;
+        }
+
+        default:
+            return -1;
+    }
+
+    return 0;
+}
+
+/*
+    Generate a sine wave or multisine, summing the oscillators of all the tones.
+*/
+static void
+generate_tones(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples)
+{
+    const t_uint32 num_channels = generator->num_channels;
+    const t_uint32 num_tones    = generator->num_tones;
+
+    t_uint32 index;
+    t_uint32 tone;
+    t_uint32 channel;
+
+    start_oscillators(generator);
+
+    for (index = 0; index < num_samples; index++)
+    {
+        t_double * sample = voltages + (size_t) index * num_channels;
+
+        for (channel = 0; channel < num_channels; channel++)
+            sample[channel] = generator->offset[channel];
+
+        for (tone = 0; tone < num_tones; tone++)
+        {
+            const t_double   step_cosine = generator->step_cosine[tone];
+            const t_double   step_sine   = generator->step_sine[tone];
+            const t_double * amplitude   = generator->amplitude[tone];
+            t_double *       cosine      = generator->cosine[tone];
+            t_double *       sine        = generator->sine[tone];
+
+            for (channel = 0; channel < num_channels; channel++)
+            {
+                const t_double c = cosine[channel];
+                const t_double s = sine[channel];
+
+                sample[channel] += amplitude[channel] * s;
+                cosine[channel]  = c * step_cosine - s * step_sine;
+                sine[channel]    = s * step_cosine + c * step_sine;
+            }
+        }
+    }
+
+    advance_phases(generator, num_samples);
+}
+
+/*
+    Generate a chirp. The rotation of the oscillator is itself rotated every sample, so the
+    frequency rises or falls linearly. A new sweep restarts the frequency but not the phase.
+*/
+static void
+generate_chirp(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples)
+{
+    const t_uint32 num_channels = generator->num_channels;
+    const t_double * amplitude  = generator->amplitude[0];
+    const t_double * offset     = generator->offset;
+    t_double *       cosine     = generator->cosine[0];
+    t_double *       sine       = generator->sine[0];
+
+    while (num_samples > 0)
+    {
+        const t_uint64 remaining = generator->sweep_samples - generator->sweep_position;
+        const t_uint32 run       = (remaining < num_samples) ? (t_uint32) remaining : num_samples;
+        const t_double increment = generator->start_increment + generator->rate * (t_double) generator->sweep_position;
+        t_double step_cosine     = cos(2 * M_PI * increment);
+        t_double step_sine       = sin(2 * M_PI * increment);
+        t_double advance;
+        t_uint32 index;
+        t_uint32 channel;
+
+        start_oscillators(generator);
+
+        for (index = 0; index < run; index++)
+        {
+            t_double * sample = voltages + (size_t) index * num_channels;
+            t_double   c;
+
+            for (channel = 0; channel < num_channels; channel++)
+            {
+                const t_double oscillator_cosine = cosine[channel];
+                const t_double oscillator_sine   = sine[channel];
+
+                sample[channel] = offset[channel] + amplitude[channel] * oscillator_sine;
+                cosine[channel] = oscillator_cosine * step_cosine - oscillator_sine * step_sine;
+                sine[channel]   = oscillator_sine * step_cosine + oscillator_cosine * step_sine;
+            }
+
+            c           = step_cosine;
+            step_cosine = c * generator->step_cosine[0] - step_sine * generator->step_sine[0];
+            step_sine   = step_sine * generator->step_cosine[0] + c * generator->step_sine[0];
+        }
+
+        /* The phase advanced by the sum of the increments over the run */
+        advance = wrap_phase(run * increment + generator->rate * ((t_double) run * (run - 1) / 2));
+        for (channel = 0; channel < num_channels; channel++)
+            generator->phase[0][channel] = wrap_phase(generator->phase[0][channel] + advance);
+
+        generator->sweep_position += run;
+        if (generator->sweep_position == generator->sweep_samples)
+            generator->sweep_position = 0;
+
+        voltages    += (size_t) run * num_channels;
+        num_samples -= run;
+    }
+}
+
+/*
+    Generate a square wave by comparing a phase accumulator with half a cycle.
+*/
+static void
+generate_square(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples)
+{
+    const t_uint32   num_channels = generator->num_channels;
+    const t_double   increment    = generator->increment[0];
+    const t_double * amplitude    = generator->amplitude[0];
+    const t_double * offset       = generator->offset;
+
+    t_double phase[SIGNAL_GENERATOR_MAX_CHANNELS];
+    t_uint32 index;
+    t_uint32 channel;
+
+    memcpy(phase, generator->phase[0], num_channels * sizeof(t_double));
+
+    for (index = 0; index < num_samples; index++)
+    {
+        t_double * sample = voltages + (size_t) index * num_channels;
+
+        for (channel = 0; channel < num_channels; channel++)
+        {
+            const t_double next = phase[channel] + increment;
+
+            sample[channel] = offset[channel] + ((phase[channel] < 0.5) ? amplitude[channel] : -amplitude[channel]);
+            phase[channel]  = (next >= 1) ? next - 1 : next;
+        }
+    }
+
+    advance_phases(generator, num_samples);
+}
+
+/*
+    Shift the next bit of the sequence into the register of every channel.
+*/
+static void
+next_bits(struct signal_generator * generator)
+{
+    const t_uint32 mask   = ((t_uint32) 1 << generator->order) - 1;
+    const t_uint32 first  = generator->order - 1;
+    const t_uint32 second = generator->tap - 1;
+
+    t_uint32 channel;
+
+    for (channel = 0; channel < generator->num_channels; channel++)
+    {
+        const t_uint32 state = generator->register_state[channel];
+        const t_uint32 bit   = ((state >> first) ^ (state >> second)) & 1;
+
+        generator->register_state[channel] = ((state << 1) | bit) & mask;
+        generator->level[channel] = generator->offset[channel] + (bit ? generator->amplitude[0][channel] : -generator->amplitude[0][channel]);
+    }
+}
+
+/*
+    Generate a pseudo-random binary sequence, holding each bit for samples_per_bit samples.
+*/
+static void
+generate_prbs(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples)
+{
+    const t_uint32   num_channels = generator->num_channels;
+    const t_double * level        = generator->level;
+
+    while (num_samples > 0)
+    {
+        t_uint32 run;
+        t_uint32 index;
+        t_uint32 channel;
+
+        if (generator->bit_position == 0)
+            next_bits(generator);
+
+        run = generator->samples_per_bit - generator->bit_position;
+        if (run > num_samples)
+            run = num_samples;
+
+        for (index = 0; index < run; index++)
+        {
+            t_double * sample = voltages + (size_t) index * num_channels;
+
+            for (channel = 0; channel < num_channels; channel++)
+                sample[channel] = level[channel];
+        }
+
+        generator->bit_position += run;
+        if (generator->bit_position == generator->samples_per_bit)
+            generator->bit_position = 0;
+
+        voltages    += (size_t) run * num_channels;
+        num_samples -= run;
+    }
+}
+
+void
+signal_generator_generate(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples)
+{
+    switch (generator->type)
+    {
+        case SIGNAL_TYPE_SINE:
+        case SIGNAL_TYPE_MULTISINE:
+            generate_tones(generator, voltages, num_samples);
+            break;
+
+        case SIGNAL_TYPE_CHIRP:
+            generate_chirp(generator, voltages, num_samples);
+            break;
+
+        case SIGNAL_TYPE_SQUARE:
+            generate_square(generator, voltages, num_samples);
+            break;
+
+        case SIGNAL_TYPE_PRBS:
+            generate_prbs(generator, voltages, num_samples);
+            break;
+    }
+}
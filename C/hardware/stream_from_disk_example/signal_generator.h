@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////
+//
+// signal_generator.h - header file
+//
+// Generates excitation signals for the analog outputs in process, a
+// block at a time, as used by the stream_from_disk_example. Blocks are
+// written with num_channels voltages per sample, which is the layout
+// hil_task_write_analog expects, so they may be passed to the task
+// without a file in between.
+//
+// No trigonometric function is evaluated per sample. Each sine wave is
+// a complex oscillator that is rotated by a fixed step every sample,
+// and a chirp additionally rotates its step. The phase of every
+// oscillator is kept as a phase accumulator in cycles and the
+// oscillators are restarted from it at the start of each block, so the
+// rounding errors of the recurrence never build up. Square waves and
+// pseudo-random binary sequences need only comparisons and shifts.
+//
+// The state is stored per channel in separate arrays, and the inner
+// loops run across the channels of one sample, so the compiler can
+// vectorize them.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _signal_generator_h
+#define _signal_generator_h
+
+#include "quanser_types.h"
+
+#define SIGNAL_GENERATOR_MAX_CHANNELS   (16)    /* most channels generated at once */
+#define SIGNAL_GENERATOR_MAX_TONES      (32)    /* most sine waves in a multisine */
+
+/*
+    The signals that may be generated. Each channel outputs offset + amplitude * signal, where the
+    signal lies between -1 and 1.
+*/
+enum signal_type
+{
+    SIGNAL_TYPE_SINE,       /* sine wave at the frequency */
+    SIGNAL_TYPE_CHIRP,      /* sine wave swept linearly from the frequency to the end frequency over the sweep time, repeatedly */
+    SIGNAL_TYPE_SQUARE,     /* square wave at the frequency, high for the first half of each period */
+    SIGNAL_TYPE_MULTISINE,  /* sum of sine waves at the first num_tones multiples of the frequency, with Schroeder phases */
+    SIGNAL_TYPE_PRBS        /* maximum-length pseudo-random binary sequence with one bit per period of the frequency */
+};
+
+/*
+    Describes the signal to generate.
+*/
+struct signal_parameters
+{
+    enum signal_type type;
+    t_double sample_frequency;      /* sampling frequency in Hz */
+    t_double frequency;             /* frequency in Hz (start frequency of a chirp, fundamental of a multisine, bit rate of a PRBS) */
+    t_double end_frequency;         /* final frequency of a chirp in Hz (chirp only) */
+    t_double sweep_time;            /* duration of each sweep of a chirp in seconds (chirp only) */
+    t_uint32 num_tones;             /* number of sine waves (multisine only) */
+    t_uint32 order;                 /* order of the sequence, 7, 9, 11, 15, 20, 23 or 31, giving a period of 2^order - 1 bits (PRBS only) */
+    t_uint32 num_channels;          /* number of channels */
+    t_double amplitude[SIGNAL_GENERATOR_MAX_CHANNELS];  /* amplitude of each channel */
+    t_double offset[SIGNAL_GENERATOR_MAX_CHANNELS];     /* offset of each channel */
+    t_double phase[SIGNAL_GENERATOR_MAX_CHANNELS];      /* phase of each channel at time zero as a fraction of a period (not PRBS) */
+};
+
+/*
+    The state of a signal generator. The channel with index i of the tone with index k is element
+    [k][i] of the two-dimensional arrays.
+*/
+struct signal_generator
+{
+    enum signal_type type;
+    t_uint32 num_channels;
+    t_uint32 num_tones;                                 /* number of oscillators per channel */
+    t_double amplitude[SIGNAL_GENERATOR_MAX_TONES][SIGNAL_GENERATOR_MAX_CHANNELS];  /* amplitude of each oscillator */
+    t_double offset[SIGNAL_GENERATOR_MAX_CHANNELS];
+    t_double phase[SIGNAL_GENERATOR_MAX_TONES][SIGNAL_GENERATOR_MAX_CHANNELS];      /* phase of each oscillator in cycles */
+    t_double increment[SIGNAL_GENERATOR_MAX_TONES];     /* phase advance per sample of each tone in cycles */
+    t_double step_cosine[SIGNAL_GENERATOR_MAX_TONES];   /* rotation applied to each oscillator every sample */
+    t_double step_sine[SIGNAL_GENERATOR_MAX_TONES];
+    t_double cosine[SIGNAL_GENERATOR_MAX_TONES][SIGNAL_GENERATOR_MAX_CHANNELS];     /* oscillators within a block */
+    t_double sine[SIGNAL_GENERATOR_MAX_TONES][SIGNAL_GENERATOR_MAX_CHANNELS];
+
+    /* Chirp only */
+    t_uint64 sweep_samples;                             /* samples in each sweep */
+    t_uint64 sweep_position;                            /* index of the next sample within the sweep */
+    t_double start_increment;                           /* phase increment at the start of each sweep in cycles */
+    t_double rate;                                      /* change in the phase increment per sample in cycles */
+
+    /* PRBS only */
+    t_uint32 register_state[SIGNAL_GENERATOR_MAX_CHANNELS];  /* linear feedback shift register of each channel */
+    t_double level[SIGNAL_GENERATOR_MAX_CHANNELS];      /* voltage output for the current bit */
+    t_uint32 order;                                     /* length of the shift register */
+    t_uint32 tap;                                       /* second feedback tap of the shift register */
+    t_uint32 samples_per_bit;                           /* samples for which each bit is held */
+    t_uint32 bit_position;                              /* index of the next sample within the current bit */
+};
+
+/*
+    Prepare to generate the signal, starting at time zero. Returns 0 on success and -1 if the
+    parameters are invalid, such as a frequency above half the sampling frequency.
+*/
+extern t_int
+signal_generator_init(struct signal_generator * generator, const struct signal_parameters * parameters);
+
+/*
+    Generate the next num_samples samples, num_channels voltages per sample.
+*/
+extern void
+signal_generator_generate(struct signal_generator * generator, t_double * voltages, t_uint32 num_samples);
+
+#endif
@@ -10,6 +10,31 @@
 // Data collection is started using the hil_task_start function.
 // The data is then written to the task's internal buffer in one second
 // intervals (1000 samples), using the hil_task_write_analog function.
+//
+// The data may be stored as tab-separated text or as a binary waveform
+// file (see waveform_file.h). Text must be parsed as it is output. A
+// waveform file is instead mapped into memory and each one second slice
+// of the mapping is passed straight to hil_task_write_analog, so no
+// parsing or copying is done at all. Use the waveform_import example to
+// convert existing text files to waveform files.
+//
+// Text is parsed by a separate parser thread, which stays several blocks
+// ahead of the output in a lock-free ring of parsed blocks (see
+// sample_ring.h in the stream_to_disk_example). The thread calling
+// hil_task_write_analog only takes blocks that are ready, so a slow
+// disk or a long line does not delay the output. Each time the parser
+// falls behind and the output has to wait for it, an underrun is
+// counted, and the count is reported when the example stops. The
+// parser reads the text a large block at a time and converts the
+// numbers without strtod (see value_parser.h), which gives exactly the
+// same voltages in any locale.
+//
+// Files are only one source of samples. The samples may instead be
+// produced in process by a signal generator (see signal_generator.h),
+// as a sine wave, chirp, square wave, multisine or pseudo-random binary
+// sequence. Each block is generated directly into the buffer passed to
+// hil_task_write_analog, without evaluating sin() per sample and
+// without writing or reading any file.
 // 
 // Stop the example by pressing Ctrl+C.
 //
@@ -28,6 +53,70 @@
     
 #include "stream_from_disk_example.h"
 
+#define SAMPLES_TO_WRITE    1000    /* one second's worth */
+#define RING_BLOCKS         8       /* blocks the parser thread parses ahead of the output (a power of two) */
+#define TEXT_BUFFER_SIZE    65536   /* bytes of text read from the file at a time */
+
+static const t_uint32 channels[] = { 0, 1, 2 };
+
+#define NUM_CHANNELS        ARRAY_LENGTH(channels)
+
+/*
+    The sources from which the samples may be taken.
+*/
+enum source_type
+{
+    SOURCE_TYPE_TEXT,       /* tab-separated text file */
+    SOURCE_TYPE_WAVEFORM,   /* binary waveform file (see waveform_file.h) */
+    SOURCE_TYPE_GENERATOR   /* signal generator (see signal_generator.h) */
+};
+
+/*
+    The signals offered by the example and their names, in the order of enum signal_type.
+*/
+static const struct
+{
+    const char *     name;
+    enum signal_type type;
+} signal_names[] =
+{
+    { "sine",      SIGNAL_TYPE_SINE },
+    { "chirp",     SIGNAL_TYPE_CHIRP },
+    { "square",    SIGNAL_TYPE_SQUARE },
+    { "multisine", SIGNAL_TYPE_MULTISINE },
+    { "prbs",      SIGNAL_TYPE_PRBS }
+};
+
+/*
+    A block of samples parsed from the text file.
+*/
+struct value_block
+{
+    t_uint   num_samples;                               /* number of samples in the block */
+    t_double voltages[SAMPLES_TO_WRITE][NUM_CHANNELS];
+};
+
+/*
+    The source from which the sample data is taken.
+*/
+struct waveform_source
+{
+    enum source_type        type;           /* kind of source */
+    FILE *                  file_handle;    /* text file (text only) */
+    struct value_reader     reader;         /* reads the text a buffer at a time (text only) */
+    struct sample_ring      ring;           /* blocks parsed ahead by the parser thread (text only) */
+    qthread_t               parser;         /* parser thread (text only) */
+    volatile int            stop_parser;    /* set to make the parser thread exit early (text only) */
+    volatile int            parser_done;    /* set by the parser thread when it exits (text only) */
+    const struct value_block * block;       /* block being output, to be released once it is written (text only) */
+    t_uint                  underruns;      /* number of times the output waited for the parser (text only) */
+    struct waveform_mapping waveform;       /* mapped waveform file (binary only) */
+    t_uint64                position;       /* index of the next sample to output (binary and generator only) */
+    t_uint64                num_samples;    /* number of samples to generate (generator only) */
+    struct signal_generator generator;      /* signal generator (generator only) */
+    struct value_block      generated;      /* block being output (generator only) */
+};
+
 static int stop = 0;
 
 void signal_handler(int signal)
@@ -66,52 +155,310 @@ generate_sample_data_file(char *filename, t_double frequency, t_double duration,
     return result;
 }
 
-static t_uint 
-read_values(FILE *file_handle, t_uint samples_to_write, t_uint num_channels, t_double *voltages)
+static t_int
+generate_sample_waveform_file(char *filename, t_double frequency, t_double duration, t_double sine_frequency,
+                              const t_uint32 channels[], t_uint32 num_channels)
 {
-    t_uint samples_read;
+    struct waveform_writer writer;
+    t_int result;
+    t_double time;
 
-    for (samples_read = 0; samples_read < samples_to_write; samples_read++)
+    result = waveform_writer_open(&writer, filename, frequency, channels, num_channels);
+    if (result == 0)
     {
-        static char line[512];
+        t_double period = 1.0 / frequency;
+        t_double voltages[16];
 
-        if (fgets(line, sizeof(line), file_handle))
+        if (num_channels > ARRAY_LENGTH(voltages))
+            result = -1;
+
+        for (time = 0.0; time < duration && result == 0; time += period)
         {
             t_uint channel;
-            char *position = &line[0];
+            for (channel = 0; channel < num_channels; channel++)
+                voltages[channel] = (channel + 7.0) * sin(2*M_PI*sine_frequency*time);
+            result = waveform_writer_write(&writer, voltages, 1);
+        }
+
+        if (waveform_writer_close(&writer) != 0)
+            result = -1;
+    }
+
+    return result;
+}
+
+/*
+    The parser thread. Parses the text file into the blocks of the ring until the end of the file
+    is reached or it is told to stop.
+*/
+static void *
+parser_thread(void *argument)
+{
+    struct waveform_source *source = (struct waveform_source *) argument;
+    t_timeout idle_interval;
+
+    idle_interval.seconds     = 0;
+    idle_interval.nanoseconds = 1000000; /* 1 ms */
+    idle_interval.is_absolute = false;
 
-            for (channel = 0; channel < num_channels && position != NULL; channel++)
-                voltages[samples_read*num_channels + channel] = strtod(position, &position);
+    while (!source->stop_parser)
+    {
+        struct value_block *block = (struct value_block *) sample_ring_acquire_write(&source->ring);
+        if (block != NULL)
+        {
+            block->num_samples = value_reader_read(&source->reader, NUM_CHANNELS, &block->voltages[0][0], SAMPLES_TO_WRITE);
+            if (block->num_samples == 0)
+                break;
+
+            sample_ring_commit_write(&source->ring);
+            if (block->num_samples < SAMPLES_TO_WRITE)
+                break; /* end of the file */
         }
         else
-            break;
+            qtimer_sleep(&idle_interval); /* the ring is full, so the parser is far enough ahead */
+    }
+
+    sample_ring_close(&source->ring);
+    source->parser_done = 1;
+    return NULL;
+}
+
+/*
+    Open the sample data file of the given type. Returns 0 on success and -1 on failure.
+*/
+static t_int
+open_source(struct waveform_source *source, enum source_type type, const char *filename, t_uint num_channels)
+{
+    source->type        = type;
+    source->position    = 0;
+    source->block       = NULL;
+    source->underruns   = 0;
+    source->stop_parser = 0;
+    source->parser_done = 0;
+
+    if (type == SOURCE_TYPE_WAVEFORM)
+    {
+        if (waveform_map(&source->waveform, filename) != 0)
+            return -1;
+
+        if (source->waveform.header->num_channels != num_channels)
+        {
+            waveform_unmap(&source->waveform);
+            return -1;
+        }
+    }
+    else
+    {
+        static char line[512];
+        static char text[TEXT_BUFFER_SIZE];
+
+        t_timeout wait_interval;
+
+        if (fopen_s(&source->file_handle, filename, "rt") != 0)
+            return -1;
+
+        /* Skip header line in the file */
+        fgets(line, sizeof(line), source->file_handle);
+        value_reader_init(&source->reader, source->file_handle, text, sizeof(text));
+
+        if (sample_ring_create(&source->ring, sizeof(struct value_block), RING_BLOCKS) != 0)
+        {
+            fclose(source->file_handle);
+            return -1;
+        }
+
+        if (qthread_create(&source->parser, NULL, parser_thread, source) != 0)
+        {
+            sample_ring_destroy(&source->ring);
+            fclose(source->file_handle);
+            return -1;
+        }
+
+        /* Let the parser fill the ring before the output starts */
+        wait_interval.seconds     = 0;
+        wait_interval.nanoseconds = 1000000; /* 1 ms */
+        wait_interval.is_absolute = false;
+
+        while (sample_ring_count(&source->ring) < RING_BLOCKS && !source->parser_done)
+            qtimer_sleep(&wait_interval);
+    }
+
+    return 0;
+}
+
+/*
+    Prepare to generate num_samples samples of the signal. Returns 0 on success and -1 on failure.
+*/
+static t_int
+open_generator(struct waveform_source *source, const struct signal_parameters *parameters, t_uint64 num_samples)
+{
+    source->type        = SOURCE_TYPE_GENERATOR;
+    source->position    = 0;
+    source->num_samples = num_samples;
+    source->underruns   = 0;
+
+    return signal_generator_init(&source->generator, parameters);
+}
+
+/*
+    Get the next samples_to_write samples, or fewer at the end of the data. Text is taken a block
+    at a time from the parser thread, while the samples of a waveform file are used where they lie in
+    the mapping. Generated samples are written straight into the block that is output. Returns the
+    number of samples, which are at *samples.
+*/
+static t_uint
+next_values(struct waveform_source *source, t_uint samples_to_write, t_uint num_channels, const t_double **samples)
+{
+    t_uint samples_read;
+
+    if (source->type == SOURCE_TYPE_WAVEFORM)
+    {
+        const t_uint64 remaining = source->waveform.header->num_samples - source->position;
+
+        samples_read = (remaining < samples_to_write) ? (t_uint) remaining : samples_to_write;
+        *samples = source->waveform.samples + source->position * num_channels;
+        source->position += samples_read;
+    }
+    else if (source->type == SOURCE_TYPE_GENERATOR)
+    {
+        const t_uint64 remaining = source->num_samples - source->position;
+
+        samples_read = (remaining < samples_to_write) ? (t_uint) remaining : samples_to_write;
+        signal_generator_generate(&source->generator, &source->generated.voltages[0][0], samples_read);
+        *samples = &source->generated.voltages[0][0];
+        source->position += samples_read;
+    }
+    else
+    {
+        const struct value_block *block;
+        t_boolean is_waiting = false;
+        t_timeout wait_interval;
+
+        wait_interval.seconds     = 0;
+        wait_interval.nanoseconds = 100000; /* 0.1 ms */
+        wait_interval.is_absolute = false;
+
+        /* The previous block has been written to the task buffer, so the parser may reuse it */
+        if (source->block != NULL)
+        {
+            sample_ring_release_read(&source->ring);
+            source->block = NULL;
+        }
+
+        block = (const struct value_block *) sample_ring_acquire_read(&source->ring);
+        while (block == NULL)
+        {
+            if (sample_ring_is_drained(&source->ring))
+                return 0;
+
+            /* The parser has fallen behind */
+            if (!is_waiting)
+            {
+                source->underruns++;
+                is_waiting = true;
+            }
+
+            qtimer_sleep(&wait_interval);
+            block = (const struct value_block *) sample_ring_acquire_read(&source->ring);
+        }
+
+        source->block = block;
+        samples_read  = block->num_samples;
+        *samples      = &block->voltages[0][0];
     }
 
     return samples_read;
 }
 
+/*
+    Close the sample data file.
+*/
+static void
+close_source(struct waveform_source *source)
+{
+    if (source->type == SOURCE_TYPE_WAVEFORM)
+        waveform_unmap(&source->waveform);
+    else if (source->type == SOURCE_TYPE_TEXT)
+    {
+        source->stop_parser = 1;
+        qthread_join(source->parser, NULL);
+
+        sample_ring_destroy(&source->ring);
+        fclose(source->file_handle);
+    }
+}
+
+/*
+    Describe the given signal with the same amplitudes as the sample data file. The sine wave has
+    the frequency of the sample data, the chirp sweeps up to that frequency over the duration, the
+    square wave is a tenth of it, the multisine has ten tones spaced a twentieth of it apart, and
+    the PRBS changes at most that many times a second.
+*/
+static void
+init_signal_parameters(struct signal_parameters *parameters, enum signal_type type, t_double frequency,
+                       t_double sine_frequency, t_double duration, t_uint num_channels)
+{
+    t_uint channel;
+
+    memset(parameters, 0, sizeof(*parameters));
+    parameters->type             = type;
+    parameters->sample_frequency = frequency;
+    parameters->num_channels     = num_channels;
+
+    for (channel = 0; channel < num_channels; channel++)
+        parameters->amplitude[channel] = channel + 7.0;
+
+    switch (type)
+    {
+        case SIGNAL_TYPE_CHIRP:
+            parameters->frequency     = 1;
+            parameters->end_frequency = sine_frequency;
+            parameters->sweep_time    = duration;
+            break;
+
+        case SIGNAL_TYPE_SQUARE:
+            parameters->frequency = sine_frequency / 10;
+            break;
+
+        case SIGNAL_TYPE_MULTISINE:
+            parameters->frequency = sine_frequency / 20;
+            parameters->num_tones = 10;
+            break;
+
+        case SIGNAL_TYPE_PRBS:
+            parameters->frequency = sine_frequency;
+            parameters->order     = 15;
+            break;
+
+        default:
+            parameters->frequency = sine_frequency;
+            break;
+    }
+}
+
 int main(int argc, char* argv[])
 {
     static const char board_type[]       = "q8_usb";
     static const char board_identifier[] = "0";
     static char       message[512];
-    static const char default_filename[] = "sample_data.txt";
+    static const char default_text_filename[]   = "sample_data.txt";
+    static const char default_binary_filename[] = "sample_data.qwf";
 
     const t_uint32   samples           = -1; /* write continuously */
-    const t_uint32   channels[]        = { 0, 1, 2 };
     const t_double   frequency         = 1000;
     const t_double   sine_frequency    = 100;
     const t_double   duration          = 10.0;  /* run for 10 seconds */
 
-    #define NUM_CHANNELS        ARRAY_LENGTH(channels)
-    #define SAMPLES_TO_WRITE    1000    /* one second's worth */
-
     const t_uint32   samples_in_buffer = (t_uint32)(2*SAMPLES_TO_WRITE); /* double buffer */
     const t_double   period            = 1.0 / frequency;
 
     static char filename[_MAX_PATH];
 
-    FILE * file_handle;
+    struct waveform_source source;
+    struct signal_parameters parameters;
+    const char * default_filename;
+    enum source_type source_type;
+    enum signal_type signal_type = SIGNAL_TYPE_SINE;
     qsigaction_t action;
     t_card board;
     t_int  result;
@@ -123,37 +470,79 @@ int main(int argc, char* argv[])
 
     qsigaction(SIGINT, &action, NULL);
 
-    printf("Enter the name of the file to which to write sample data [%s]:\n", default_filename);
-    fgets(filename, ARRAY_LENGTH(filename), stdin); /* use fgets to avoid deprecation warnings with gets() on some systems */
-    filename[string_length(filename, sizeof(filename)) - 1] = '\0';  /* remove newline */
-    if (filename[0] == '\0')
-        string_copy(filename, sizeof(filename), default_filename);
+    printf("Enter the source of the sample data, text, binary or generator [text]:\n");
+    fgets(filename, ARRAY_LENGTH(filename), stdin);
+    if (filename[0] == 'b' || filename[0] == 'B')
+        source_type = SOURCE_TYPE_WAVEFORM;
+    else if (filename[0] == 'g' || filename[0] == 'G')
+        source_type = SOURCE_TYPE_GENERATOR;
+    else
+        source_type = SOURCE_TYPE_TEXT;
 
-    printf("Generating sample data file. Please wait...\n\n");
-    if (generate_sample_data_file(filename, frequency, duration, sine_frequency, channels, NUM_CHANNELS) != 0)
+    if (source_type == SOURCE_TYPE_GENERATOR)
     {
-        printf("Unable to generate a sample data file\n");
-        return -1;
-    }
+        t_uint index;
 
-    if (fopen_s(&file_handle, filename, "rt") == 0)
+        printf("Enter the signal to generate, sine, chirp, square, multisine or prbs [sine]:\n");
+        fgets(filename, ARRAY_LENGTH(filename), stdin);
+        for (index = 0; index < ARRAY_LENGTH(signal_names); index++)
+        {
+            if (strncmp(filename, signal_names[index].name, 2) == 0)
+                signal_type = signal_names[index].type;
+        }
+
+        init_signal_parameters(&parameters, signal_type, frequency, sine_frequency, duration, NUM_CHANNELS);
+        result = open_generator(&source, &parameters, (t_uint64) (duration * frequency));
+        if (result != 0)
+            printf("Unable to start the signal generator.\n");
+    }
+    else
     {
-        static char line[512];
+        default_filename = (source_type == SOURCE_TYPE_WAVEFORM) ? default_binary_filename : default_text_filename;
 
-        /* Skip header line in the file */
-        fgets(line, sizeof(line), file_handle);
+        printf("Enter the name of the file to which to write sample data [%s]:\n", default_filename);
+        fgets(filename, ARRAY_LENGTH(filename), stdin); /* use fgets to avoid deprecation warnings with gets() on some systems */
+        filename[string_length(filename, sizeof(filename)) - 1] = '\0';  /* remove newline */
+        if (filename[0] == '\0')
+            string_copy(filename, sizeof(filename), default_filename);
+
+        printf("Generating sample data file. Please wait...\n\n");
+        if (source_type == SOURCE_TYPE_WAVEFORM)
+            result = generate_sample_waveform_file(filename, frequency, duration, sine_frequency, channels, NUM_CHANNELS);
+        else
+            result = generate_sample_data_file(filename, frequency, duration, sine_frequency, channels, NUM_CHANNELS);
 
+        if (result != 0)
+        {
+            printf("Unable to generate a sample data file\n");
+            return -1;
+        }
+
+        result = open_source(&source, source_type, filename, NUM_CHANNELS);
+        if (result != 0)
+            printf("Unable to open data file: \"%s\".\n", filename);
+    }
+
+    if (result == 0)
+    {
         result = hil_open(board_type, board_identifier, &board);
         if (result == 0)
         {
-            static t_double voltages[SAMPLES_TO_WRITE][NUM_CHANNELS];
-
+            const t_double * block;
             t_int     samples_written = SAMPLES_TO_WRITE;
             t_int     samples_read;
             t_task    task;
 
-            printf("This example reads data from a sample data file and writes it to\n");
-            printf("the first three analog channels as the data is read. The example\n");
+            if (source_type == SOURCE_TYPE_GENERATOR)
+            {
+                printf("This example generates a %s signal and writes it to the first\n", signal_names[signal_type].name);
+                printf("three analog channels as it is generated. The example\n");
+            }
+            else
+            {
+                printf("This example reads data from a sample data file and writes it to\n");
+                printf("the first three analog channels as the data is read. The example\n");
+            }
             printf("will run for %g seconds or until it is stopped manually.\n", duration);
 
             printf("Press CTRL-C to stop writing.\n\n");
@@ -161,20 +550,23 @@ int main(int argc, char* argv[])
             result = hil_task_create_analog_writer(board, samples_in_buffer, channels, NUM_CHANNELS, &task);
             if (result == 0)
             {
-                samples_read = read_values(file_handle, SAMPLES_TO_WRITE, NUM_CHANNELS, &voltages[0][0]);
+                samples_read = next_values(&source, SAMPLES_TO_WRITE, NUM_CHANNELS, &block);
 
                 result = hil_task_start(task, SYSTEM_CLOCK_1, frequency, samples);
                 if (result == 0)
                 {
                     while (samples_read > 0 && samples_written > 0 && stop == 0)
                     {
-                        samples_written = hil_task_write_analog(task, samples_read, &voltages[0][0]);
-                        samples_read = read_values(file_handle, SAMPLES_TO_WRITE, NUM_CHANNELS, &voltages[0][0]);
+                        samples_written = hil_task_write_analog(task, samples_read, block);
+                        samples_read = next_values(&source, SAMPLES_TO_WRITE, NUM_CHANNELS, &block);
                     }
 
                     hil_task_flush(task);
                     hil_task_stop(task);
 
+                    if (source_type == SOURCE_TYPE_TEXT)
+                        printf("The parser fell behind the output %u times.\n", source.underruns);
+
                     if (samples_written < 0)
                     {
                         msg_get_error_message(NULL, samples_written, message, ARRAY_LENGTH(message));
@@ -207,10 +599,9 @@ int main(int argc, char* argv[])
             msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
             printf("Unable to open board. %s Error %d.\n", message, -result);
         }
-    }
-    else
-        printf("Unable to open data file: \"%s\".\n", filename);
 
+        close_source(&source);
+    }
 
     return 0;
 }
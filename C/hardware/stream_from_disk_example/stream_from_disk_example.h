@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define _USE_MATH_DEFINES
 #include <math.h>
@@ -17,3 +18,11 @@
 #include "quanser_messages.h"
 #include "quanser_file.h"
 #include "quanser_string.h"
+#include "quanser_thread.h"
+#include "quanser_timer.h"
+
+#include "waveform_file.h"
+#include "value_parser.h"
+#include "signal_generator.h"
+#include "sample_ring.h"
+
@@ -0,0 +1,656 @@
+//////////////////////////////////////////////////////////////////
+//
+// value_parser.c - C file
+//
+// Implements the text parser described in value_parser.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <float.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VALUE_PARSER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "value_parser.h"
+
+/* Longest number passed to strtod. Longer numbers are cut off at this length */
+#define MAX_NUMBER_LENGTH   (512)
+
+/* Most significant digits that fit in a t_uint64 without overflow */
+#define MAX_DIGITS          (19)
+
+/* Largest integer for which every smaller integer is exactly representable as a t_double */
+#define MAX_EXACT_INTEGER   ((t_uint64) 1 << 53)
+
+/*
+    The fast path relies on each operation being rounded once to double precision. Where
+    intermediate results are kept with more precision, as with the x87 FPU, every number is
+    passed to strtod instead.
+*/
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+#define FAST_PATH_ENABLED   (0)
+#else
+#define FAST_PATH_ENABLED   (1)
+#endif
+
+/* The powers of ten that are exactly representable as a t_double */
+static const t_double powers_of_ten[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define MAX_EXACT_EXPONENT  ((t_int) (sizeof(powers_of_ten) / sizeof(powers_of_ten[0])) - 1)
+
+/* Range of decimal exponents covered by the table of powers of five */
+#define MIN_POWER           (-64)
+#define MAX_POWER           (64)
+
+/*
+    The powers of five from 5^MIN_POWER to 5^MAX_POWER as 128-bit values, most significant half
+    first, scaled by a power of two so that the top bit is set. Positive powers are truncated and
+    negative powers are rounded up, as required by the Eisel-Lemire algorithm.
+*/
+static const t_uint64 powers_of_five[MAX_POWER - MIN_POWER + 1][2] =
+{
+    { 0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL }, /* 5^-64 */
+    { 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL }, /* 5^-63 */
+    { 0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL }, /* 5^-62 */
+    { 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL }, /* 5^-61 */
+    { 0xCDB02555653131B6ULL, 0x3792F412CB06794DULL }, /* 5^-60 */
+    { 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL }, /* 5^-59 */
+    { 0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL }, /* 5^-58 */
+    { 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL }, /* 5^-57 */
+    { 0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL }, /* 5^-56 */
+    { 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL }, /* 5^-55 */
+    { 0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL }, /* 5^-54 */
+    { 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL }, /* 5^-53 */
+    { 0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL }, /* 5^-52 */
+    { 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL }, /* 5^-51 */
+    { 0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL }, /* 5^-50 */
+    { 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL }, /* 5^-49 */
+    { 0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL }, /* 5^-48 */
+    { 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL }, /* 5^-47 */
+    { 0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL }, /* 5^-46 */
+    { 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL }, /* 5^-45 */
+    { 0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL }, /* 5^-44 */
+    { 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL }, /* 5^-43 */
+    { 0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL }, /* 5^-42 */
+    { 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL }, /* 5^-41 */
+    { 0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL }, /* 5^-40 */
+    { 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL }, /* 5^-39 */
+    { 0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL }, /* 5^-38 */
+    { 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL }, /* 5^-37 */
+    { 0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL }, /* 5^-36 */
+    { 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL }, /* 5^-35 */
+    { 0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL }, /* 5^-34 */
+    { 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL }, /* 5^-33 */
+    { 0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL }, /* 5^-32 */
+    { 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL }, /* 5^-31 */
+    { 0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL }, /* 5^-30 */
+    { 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL }, /* 5^-29 */
+    { 0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL }, /* 5^-28 */
+    { 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL }, /* 5^-27 */
+    { 0xC612062576589DDAULL, 0x95364AFE032A819EULL }, /* 5^-26 */
+    { 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL }, /* 5^-25 */
+    { 0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL }, /* 5^-24 */
+    { 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL }, /* 5^-23 */
+    { 0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL }, /* 5^-22 */
+    { 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL }, /* 5^-21 */
+    { 0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL }, /* 5^-20 */
+    { 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL }, /* 5^-19 */
+    { 0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL }, /* 5^-18 */
+    { 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL }, /* 5^-17 */
+    { 0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL }, /* 5^-16 */
+    { 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL }, /* 5^-15 */
+    { 0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL }, /* 5^-14 */
+    { 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL }, /* 5^-13 */
+    { 0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL }, /* 5^-12 */
+    { 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL }, /* 5^-11 */
+    { 0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL }, /* 5^-10 */
+    { 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL }, /* 5^-9 */
+    { 0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL }, /* 5^-8 */
+    { 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL }, /* 5^-7 */
+    { 0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL }, /* 5^-6 */
+    { 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL }, /* 5^-5 */
+    { 0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL }, /* 5^-4 */
+    { 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL }, /* 5^-3 */
+    { 0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL }, /* 5^-2 */
+    { 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL }, /* 5^-1 */
+    { 0x8000000000000000ULL, 0x0000000000000000ULL }, /* 5^0 */
+    { 0xA000000000000000ULL, 0x0000000000000000ULL }, /* 5^1 */
+    { 0xC800000000000000ULL, 0x0000000000000000ULL }, /* 5^2 */
+    { 0xFA00000000000000ULL, 0x0000000000000000ULL }, /* 5^3 */
+    { 0x9C40000000000000ULL, 0x0000000000000000ULL }, /* 5^4 */
+    { 0xC350000000000000ULL, 0x0000000000000000ULL }, /* 5^5 */
+    { 0xF424000000000000ULL, 0x0000000000000000ULL }, /* 5^6 */
+    { 0x9896800000000000ULL, 0x0000000000000000ULL }, /* 5^7 */
+    { 0xBEBC200000000000ULL, 0x0000000000000000ULL }, /* 5^8 */
+    { 0xEE6B280000000000ULL, 0x0000000000000000ULL }, /* 5^9 */
+    { 0x9502F90000000000ULL, 0x0000000000000000ULL }, /* 5^10 */
+    { 0xBA43B74000000000ULL, 0x0000000000000000ULL }, /* 5^11 */
+    { 0xE8D4A51000000000ULL, 0x0000000000000000ULL }, /* 5^12 */
+    { 0x9184E72A00000000ULL, 0x0000000000000000ULL }, /* 5^13 */
+    { 0xB5E620F480000000ULL, 0x0000000000000000ULL }, /* 5^14 */
+    { 0xE35FA931A0000000ULL, 0x0000000000000000ULL }, /* 5^15 */
+    { 0x8E1BC9BF04000000ULL, 0x0000000000000000ULL }, /* 5^16 */
+    { 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL }, /* 5^17 */
+    { 0xDE0B6B3A76400000ULL, 0x0000000000000000ULL }, /* 5^18 */
+    { 0x8AC7230489E80000ULL, 0x0000000000000000ULL }, /* 5^19 */
+    { 0xAD78EBC5AC620000ULL, 0x0000000000000000ULL }, /* 5^20 */
+    { 0xD8D726B7177A8000ULL, 0x0000000000000000ULL }, /* 5^21 */
+    { 0x878678326EAC9000ULL, 0x0000000000000000ULL }, /* 5^22 */
+    { 0xA968163F0A57B400ULL, 0x0000000000000000ULL }, /* 5^23 */
+    { 0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL }, /* 5^24 */
+    { 0x84595161401484A0ULL, 0x0000000000000000ULL }, /* 5^25 */
+    { 0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL }, /* 5^26 */
+    { 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL }, /* 5^27 */
+    { 0x813F3978F8940984ULL, 0x4000000000000000ULL }, /* 5^28 */
+    { 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL }, /* 5^29 */
+    { 0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL }, /* 5^30 */
+    { 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL }, /* 5^31 */
+    { 0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL }, /* 5^32 */
+    { 0xC5371912364CE305ULL, 0x6C28000000000000ULL }, /* 5^33 */
+    { 0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL }, /* 5^34 */
+    { 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL }, /* 5^35 */
+    { 0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL }, /* 5^36 */
+    { 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL }, /* 5^37 */
+    { 0x96769950B50D88F4ULL, 0x1314448000000000ULL }, /* 5^38 */
+    { 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL }, /* 5^39 */
+    { 0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL }, /* 5^40 */
+    { 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL }, /* 5^41 */
+    { 0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL }, /* 5^42 */
+    { 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL }, /* 5^43 */
+    { 0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL }, /* 5^44 */
+    { 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL }, /* 5^45 */
+    { 0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL }, /* 5^46 */
+    { 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL }, /* 5^47 */
+    { 0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL }, /* 5^48 */
+    { 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL }, /* 5^49 */
+    { 0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL }, /* 5^50 */
+    { 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL }, /* 5^51 */
+    { 0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL }, /* 5^52 */
+    { 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL }, /* 5^53 */
+    { 0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL }, /* 5^54 */
+    { 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL }, /* 5^55 */
+    { 0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL }, /* 5^56 */
+    { 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL }, /* 5^57 */
+    { 0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL }, /* 5^58 */
+    { 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL }, /* 5^59 */
+    { 0x9F4F2726179A2245ULL, 0x01D762422C946590ULL }, /* 5^60 */
+    { 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL }, /* 5^61 */
+    { 0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL }, /* 5^62 */
+    { 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL }, /* 5^63 */
+    { 0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL }, /* 5^64 */
+};
+
+static t_boolean
+is_digit(char character)
+{
+    return (t_boolean) ((unsigned) (character - '0') < 10);
+}
+
+/* White space as skipped by strtod in the "C" locale */
+static t_boolean
+is_space(char character)
+{
+    return (t_boolean) (character == ' ' || (unsigned) (character - '\t') <= '\r' - '\t');
+}
+
+/* Characters that separate the values on a line */
+static t_boolean
+is_separator(char character)
+{
+    return (t_boolean) (character == '\t' || character == ' ' || character == ',' || character == '\r');
+}
+
+static t_uint32
+count_leading_zeros(t_uint64 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, (unsigned long) (value >> 32)))
+        return 31 - index;
+    _BitScanReverse(&index, (unsigned long) value);
+    return 63 - index;
+#else
+    return (t_uint32) __builtin_clzll(value);
+#endif
+}
+
+static t_uint32
+count_trailing_zeros(t_uint32 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, (unsigned long) value);
+    return index;
+#else
+    return (t_uint32) __builtin_ctz(value);
+#endif
+}
+
+/*
+    Compute the full 128-bit product of two 64-bit values.
+*/
+static void
+multiply(t_uint64 first, t_uint64 second, t_uint64 * high, t_uint64 * low)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = (unsigned __int128) first * second;
+
+    *high = (t_uint64) (product >> 64);
+    *low  = (t_uint64) product;
+#elif defined(_M_X64)
+    *low = _umul128(first, second, high);
+#else
+    const t_uint64 first_low   = (t_uint32) first;
+    const t_uint64 first_high  = first >> 32;
+    const t_uint64 second_low  = (t_uint32) second;
+    const t_uint64 second_high = second >> 32;
+    const t_uint64 low_low     = first_low * second_low;
+    const t_uint64 high_low    = first_high * second_low;
+    const t_uint64 low_high    = first_low * second_high;
+    const t_uint64 middle      = (low_low >> 32) + (t_uint32) high_low + (t_uint32) low_high;
+
+    *high = first_high * second_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    *low  = (middle << 32) | (t_uint32) low_low;
+#endif
+}
+
+/*
+    Compute mantissa * 10^exponent, correctly rounded, using the Eisel-Lemire algorithm. The
+    mantissa must be nonzero and the exponent within the table of powers of five. Returns false,
+    leaving the number to strtod, in the rare cases where the product is too close to halfway
+    between two doubles to decide the rounding, or where the result would not be a normal double.
+*/
+static t_boolean
+compute_double(t_uint64 mantissa, t_int exponent, t_boolean is_negative, t_double * value)
+{
+    const t_uint64 * power = powers_of_five[exponent - MIN_POWER];
+
+    /* The binary exponent of the result before normalization: floor(log2(10^exponent)) + 1024 + 63 */
+    const t_int64 biased_exponent = (((t_int64) (152170 + 65536) * exponent) >> 16) + 1024 + 63;
+
+    t_uint32 leading_zeros = count_leading_zeros(mantissa);
+    t_uint64 upper;
+    t_uint64 lower;
+    t_uint64 upper_bit;
+    t_uint64 bits;
+    t_int64  binary_exponent;
+
+    mantissa <<= leading_zeros;
+    multiply(mantissa, power[0], &upper, &lower);
+
+    /* The truncated product may be off in its low bits, so refine it with the rest of the power */
+    if ((upper & 0x1FF) == 0x1FF && lower + mantissa < lower)
+    {
+        t_uint64 product_high;
+        t_uint64 product_low;
+        t_uint64 middle;
+
+        multiply(mantissa, power[1], &product_high, &product_low);
+        middle = lower + product_high;
+        if (middle < lower)
+            ++upper;
+
+        if (middle + 1 == 0 && (upper & 0x1FF) == 0x1FF && product_low + mantissa < product_low)
+            return false;
+
+        lower = middle;
+    }
+
+    upper_bit      = upper >> 63;
+    bits           = upper >> (upper_bit + 9);
+    leading_zeros += (t_uint32) (1 ^ upper_bit);
+
+    /* Exactly halfway between two doubles */
+    if (lower == 0 && (upper & 0x1FF) == 0 && (bits & 3) == 1)
+        return false;
+
+    bits += bits & 1;
+    bits >>= 1;
+    if (bits >= ((t_uint64) 1 << 53))
+    {
+        bits = (t_uint64) 1 << 52;
+        --leading_zeros;
+    }
+
+    binary_exponent = biased_exponent - leading_zeros;
+    if (binary_exponent < 1 || binary_exponent > 2046)
+        return false;
+
+    bits = (bits & ~((t_uint64) 1 << 52)) | ((t_uint64) binary_exponent << 52);
+    if (is_negative)
+        bits |= (t_uint64) 1 << 63;
+
+    memcpy(value, &bits, sizeof(*value));
+    return true;
+}
+
+/*
+    Returns the first newline at or after text, or end if there is none.
+*/
+static const char *
+find_newline(const char * text, const char * end)
+{
+#if defined(VALUE_PARSER_SSE2)
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    while (end - text >= 16)
+    {
+        const __m128i characters = _mm_loadu_si128((const __m128i *) text);
+        const int     mask       = _mm_movemask_epi8(_mm_cmpeq_epi8(characters, newline));
+
+        if (mask != 0)
+            return text + count_trailing_zeros((t_uint32) mask);
+
+        text += 16;
+    }
+#endif
+
+    while (text < end && *text != '\n')
+        ++text;
+
+    return text;
+}
+
+/*
+    Convert the number at the start of the text using strtod. The number is copied with the decimal
+    point of the current locale in place of '.' so that the result does not depend on the locale.
+*/
+static t_int
+parse_with_strtod(const char * text, const char ** end, t_double * value)
+{
+    const char decimal_point = localeconv()->decimal_point[0];
+    char       number[MAX_NUMBER_LENGTH + 1];
+    char *     stop;
+    size_t     length = 0;
+
+    while (length < MAX_NUMBER_LENGTH && text[length] != '\0' && text[length] != '\n' && !is_separator(text[length]))
+    {
+        number[length] = (text[length] == '.') ? decimal_point : text[length];
+        ++length;
+    }
+    number[length] = '\0';
+
+    *value = strtod(number, &stop);
+    if (stop == number)
+        return -1;
+
+    *end = text + (stop - number);
+    return 0;
+}
+
+t_int
+value_parser_parse_number(const char * text, const char ** end, t_double * value)
+{
+    const char * position;
+    const char * start;
+    t_uint64     mantissa   = 0;
+    t_int        num_digits = 0;    /* significant digits, not counting leading zeros */
+    t_int        exponent   = 0;
+    t_boolean    has_digits = false;
+    t_boolean    is_negative = false;
+
+    *end   = text;
+    *value = 0;
+
+    while (is_space(*text))
+        ++text;
+
+    start    = text;
+    position = text;
+
+    if (*position == '-')
+    {
+        is_negative = true;
+        ++position;
+    }
+    else if (*position == '+')
+        ++position;
+
+    /* Integer part */
+    while (*position == '0')
+    {
+        has_digits = true;
+        ++position;
+    }
+
+    while (is_digit(*position))
+    {
+        if (num_digits < MAX_DIGITS)
+            mantissa = mantissa * 10 + (t_uint64) (*position - '0');
+        else
+            ++exponent;
+
+        has_digits = true;
+        ++num_digits;
+        ++position;
+    }
+
+    /* Fractional part */
+    if (*position == '.')
+    {
+        ++position;
+
+        if (num_digits == 0)
+        {
+            while (*position == '0')
+            {
+                has_digits = true;
+                --exponent;
+                ++position;
+            }
+        }
+
+        while (is_digit(*position))
+        {
+            if (num_digits < MAX_DIGITS)
+            {
+                mantissa = mantissa * 10 + (t_uint64) (*position - '0');
+                --exponent;
+            }
+
+            has_digits = true;
+            ++num_digits;
+            ++position;
+        }
+    }
+
+    /* Infinities, NaNs, hexadecimal numbers and text that is not a number at all are left to strtod */
+    if (!has_digits || *position == 'x' || *position == 'X')
+        return parse_with_strtod(start, end, value);
+
+    /* The exponent is only part of the number if at least one digit follows the 'e' */
+    if (*position == 'e' || *position == 'E')
+    {
+        const char * digits       = position + 1;
+        t_boolean    is_negative_exponent = false;
+
+        if (*digits == '-')
+        {
+            is_negative_exponent = true;
+            ++digits;
+        }
+        else if (*digits == '+')
+            ++digits;
+
+        if (is_digit(*digits))
+        {
+            t_int explicit_exponent = 0;
+
+            while (is_digit(*digits))
+            {
+                if (explicit_exponent < 100000)
+                    explicit_exponent = explicit_exponent * 10 + (*digits - '0');
+                ++digits;
+            }
+
+            exponent += is_negative_exponent ? -explicit_exponent : explicit_exponent;
+            position  = digits;
+        }
+    }
+
+    if (mantissa == 0)
+    {
+        *value = is_negative ? -0.0 : 0.0;
+        *end   = position;
+        return 0;
+    }
+
+    /*
+        When both the mantissa and the power of ten are exact, a single multiplication or division
+        gives the correctly rounded result, which is what strtod returns.
+    */
+    if (FAST_PATH_ENABLED && num_digits <= MAX_DIGITS && mantissa <= MAX_EXACT_INTEGER
+        && exponent >= -MAX_EXACT_EXPONENT && exponent <= MAX_EXACT_EXPONENT)
+    {
+        t_double result = (t_double) mantissa;
+
+        if (exponent < 0)
+            result /= powers_of_ten[-exponent];
+        else
+            result *= powers_of_ten[exponent];
+
+        *value = is_negative ? -result : result;
+        *end   = position;
+        return 0;
+    }
+
+    if (exponent >= MIN_POWER && exponent <= MAX_POWER)
+    {
+        if (num_digits <= MAX_DIGITS)
+        {
+            if (compute_double(mantissa, exponent, is_negative, value))
+            {
+                *end = position;
+                return 0;
+            }
+        }
+        else
+        {
+            /*
+                Only the first MAX_DIGITS digits are in the mantissa, so the number lies between
+                mantissa and mantissa + 1 times the power of ten. When both round to the same
+                double, so does the number.
+            */
+            t_double upper_value;
+
+            if (compute_double(mantissa, exponent, is_negative, value)
+                && compute_double(mantissa + 1, exponent, is_negative, &upper_value)
+                && *value == upper_value)
+            {
+                *end = position;
+                return 0;
+            }
+        }
+    }
+
+    return parse_with_strtod(start, end, value);
+}
+
+const char *
+value_parser_parse_lines(const char * text, const char * end, t_uint32 num_channels,
+                         t_double * values, t_uint32 max_samples, t_uint32 * num_samples)
+{
+    t_uint32 count = 0;
+
+    while (count < max_samples)
+    {
+        const char * line_end = find_newline(text, end);
+        t_double *   sample   = values + (size_t) count * num_channels;
+        t_uint32     channel;
+
+        if (line_end == end)
+            break; /* the line is incomplete */
+
+        for (channel = 0; channel < num_channels; channel++)
+        {
+            while (text < line_end && is_separator(*text))
+                ++text;
+
+            /* A value that is missing or not a number reads as zero, as it does with strtod */
+            if (text == line_end || value_parser_parse_number(text, &text, &sample[channel]) != 0)
+                break;
+        }
+
+        for (; channel < num_channels; channel++)
+            sample[channel] = 0;
+
+        text = line_end + 1;
+        ++count;
+    }
+
+    *num_samples = count;
+    return text;
+}
+
+void
+value_reader_init(struct value_reader * reader, FILE * file, char * buffer, size_t size)
+{
+    reader->file   = file;
+    reader->buffer = buffer;
+    reader->size   = size;
+    reader->start  = buffer;
+    reader->end    = buffer;
+    reader->at_end = false;
+}
+
+t_uint32
+value_reader_read(struct value_reader * reader, t_uint32 num_channels, t_double * values, t_uint32 max_samples)
+{
+    t_uint32 total = 0;
+
+    for (;;)
+    {
+        t_uint32 count;
+        size_t   remaining;
+        size_t   length;
+
+        reader->start = (char *) value_parser_parse_lines(reader->start, reader->end, num_channels,
+            values + (size_t) total * num_channels, max_samples - total, &count);
+        total += count;
+
+        if (total == max_samples || (reader->at_end && reader->start == reader->end))
+            break;
+
+        if (reader->at_end)
+        {
+            /* The last line has no newline. One byte is always kept free for this */
+            *reader->end++ = '\n';
+            continue;
+        }
+
+        /* Move the incomplete line to the front of the buffer and read more text after it */
+        remaining = reader->end - reader->start;
+        memmove(reader->buffer, reader->start, remaining);
+        reader->start = reader->buffer;
+        reader->end   = reader->buffer + remaining;
+
+        if (remaining >= reader->size - 1)
+        {
+            /* The line fills the buffer, so treat what has been read as a whole line */
+            *reader->end++ = '\n';
+            continue;
+        }
+
+        length = fread(reader->end, 1, reader->size - 1 - remaining, reader->file);
+        if (length == 0)
+            reader->at_end = true;
+
+        reader->end += length;
+    }
+
+    return total;
+}
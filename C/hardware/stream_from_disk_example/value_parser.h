@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////
+//
+// value_parser.h - header file
+//
+// Parses text files of voltages, one sample per line with the values
+// separated by tabs, spaces or commas, as used by the
+// stream_from_disk_example.
+//
+// Numbers are converted without strtod in almost every case. The digits
+// of a number are gathered into a 64-bit integer. When the integer is
+// exactly representable as a t_double and the decimal exponent is at
+// most 22, the result is obtained from a single multiplication or
+// division by an exact power of ten. Otherwise the integer is multiplied
+// by a 128-bit power of five, as in the Eisel-Lemire algorithm used by
+// from_chars implementations, which decides the rounding exactly for all
+// but a tiny fraction of numbers. Either way the result is correctly
+// rounded, so it is exactly what strtod returns. The remaining numbers,
+// such as those with exponents beyond 64, halfway cases, infinities and
+// NaNs, are passed to strtod with the decimal point of the current
+// locale substituted, so the results never depend on the locale.
+//
+// Whole blocks of text are parsed at once. The ends of lines are found
+// using SSE2 instructions, sixteen characters at a time, where they are
+// available. No memory is allocated.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _value_parser_h
+#define _value_parser_h
+
+#include <stdio.h>
+
+#include "quanser_types.h"
+
+/*
+    Reads samples from a text file through a buffer supplied by the caller.
+*/
+struct value_reader
+{
+    FILE *  file;       /* file from which the text is read */
+    char *  buffer;     /* buffer into which the text is read */
+    size_t  size;       /* size of the buffer in bytes */
+    char *  start;      /* first character in the buffer not yet parsed */
+    char *  end;        /* end of the text in the buffer */
+    t_boolean at_end;   /* true once the end of the file has been reached */
+};
+
+/*
+    Parse one number the way strtod does, skipping leading white space. On success, stores the
+    value and a pointer to the character following the number and returns 0. Returns -1 and
+    stores zero if the text does not start with a number, as strtod does.
+*/
+extern t_int
+value_parser_parse_number(const char * text, const char ** end, t_double * value);
+
+/*
+    Parse complete lines of text, each ending in a newline, from the text up to end. The first
+    num_channels numbers of each line are stored in values, and missing numbers are stored as zero.
+    At most max_samples lines are parsed. Returns a pointer to the first line not parsed, which is
+    either incomplete or beyond max_samples lines, and stores the number of lines parsed.
+*/
+extern const char *
+value_parser_parse_lines(const char * text, const char * end, t_uint32 num_channels,
+                         t_double * values, t_uint32 max_samples, t_uint32 * num_samples);
+
+/*
+    Prepare to read samples from the current position in the file using the given buffer, which
+    should be much longer than a line. No memory is allocated.
+*/
+extern void
+value_reader_init(struct value_reader * reader, FILE * file, char * buffer, size_t size);
+
+/*
+    Read up to max_samples samples of num_channels values each. Returns the number of samples read,
+    which is less than max_samples only at the end of the file.
+*/
+extern t_uint32
+value_reader_read(struct value_reader * reader, t_uint32 num_channels, t_double * values, t_uint32 max_samples);
+
+#endif
@@ -0,0 +1,220 @@
+//////////////////////////////////////////////////////////////////
+//
+// waveform_file.c - C file
+//
+// Reads and writes the binary waveform file format described in
+// waveform_file.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#if !defined(_WIN32)
+#define _FILE_OFFSET_BITS 64
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#include "waveform_file.h"
+#include "quanser_file.h"
+
+/*
+    Offset of the first sample for the given number of channels.
+*/
+static t_uint32
+waveform_header_size(t_uint32 num_channels)
+{
+    const t_uint32 size = (t_uint32) (sizeof(struct waveform_header) + num_channels * sizeof(t_uint32));
+    return (size + 7) & ~7u; /* keep the samples aligned */
+}
+
+t_int
+waveform_writer_open(struct waveform_writer * writer, const char * filename, t_double frequency,
+                     const t_uint32 channels[], t_uint32 num_channels)
+{
+    static const t_ubyte padding[8] = { 0 };
+
+    struct waveform_header header;
+
+    memset(writer, 0, sizeof(*writer));
+    writer->num_channels = num_channels;
+
+    if (stdfile_open(filename, "wb", &writer->file) != 0)
+        return -1;
+
+    memcpy(header.magic, WAVEFORM_FILE_MAGIC, sizeof(header.magic));
+    header.version      = WAVEFORM_FILE_VERSION;
+    header.header_size  = waveform_header_size(num_channels);
+    header.frequency    = frequency;
+    header.num_samples  = 0; /* filled in when the file is closed */
+    header.num_channels = num_channels;
+    header.reserved     = 0;
+
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1
+        || fwrite(channels, sizeof(t_uint32), num_channels, writer->file) != num_channels
+        || fwrite(padding, 1, header.header_size - sizeof(header) - num_channels * sizeof(t_uint32), writer->file)
+           != header.header_size - sizeof(header) - num_channels * sizeof(t_uint32))
+    {
+        stdfile_close(writer->file);
+        writer->file = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+t_int
+waveform_writer_write(struct waveform_writer * writer, const t_double * voltages, t_uint32 num_samples)
+{
+    const size_t count = (size_t) num_samples * writer->num_channels;
+
+    if (fwrite(voltages, sizeof(t_double), count, writer->file) != count)
+        return -1;
+
+    writer->num_samples += num_samples;
+    return 0;
+}
+
+t_int
+waveform_writer_close(struct waveform_writer * writer)
+{
+    t_int result = -1;
+
+    if (writer->file == NULL)
+        return -1;
+
+    if (fseek(writer->file, (long) offsetof(struct waveform_header, num_samples), SEEK_SET) == 0
+        && fwrite(&writer->num_samples, sizeof(writer->num_samples), 1, writer->file) == 1)
+        result = 0;
+
+    if (stdfile_close(writer->file) != 0)
+        result = -1;
+
+    writer->file = NULL;
+    return result;
+}
+
+/*
+    Check the header of a mapped waveform file and locate the channels and samples.
+*/
+static t_int
+waveform_check(struct waveform_mapping * mapping)
+{
+    const struct waveform_header * header = (const struct waveform_header *) mapping->header;
+
+    if (mapping->size < sizeof(*header)
+        || memcmp(header->magic, WAVEFORM_FILE_MAGIC, sizeof(header->magic)) != 0
+        || header->version != WAVEFORM_FILE_VERSION
+        || header->num_channels == 0
+        || header->header_size != waveform_header_size(header->num_channels)
+        || mapping->size < header->header_size
+        || (mapping->size - header->header_size) / sizeof(t_double) / header->num_channels < header->num_samples)
+        return -1;
+
+    mapping->channels = (const t_uint32 *) (header + 1);
+    mapping->samples  = (const t_double *) ((const t_ubyte *) header + header->header_size);
+    return 0;
+}
+
+#if defined(_WIN32)
+
+t_int
+waveform_map(struct waveform_mapping * mapping, const char * filename)
+{
+    LARGE_INTEGER size;
+
+    memset(mapping, 0, sizeof(*mapping));
+
+    mapping->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (mapping->file == INVALID_HANDLE_VALUE)
+        return -1;
+
+    if (GetFileSizeEx(mapping->file, &size) && size.QuadPart >= (LONGLONG) sizeof(struct waveform_header))
+    {
+        mapping->size    = (size_t) size.QuadPart;
+        mapping->mapping = CreateFileMappingA(mapping->file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping->mapping != NULL)
+        {
+            mapping->header = (const struct waveform_header *) MapViewOfFile(mapping->mapping, FILE_MAP_READ, 0, 0, 0);
+            if (mapping->header != NULL)
+            {
+                if (waveform_check(mapping) == 0)
+                    return 0;
+
+                UnmapViewOfFile((LPCVOID) mapping->header);
+            }
+
+            CloseHandle(mapping->mapping);
+        }
+    }
+
+    CloseHandle(mapping->file);
+    mapping->header = NULL;
+    return -1;
+}
+
+void
+waveform_unmap(struct waveform_mapping * mapping)
+{
+    if (mapping->header != NULL)
+    {
+        UnmapViewOfFile((LPCVOID) mapping->header);
+        CloseHandle(mapping->mapping);
+        CloseHandle(mapping->file);
+        mapping->header = NULL;
+    }
+}
+
+#else
+
+t_int
+waveform_map(struct waveform_mapping * mapping, const char * filename)
+{
+    struct stat status;
+
+    memset(mapping, 0, sizeof(*mapping));
+
+    mapping->file = open(filename, O_RDONLY);
+    if (mapping->file < 0)
+        return -1;
+
+    if (fstat(mapping->file, &status) == 0 && status.st_size >= (off_t) sizeof(struct waveform_header))
+    {
+        void * base;
+
+        mapping->size = (size_t) status.st_size;
+        base = mmap(NULL, mapping->size, PROT_READ, MAP_SHARED, mapping->file, 0);
+        if (base != MAP_FAILED)
+        {
+            /* The samples are read once from start to end, so read ahead aggressively */
+            madvise(base, mapping->size, MADV_SEQUENTIAL);
+
+            mapping->header = (const struct waveform_header *) base;
+            if (waveform_check(mapping) == 0)
+                return 0;
+
+            munmap(base, mapping->size);
+        }
+    }
+
+    close(mapping->file);
+    mapping->header = NULL;
+    return -1;
+}
+
+void
+waveform_unmap(struct waveform_mapping * mapping)
+{
+    if (mapping->header != NULL)
+    {
+        munmap((void *) mapping->header, mapping->size);
+        close(mapping->file);
+        mapping->header = NULL;
+    }
+}
+
+#endif
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////
+//
+// waveform_file.h - header file
+//
+// Binary waveform file format played back by the
+// stream_from_disk_example.
+//
+// A waveform file consists of a header, the list of analog output
+// channels, padding to a multiple of eight bytes and then the samples.
+// Each sample holds one t_double voltage per channel, so the samples are
+// laid out exactly the way hil_task_write_analog expects its buffer.
+// Values are stored in the byte order of the machine that wrote the
+// file.
+//
+// Waveform files are played back by mapping them into memory and
+// passing slices of the mapping straight to hil_task_write_analog,
+// so no parsing or copying is done while the waveform is output.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _waveform_file_h
+#define _waveform_file_h
+
+#include <stdio.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "quanser_types.h"
+
+#define WAVEFORM_FILE_MAGIC     "QWAVEFRM"  /* first eight bytes of every waveform file */
+#define WAVEFORM_FILE_VERSION   (1)         /* version of the waveform file format */
+
+/*
+    The header at the start of the file. It is followed immediately by the channel numbers, each
+    stored as a t_uint32, and then by padding up to header_size. The fields are ordered so that the
+    structure contains no padding.
+*/
+struct waveform_header
+{
+    char     magic[8];              /* WAVEFORM_FILE_MAGIC (not null-terminated) */
+    t_uint32 version;               /* WAVEFORM_FILE_VERSION */
+    t_uint32 header_size;           /* offset of the first sample from the start of the file (a multiple of 8) */
+    t_double frequency;             /* sampling frequency in Hz */
+    t_uint64 num_samples;           /* number of samples in the file */
+    t_uint32 num_channels;          /* number of analog output channels */
+    t_uint32 reserved;              /* zero */
+};
+
+struct waveform_writer
+{
+    FILE *   file;                  /* file to which the waveform is written */
+    t_uint32 num_channels;          /* number of channels in each sample */
+    t_uint64 num_samples;           /* number of samples written so far */
+};
+
+/*
+    A waveform file mapped into memory for playback.
+*/
+struct waveform_mapping
+{
+    const struct waveform_header * header;      /* header of the waveform */
+    const t_uint32 *               channels;    /* channel numbers */
+    const t_double *               samples;     /* the samples, num_channels voltages per sample */
+    size_t                         size;        /* size of the mapping in bytes */
+#if defined(_WIN32)
+    HANDLE                         file;        /* waveform file */
+    HANDLE                         mapping;     /* file mapping of the waveform file */
+#else
+    int                            file;        /* waveform file descriptor */
+#endif
+};
+
+/*
+    Create a waveform file and write its header. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+waveform_writer_open(struct waveform_writer * writer, const char * filename, t_double frequency,
+                     const t_uint32 channels[], t_uint32 num_channels);
+
+/*
+    Append samples to the waveform, num_channels voltages per sample.
+    Returns 0 on success and -1 on failure.
+*/
+extern t_int
+waveform_writer_write(struct waveform_writer * writer, const t_double * voltages, t_uint32 num_samples);
+
+/*
+    Record the number of samples in the header and close the file.
+    Returns 0 on success and -1 on failure.
+*/
+extern t_int
+waveform_writer_close(struct waveform_writer * writer);
+
+/*
+    Map a waveform file into memory and check its header. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+waveform_map(struct waveform_mapping * mapping, const char * filename);
+
+/*
+    Unmap a waveform file.
+*/
+extern void
+waveform_unmap(struct waveform_mapping * mapping);
+
+#endif
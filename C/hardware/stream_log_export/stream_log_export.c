@@ -0,0 +1,227 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_log_export.c - C file
+//
+// This example converts a binary stream log recorded by the
+// stream_to_disk_example into text. The text file has the same format
+// as the text files written by the stream_to_disk_example, so existing
+// tools for processing those files may be used on binary recordings.
+//
+// Segmented recordings are converted by entering the name of the first
+// segment to convert, such as data_0000.qsl. The following segments are
+// converted in turn. A time range may be given to convert only part of
+// a recording. The index at the end of each segment is used to skip
+// segments outside the range and to start reading at the chunk holding
+// the start of the range, so only the data in the range is read.
+//
+// No hardware is required to run this example.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+    
+#include "stream_log_export.h"
+
+/*
+    The state of a conversion in progress.
+*/
+struct export_state
+{
+    FILE *   file;              /* text file to which the samples are written */
+    char *   text;              /* buffer in which a chunk is formatted */
+    t_double period;            /* sampling period in seconds */
+    t_double time;              /* time of the next sample */
+    t_uint64 next_sample;       /* index of the next sample */
+    t_uint64 start_sample;      /* index of the first sample to convert */
+    t_uint64 end_sample;        /* index of the sample following the last sample to convert */
+    t_uint64 total_samples;     /* number of samples converted so far */
+};
+
+/*
+    Read a file name from the console, using the default if nothing is entered.
+*/
+static void
+read_filename(char * filename, size_t length, const char * default_filename)
+{
+    fgets(filename, (int) length, stdin); /* use fgets to avoid deprecation warnings that occur on some systems */
+    filename[string_length(filename, length) - 1] = '\0';
+    if (filename[0] == '\0')
+        string_copy(filename, length, default_filename);
+}
+
+/*
+    Read a time in seconds from the console. Returns the default if nothing is entered.
+*/
+static t_double
+read_time(t_double default_time)
+{
+    char line[64];
+
+    fgets(line, ARRAY_LENGTH(line), stdin);
+    if (line[0] == '\n' || line[0] == '\0')
+        return default_time;
+
+    return atof(line);
+}
+
+/*
+    Write the samples of one chunk that lie within the range being converted.
+*/
+static void
+export_chunk(struct export_state * state, const struct stream_log_reader * reader, const struct stream_log_chunk * chunk,
+             const t_double * voltages, const t_int32 * counts, t_int num_samples)
+{
+    const t_uint32 num_analog_channels  = reader->header.num_analog_channels;
+    const t_uint32 num_encoder_channels = reader->header.num_encoder_channels;
+
+    char * text  = state->text;
+    t_int  index = 0;
+
+    /* Skip any samples before the start of the range and stop at its end */
+    if (chunk->first_sample < state->start_sample)
+        index = (t_int) (state->start_sample - chunk->first_sample);
+    if (chunk->first_sample + num_samples > state->end_sample)
+        num_samples = (t_int) (state->end_sample - chunk->first_sample);
+
+    /* Account for any samples missing from the recording so the times remain correct */
+    for (; state->next_sample < chunk->first_sample + index; state->next_sample++)
+        state->time += state->period;
+
+    /* Format the samples of the chunk and write them with one call */
+    for (; index < num_samples; index++)
+    {
+        text = text_format_sample(text, state->time,
+                                  reader->analog_channels, &voltages[(size_t) index * num_analog_channels], num_analog_channels,
+                                  reader->encoder_channels, &counts[(size_t) index * num_encoder_channels], num_encoder_channels);
+        state->time += state->period;
+
+        state->next_sample++;
+        state->total_samples++;
+    }
+
+    fwrite(state->text, 1, text - state->text, state->file);
+}
+
+int main(int argc, char * argv[])
+{
+    static const char default_input_filename[]  = "data.qsl";
+    static const char default_output_filename[] = "data.txt";
+
+    struct stream_log_reader reader;
+    struct export_state state;
+    t_boolean is_segmented;
+    t_uint32 segment_number;
+    t_double start_time;
+    t_double end_time;
+    char input_filename[_MAX_PATH + STREAM_SEGMENT_MAX_SUFFIX];
+    char output_filename[_MAX_PATH];
+    char base_name[_MAX_PATH];
+
+    printf("This example converts a binary stream log to text.\n\n");
+
+    printf("Enter the name of the stream log, or of the first segment, to convert [%s]:\n", default_input_filename);
+    read_filename(input_filename, sizeof(input_filename), default_input_filename);
+
+    printf("Enter the name of the text file to which to write the data [%s]:\n", default_output_filename);
+    read_filename(output_filename, sizeof(output_filename), default_output_filename);
+
+    printf("Enter the time at which to start converting, in seconds [start]:\n");
+    start_time = read_time(0);
+
+    printf("Enter the time at which to stop converting, in seconds [end]:\n");
+    end_time = read_time(-1);
+
+    is_segmented = (stream_segment_parse_filename(input_filename, base_name, sizeof(base_name), &segment_number) == 0);
+
+    if (stream_log_reader_open(&reader, input_filename) == 0)
+    {
+        const struct stream_log_header first_header = reader.header;
+        const t_uint32 num_analog_channels          = first_header.num_analog_channels;
+        const t_uint32 num_encoder_channels         = first_header.num_encoder_channels;
+
+        t_double * voltages = (t_double *) malloc((size_t) first_header.max_chunk_samples * num_analog_channels * sizeof(t_double) + 1);
+        t_int32 *  counts   = (t_int32 *) malloc((size_t) first_header.max_chunk_samples * num_encoder_channels * sizeof(t_int32) + 1);
+
+        state.text = (char *) malloc(first_header.max_chunk_samples * text_format_sample_size(num_analog_channels, num_encoder_channels));
+
+        state.period        = 1.0 / first_header.frequency;
+        state.start_sample  = (start_time > 0) ? (t_uint64) (start_time * first_header.frequency + 0.5) : 0;
+        state.end_sample    = (end_time >= 0) ? (t_uint64) (end_time * first_header.frequency + 0.5) : (t_uint64) -1;
+        state.next_sample   = state.start_sample;
+        state.time          = state.start_sample * state.period;
+        state.total_samples = 0;
+
+        if (voltages != NULL && counts != NULL && state.text != NULL && stdfile_open(output_filename, "wt", &state.file) == 0)
+        {
+            struct stream_log_chunk chunk;
+            t_boolean is_open = true;
+            t_int samples_read = 0;
+
+            /* Each chunk is formatted in full before it is written, so the file needs no buffering of its own */
+            setvbuf(state.file, NULL, _IONBF, 0);
+
+            printf("\nRecording of %u analog and %u encoder channels at %g Hz.\n",
+                num_analog_channels, num_encoder_channels, first_header.frequency);
+
+            while (is_open)
+            {
+                /* Every segment of a recording has the same channels */
+                if (reader.header.num_analog_channels != num_analog_channels
+                    || reader.header.num_encoder_channels != num_encoder_channels
+                    || reader.header.max_chunk_samples > first_header.max_chunk_samples)
+                {
+                    printf("The stream log \"%s\" does not belong to the same recording.\n", input_filename);
+                    samples_read = -1;
+                }
+
+                /* Use the index, if there is one, to skip segments before the range and go straight to its start */
+                else if (stream_log_reader_load_index(&reader) == 0 && reader.trailer.end_sample <= state.start_sample)
+                    samples_read = 0;
+                else
+                {
+                    samples_read = stream_log_reader_seek(&reader, state.start_sample);
+                    if (samples_read == 0)
+                        samples_read = stream_log_reader_read(&reader, &chunk, voltages, counts);
+
+                    while (samples_read > 0 && chunk.first_sample < state.end_sample)
+                    {
+                        export_chunk(&state, &reader, &chunk, voltages, counts, samples_read);
+                        samples_read = stream_log_reader_read(&reader, &chunk, voltages, counts);
+                    }
+
+                    if (samples_read < 0)
+                        printf("The stream log \"%s\" is corrupt.\n", input_filename);
+                }
+
+                stream_log_reader_close(&reader);
+                is_open = false;
+
+                if (samples_read >= 0 && is_segmented && (samples_read == 0 || chunk.first_sample < state.end_sample))
+                {
+                    /* Continue with the next segment, if there is one */
+                    is_open = (stream_segment_filename(input_filename, sizeof(input_filename), base_name, ++segment_number) == 0
+                               && stream_log_reader_open(&reader, input_filename) == 0);
+                }
+            }
+
+            stdfile_close(state.file);
+
+            if (samples_read < 0)
+                printf("Only the first %.0f samples were converted.\n", (double) state.total_samples);
+            else
+                printf("Converted %.0f samples to \"%s\".\n", (double) state.total_samples, output_filename);
+        }
+        else
+            printf("Unable to open file \"%s\".\n", output_filename);
+
+        free(voltages);
+        free(counts);
+        free(state.text);
+    }
+    else
+        printf("Unable to open the stream log \"%s\".\n", input_filename);
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
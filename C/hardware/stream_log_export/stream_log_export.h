@@ -0,0 +1,16 @@
+//////////////////////////////////////////////////////////////////
+//
+//	stream_log_export.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "quanser_messages.h"
+#include "quanser_file.h"
+#include "quanser_string.h"
+
+#include "stream_log.h"
+#include "stream_segment.h"
+#include "text_format.h"
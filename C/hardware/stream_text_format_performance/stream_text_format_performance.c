@@ -0,0 +1,253 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_text_format_performance.c - C file
+//
+// This example compares how quickly the text recordings of the
+// stream_to_disk_example can be produced using fprintf, as the example
+// originally did, and using the formatter in text_format.h, which
+// formats each block of samples into one buffer and writes it with a
+// single call.
+//
+// Both methods write the same synthetic recording of two analog and two
+// encoder channels to a file. The files are then compared to confirm
+// that the two methods produce exactly the same text.
+//
+// No hardware is required to run this example.
+//
+// This performance example demonstrates the use of the following functions:
+//    timeout_get_high_resolution_time
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include "stream_text_format_performance.h"
+
+#define SAMPLES_PER_BLOCK   1000    /* samples written per block, as in the stream_to_disk_example */
+#define NUM_BLOCKS          1000    /* blocks written by each method */
+
+static const t_uint32 analog_channels[]  = { 0, 1 };
+static const t_uint32 encoder_channels[] = { 0, 1 };
+static const t_double frequency          = 1000;
+
+#define NUM_ANALOG_CHANNELS     ARRAY_LENGTH(analog_channels)
+#define NUM_ENCODER_CHANNELS    ARRAY_LENGTH(encoder_channels)
+
+static t_double voltages[SAMPLES_PER_BLOCK][NUM_ANALOG_CHANNELS];
+static t_int32  counts[SAMPLES_PER_BLOCK][NUM_ENCODER_CHANNELS];
+
+/*
+    Fill the block with voltages quantized like those of a 16-bit ADC and slowly turning encoders.
+*/
+static void
+fill_block(t_uint block_number)
+{
+    t_uint index;
+    t_uint channel;
+
+    for (index = 0; index < SAMPLES_PER_BLOCK; index++)
+    {
+        const t_double time = (block_number * SAMPLES_PER_BLOCK + index) / frequency;
+
+        for (channel = 0; channel < NUM_ANALOG_CHANNELS; channel++)
+            voltages[index][channel] = floor(10.0 * sin(2 * M_PI * (channel + 1) * time) * 3276.8 + 0.5) / 3276.8;
+        for (channel = 0; channel < NUM_ENCODER_CHANNELS; channel++)
+            counts[index][channel] = (t_int32) floor(2048.0 * sin(M_PI * (channel + 1) * time) * (time + 1));
+    }
+}
+
+/*
+    Write the recording with fprintf, the way the stream_to_disk_example originally did.
+    Returns the time taken in seconds, or a negative value if the file could not be written.
+*/
+static t_double
+write_with_fprintf(const char * filename)
+{
+    const t_double period = 1.0 / frequency;
+
+    t_timeout start_time, stop_time, interval;
+    t_double  elapsed = 0;
+    t_double  time    = 0;
+    FILE *    file;
+    t_uint    block;
+    t_uint    index;
+    t_uint    channel;
+
+    if (stdfile_open(filename, "wt", &file) != 0)
+        return -1;
+
+    for (block = 0; block < NUM_BLOCKS; block++)
+    {
+        fill_block(block);
+
+        /* Only the formatting and writing are timed */
+        timeout_get_high_resolution_time(&start_time);
+
+        for (index = 0; index < SAMPLES_PER_BLOCK; index++)
+        {
+            fprintf(file, "t: %8.4f  ", time);
+            time += period;
+
+            for (channel = 0; channel < NUM_ANALOG_CHANNELS; channel++)
+                fprintf(file, "ADC #%d: %5.3f    ", analog_channels[channel], voltages[index][channel]);
+            for (channel = 0; channel < NUM_ENCODER_CHANNELS; channel++)
+                fprintf(file, "ENC #%d: %5d    ", encoder_channels[channel], counts[index][channel]);
+            fprintf(file, "\n");
+        }
+
+        timeout_get_high_resolution_time(&stop_time);
+        timeout_subtract(&interval, &stop_time, &start_time);
+        elapsed += interval.seconds + interval.nanoseconds * 1e-9;
+    }
+
+    stdfile_close(file);
+    return elapsed;
+}
+
+/*
+    Write the recording with the formatter in text_format.h, one write per block.
+    Returns the time taken in seconds, or a negative value if the file could not be written.
+*/
+static t_double
+write_with_text_format(const char * filename)
+{
+    const t_double period = 1.0 / frequency;
+
+    t_timeout start_time, stop_time, interval;
+    t_double  elapsed = 0;
+    t_double  time    = 0;
+    FILE *    file;
+    char *    buffer;
+    t_uint    block;
+    t_uint    index;
+
+    buffer = (char *) malloc(SAMPLES_PER_BLOCK * text_format_sample_size(NUM_ANALOG_CHANNELS, NUM_ENCODER_CHANNELS));
+    if (buffer == NULL)
+        return -1;
+
+    if (stdfile_open(filename, "wt", &file) != 0)
+    {
+        free(buffer);
+        return -1;
+    }
+
+    setvbuf(file, NULL, _IONBF, 0);
+
+    for (block = 0; block < NUM_BLOCKS; block++)
+    {
+        char * text = buffer;
+
+        fill_block(block);
+
+        timeout_get_high_resolution_time(&start_time);
+
+        for (index = 0; index < SAMPLES_PER_BLOCK; index++)
+        {
+            text = text_format_sample(text, time, analog_channels, voltages[index], NUM_ANALOG_CHANNELS,
+                                      encoder_channels, counts[index], NUM_ENCODER_CHANNELS);
+            time += period;
+        }
+        fwrite(buffer, 1, text - buffer, file);
+
+        timeout_get_high_resolution_time(&stop_time);
+        timeout_subtract(&interval, &stop_time, &start_time);
+        elapsed += interval.seconds + interval.nanoseconds * 1e-9;
+    }
+
+    stdfile_close(file);
+    free(buffer);
+    return elapsed;
+}
+
+/*
+    Returns 0 if the two files have the same contents, 1 if they differ and -1 if either cannot be read.
+*/
+static t_int
+compare_files(const char * first_filename, const char * second_filename)
+{
+    static char first_buffer[65536];
+    static char second_buffer[65536];
+
+    FILE * first;
+    FILE * second;
+    t_int  result = 0;
+
+    if (stdfile_open(first_filename, "rb", &first) != 0)
+        return -1;
+
+    if (stdfile_open(second_filename, "rb", &second) != 0)
+    {
+        stdfile_close(first);
+        return -1;
+    }
+
+    for (;;)
+    {
+        const size_t first_length  = fread(first_buffer, 1, sizeof(first_buffer), first);
+        const size_t second_length = fread(second_buffer, 1, sizeof(second_buffer), second);
+
+        if (first_length != second_length || memcmp(first_buffer, second_buffer, first_length) != 0)
+        {
+            result = 1;
+            break;
+        }
+
+        if (first_length == 0)
+            break;
+    }
+
+    stdfile_close(first);
+    stdfile_close(second);
+    return result;
+}
+
+int main(int argc, char * argv[])
+{
+    static const char fprintf_filename[]     = "fprintf.txt";
+    static const char text_format_filename[] = "text_format.txt";
+
+    const t_double samples = (t_double) SAMPLES_PER_BLOCK * NUM_BLOCKS;
+    t_double fprintf_time;
+    t_double text_format_time;
+
+    printf("Formatting %.0f samples of %u analog and %u encoder channels as text.\n\n",
+        samples, (unsigned) NUM_ANALOG_CHANNELS, (unsigned) NUM_ENCODER_CHANNELS);
+
+    fprintf_time = write_with_fprintf(fprintf_filename);
+    if (fprintf_time >= 0)
+        printf("fprintf:     %f seconds (%.0f samples/s or %.3f usecs per sample)\n",
+            fprintf_time, samples / fprintf_time, fprintf_time / samples * 1e6);
+    else
+        printf("Unable to write the file \"%s\".\n", fprintf_filename);
+
+    text_format_time = write_with_text_format(text_format_filename);
+    if (text_format_time >= 0)
+        printf("text_format: %f seconds (%.0f samples/s or %.3f usecs per sample)\n",
+            text_format_time, samples / text_format_time, text_format_time / samples * 1e6);
+    else
+        printf("Unable to write the file \"%s\".\n", text_format_filename);
+
+    if (fprintf_time >= 0 && text_format_time >= 0)
+    {
+        printf("\nThe formatter is %.1f times as fast as fprintf.\n", fprintf_time / text_format_time);
+
+        switch (compare_files(fprintf_filename, text_format_filename))
+        {
+            case 0:
+                printf("The two files are identical.\n");
+                break;
+
+            case 1:
+                printf("The two files DIFFER.\n");
+                break;
+
+            default:
+                printf("Unable to compare the two files.\n");
+                break;
+        }
+    }
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
@@ -0,0 +1,17 @@
+//////////////////////////////////////////////////////////////////
+//
+//	stream_text_format_performance.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "quanser_file.h"
+#include "quanser_time.h"
+
+#include "text_format.h"
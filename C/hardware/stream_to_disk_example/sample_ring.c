@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////
+//
+// sample_ring.c - C file
+//
+// Implements the lock-free single-producer/single-consumer ring of
+// sample blocks described in sample_ring.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sample_ring.h"
+
+/*
+    The head and tail are each written by one thread and read by the other. The producer
+    publishes a block by storing the head with release semantics after filling the block,
+    and the consumer loads the head with acquire semantics before reading the block. The
+    tail is handled the same way in the opposite direction.
+*/
+#if defined(_MSC_VER)
+/* Volatile accesses have acquire and release semantics with /volatile:ms, the default on x86 and x64 */
+#define LOAD_ACQUIRE(variable)          (*(volatile t_uint32 *) &(variable))
+#define STORE_RELEASE(variable, value)  (*(volatile t_uint32 *) &(variable) = (value))
+#else
+#define LOAD_ACQUIRE(variable)          __atomic_load_n(&(variable), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(variable, value)  __atomic_store_n(&(variable), (value), __ATOMIC_RELEASE)
+#endif
+
+t_int
+sample_ring_create(struct sample_ring * ring, size_t block_size, t_uint32 num_blocks)
+{
+    memset(ring, 0, sizeof(*ring));
+    if (num_blocks == 0 || (num_blocks & (num_blocks - 1)) != 0)
+        return -1;
+
+    /* Round the block size up to a whole number of cache lines so adjacent blocks do not share a line */
+    block_size = (block_size + SAMPLE_RING_CACHE_LINE_SIZE - 1) & ~(size_t) (SAMPLE_RING_CACHE_LINE_SIZE - 1);
+
+    ring->blocks = (t_ubyte *) malloc(block_size * num_blocks);
+    if (ring->blocks == NULL)
+        return -1;
+
+    /* Touch every block now so no page faults occur while the reader is running */
+    memset(ring->blocks, 0, block_size * num_blocks);
+
+    ring->block_size = block_size;
+    ring->num_blocks = num_blocks;
+    return 0;
+}
+
+void
+sample_ring_destroy(struct sample_ring * ring)
+{
+    free(ring->blocks);
+    ring->blocks = NULL;
+}
+
+void *
+sample_ring_acquire_write(struct sample_ring * ring)
+{
+    const t_uint32 head = ring->head;
+
+    if (head - LOAD_ACQUIRE(ring->tail) >= ring->num_blocks)
+        return NULL;
+
+    return ring->blocks + (head & (ring->num_blocks - 1)) * ring->block_size;
+}
+
+void
+sample_ring_commit_write(struct sample_ring * ring)
+{
+    const t_uint32 head  = ring->head + 1;
+    const t_uint32 count = head - LOAD_ACQUIRE(ring->tail);
+
+    if (count > ring->high_water_mark)
+        ring->high_water_mark = count;
+
+    STORE_RELEASE(ring->head, head);
+}
+
+void
+sample_ring_drop_write(struct sample_ring * ring)
+{
+    ring->dropped_blocks++;
+}
+
+void
+sample_ring_close(struct sample_ring * ring)
+{
+    STORE_RELEASE(ring->closed, 1);
+}
+
+void *
+sample_ring_acquire_read(struct sample_ring * ring)
+{
+    const t_uint32 tail = ring->tail;
+
+    if (LOAD_ACQUIRE(ring->head) == tail)
+        return NULL;
+
+    return ring->blocks + (tail & (ring->num_blocks - 1)) * ring->block_size;
+}
+
+void
+sample_ring_release_read(struct sample_ring * ring)
+{
+    STORE_RELEASE(ring->tail, ring->tail + 1);
+}
+
+t_uint32
+sample_ring_count(struct sample_ring * ring)
+{
+    return LOAD_ACQUIRE(ring->head) - ring->tail;
+}
+
+t_boolean
+sample_ring_is_drained(struct sample_ring * ring)
+{
+    /* Check closed before head, so a block committed just before closing is never missed */
+    return LOAD_ACQUIRE(ring->closed) && LOAD_ACQUIRE(ring->head) == ring->tail;
+}
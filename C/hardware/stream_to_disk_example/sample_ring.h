@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////
+//
+// sample_ring.h - header file
+//
+// A lock-free single-producer/single-consumer ring of fixed-size
+// sample blocks. The thread reading the HIL task acquires an empty
+// block, fills it and commits it. The thread writing to disk acquires
+// the oldest committed block, writes it out and releases it. Neither
+// thread ever blocks the other and all memory is allocated up front.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _sample_ring_h
+#define _sample_ring_h
+
+#include "quanser_types.h"
+
+#define SAMPLE_RING_CACHE_LINE_SIZE     (64)
+
+struct sample_ring
+{
+    t_ubyte * blocks;           /* storage for all the blocks */
+    size_t    block_size;       /* size of one block in bytes */
+    t_uint32  num_blocks;       /* number of blocks in the ring (a power of two) */
+
+    /* Written by the producer only. Kept on its own cache line so the consumer does not stall the producer */
+    t_ubyte   producer_padding[SAMPLE_RING_CACHE_LINE_SIZE];
+    t_uint32  head;             /* number of blocks committed by the producer */
+    t_uint32  closed;           /* non-zero once the producer will commit no more blocks */
+    t_uint32  high_water_mark;  /* largest number of blocks ever waiting to be consumed */
+    t_uint32  dropped_blocks;   /* number of blocks the producer dropped because the ring was full */
+
+    /* Written by the consumer only */
+    t_ubyte   consumer_padding[SAMPLE_RING_CACHE_LINE_SIZE];
+    t_uint32  tail;             /* number of blocks released by the consumer */
+    t_ubyte   tail_padding[SAMPLE_RING_CACHE_LINE_SIZE];
+};
+
+/*
+    Allocate a ring of num_blocks blocks of block_size bytes each. The number of blocks
+    must be a power of two. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+sample_ring_create(struct sample_ring * ring, size_t block_size, t_uint32 num_blocks);
+
+/*
+    Free the blocks of the ring.
+*/
+extern void
+sample_ring_destroy(struct sample_ring * ring);
+
+/*
+    Producer: get the next empty block, or NULL if the ring is full.
+*/
+extern void *
+sample_ring_acquire_write(struct sample_ring * ring);
+
+/*
+    Producer: pass the block returned by sample_ring_acquire_write to the consumer.
+*/
+extern void
+sample_ring_commit_write(struct sample_ring * ring);
+
+/*
+    Producer: record that a block had to be dropped because the ring was full.
+*/
+extern void
+sample_ring_drop_write(struct sample_ring * ring);
+
+/*
+    Producer: indicate that no more blocks will be committed.
+*/
+extern void
+sample_ring_close(struct sample_ring * ring);
+
+/*
+    Consumer: get the oldest committed block, or NULL if there is none.
+*/
+extern void *
+sample_ring_acquire_read(struct sample_ring * ring);
+
+/*
+    Consumer: return the block returned by sample_ring_acquire_read to the producer.
+*/
+extern void
+sample_ring_release_read(struct sample_ring * ring);
+
+/*
+    Consumer: the number of committed blocks waiting to be consumed.
+*/
+extern t_uint32
+sample_ring_count(struct sample_ring * ring);
+
+/*
+    Consumer: returns non-zero once the producer has closed the ring and every block has been consumed.
+*/
+extern t_boolean
+sample_ring_is_drained(struct sample_ring * ring);
+
+#endif
@@ -0,0 +1,377 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_codec.c - C file
+//
+// Implements the compression of stream log chunks described in
+// stream_codec.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "stream_codec.h"
+
+/* Largest number of bits used to encode one voltage after the first: control bits, leading zeros, length and value */
+#define MAX_VOLTAGE_BITS    (2 + 5 + 6 + 64)
+
+/* Largest number of bytes used to encode one count */
+#define MAX_COUNT_BYTES     (5)
+
+/*
+    Writes a stream of bits, most significant bit first.
+*/
+struct bit_writer
+{
+    t_ubyte * output;       /* next byte to write */
+    t_uint64  bits;         /* bits not yet written */
+    t_uint32  num_bits;     /* number of bits not yet written (less than 8 between calls) */
+};
+
+/*
+    Reads a stream of bits written by a bit_writer.
+*/
+struct bit_reader
+{
+    const t_ubyte * input;  /* next byte to read */
+    const t_ubyte * end;    /* end of the input */
+    t_uint64        bits;   /* bits read but not yet returned */
+    t_uint32        num_bits;
+};
+
+static t_uint32
+count_leading_zeros(t_uint64 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, (unsigned long) (value >> 32)))
+        return 31 - index;
+    _BitScanReverse(&index, (unsigned long) value);
+    return 63 - index;
+#else
+    return (t_uint32) __builtin_clzll(value);
+#endif
+}
+
+static t_uint32
+count_trailing_zeros(t_uint64 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long) value))
+        return index;
+    _BitScanForward(&index, (unsigned long) (value >> 32));
+    return 32 + index;
+#else
+    return (t_uint32) __builtin_ctzll(value);
+#endif
+}
+
+/*
+    Write the low num_bits bits of the value, where num_bits is at most 32.
+*/
+static void
+put_bits(struct bit_writer * writer, t_uint32 value, t_uint32 num_bits)
+{
+    writer->bits      = (writer->bits << num_bits) | value;
+    writer->num_bits += num_bits;
+    while (writer->num_bits >= 8)
+    {
+        writer->num_bits -= 8;
+        *writer->output++ = (t_ubyte) (writer->bits >> writer->num_bits);
+    }
+}
+
+/*
+    Write the low num_bits bits of the value, where num_bits is at most 64.
+*/
+static void
+put_long_bits(struct bit_writer * writer, t_uint64 value, t_uint32 num_bits)
+{
+    if (num_bits > 32)
+    {
+        put_bits(writer, (t_uint32) (value >> 32), num_bits - 32);
+        num_bits = 32;
+    }
+    put_bits(writer, (t_uint32) value & (t_uint32) (0xFFFFFFFFu >> (32 - num_bits)), num_bits);
+}
+
+/*
+    Pad the bit stream with zeros to a whole byte.
+*/
+static void
+flush_bits(struct bit_writer * writer)
+{
+    if (writer->num_bits > 0)
+        put_bits(writer, 0, 8 - writer->num_bits);
+}
+
+/*
+    Read num_bits bits, where num_bits is at most 32. Returns -1 at the end of the input.
+*/
+static t_int
+get_bits(struct bit_reader * reader, t_uint32 num_bits, t_uint32 * value)
+{
+    while (reader->num_bits < num_bits)
+    {
+        if (reader->input == reader->end)
+            return -1;
+        reader->bits      = (reader->bits << 8) | *reader->input++;
+        reader->num_bits += 8;
+    }
+
+    reader->num_bits -= num_bits;
+    *value = (t_uint32) (reader->bits >> reader->num_bits) & (t_uint32) (0xFFFFFFFFu >> (32 - num_bits));
+    return 0;
+}
+
+/*
+    Read num_bits bits, where num_bits is at most 64. Returns -1 at the end of the input.
+*/
+static t_int
+get_long_bits(struct bit_reader * reader, t_uint32 num_bits, t_uint64 * value)
+{
+    t_uint32 high = 0;
+    t_uint32 low;
+
+    if (num_bits > 32)
+    {
+        if (get_bits(reader, num_bits - 32, &high) != 0)
+            return -1;
+        num_bits = 32;
+    }
+
+    if (get_bits(reader, num_bits, &low) != 0)
+        return -1;
+
+    *value = ((t_uint64) high << 32) | low;
+    return 0;
+}
+
+static void
+encode_voltages(struct bit_writer * writer, const t_double * voltages, t_uint32 stride, t_uint32 num_samples)
+{
+    t_uint64 previous;
+    t_uint32 previous_leading  = 64; /* no window yet */
+    t_uint32 previous_trailing = 0;
+    t_uint32 index;
+
+    if (num_samples == 0)
+        return;
+
+    memcpy(&previous, &voltages[0], sizeof(previous));
+    put_long_bits(writer, previous, 64);
+
+    for (index = 1; index < num_samples; index++)
+    {
+        t_uint64 value;
+        t_uint64 difference;
+
+        memcpy(&value, &voltages[(size_t) index * stride], sizeof(value));
+        difference = value ^ previous;
+        previous   = value;
+
+        if (difference == 0)
+            put_bits(writer, 0, 1);
+        else
+        {
+            t_uint32 leading  = count_leading_zeros(difference);
+            t_uint32 trailing = count_trailing_zeros(difference);
+
+            if (leading > 31)
+                leading = 31; /* the number of leading zeros is stored in five bits */
+
+            if (leading >= previous_leading && trailing >= previous_trailing)
+            {
+                /* The meaningful bits fit in the window of the previous value */
+                put_bits(writer, 2, 2);
+                put_long_bits(writer, difference >> previous_trailing, 64 - previous_leading - previous_trailing);
+            }
+            else
+            {
+                const t_uint32 length = 64 - leading - trailing;
+
+                put_bits(writer, 3, 2);
+                put_bits(writer, leading, 5);
+                put_bits(writer, length & 63, 6); /* a length of 64 is stored as 0 */
+                put_long_bits(writer, difference >> trailing, length);
+
+                previous_leading  = leading;
+                previous_trailing = trailing;
+            }
+        }
+    }
+
+    flush_bits(writer);
+}
+
+static t_int
+decode_voltages(struct bit_reader * reader, t_double * voltages, t_uint32 stride, t_uint32 num_samples)
+{
+    t_uint64 previous;
+    t_uint32 previous_leading  = 64;
+    t_uint32 previous_trailing = 0;
+    t_uint32 index;
+
+    if (num_samples == 0)
+        return 0;
+
+    if (get_long_bits(reader, 64, &previous) != 0)
+        return -1;
+    memcpy(&voltages[0], &previous, sizeof(previous));
+
+    for (index = 1; index < num_samples; index++)
+    {
+        t_uint32 control;
+        t_uint64 difference = 0;
+
+        if (get_bits(reader, 1, &control) != 0)
+            return -1;
+
+        if (control != 0)
+        {
+            if (get_bits(reader, 1, &control) != 0)
+                return -1;
+
+            if (control != 0)
+            {
+                t_uint32 leading;
+                t_uint32 length;
+
+                if (get_bits(reader, 5, &leading) != 0 || get_bits(reader, 6, &length) != 0)
+                    return -1;
+                if (length == 0)
+                    length = 64;
+                if (leading + length > 64)
+                    return -1;
+
+                previous_leading  = leading;
+                previous_trailing = 64 - leading - length;
+            }
+            else if (previous_leading == 64)
+                return -1;
+
+            if (get_long_bits(reader, 64 - previous_leading - previous_trailing, &difference) != 0)
+                return -1;
+            difference <<= previous_trailing;
+        }
+
+        previous ^= difference;
+        memcpy(&voltages[(size_t) index * stride], &previous, sizeof(previous));
+    }
+
+    /* Discard the padding to the next byte */
+    reader->num_bits = 0;
+    return 0;
+}
+
+static t_ubyte *
+encode_counts(t_ubyte * output, const t_int32 * counts, t_uint32 stride, t_uint32 num_samples)
+{
+    t_uint32 previous = 0;
+    t_uint32 index;
+
+    for (index = 0; index < num_samples; index++)
+    {
+        const t_uint32 value      = (t_uint32) counts[(size_t) index * stride];
+        const t_uint32 difference = value - previous;
+        t_uint32       zigzag     = (difference << 1) ^ (t_uint32) -(t_int32) (difference >> 31);
+
+        previous = value;
+        while (zigzag >= 0x80)
+        {
+            *output++ = (t_ubyte) (zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        *output++ = (t_ubyte) zigzag;
+    }
+
+    return output;
+}
+
+static const t_ubyte *
+decode_counts(const t_ubyte * input, const t_ubyte * end, t_int32 * counts, t_uint32 stride, t_uint32 num_samples)
+{
+    t_uint32 previous = 0;
+    t_uint32 index;
+
+    for (index = 0; index < num_samples; index++)
+    {
+        t_uint32 zigzag = 0;
+        t_uint32 shift  = 0;
+        t_ubyte  byte;
+
+        do
+        {
+            if (input == end || shift >= 35)
+                return NULL;
+            byte    = *input++;
+            zigzag |= (t_uint32) (byte & 0x7F) << shift;
+            shift  += 7;
+        } while (byte & 0x80);
+
+        previous += (zigzag >> 1) ^ (t_uint32) -(t_int32) (zigzag & 1);
+        counts[(size_t) index * stride] = (t_int32) previous;
+    }
+
+    return input;
+}
+
+size_t
+stream_codec_max_size(t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    return num_analog_channels * (((size_t) num_samples * MAX_VOLTAGE_BITS + 7) / 8)
+        + (size_t) num_encoder_channels * num_samples * MAX_COUNT_BYTES;
+}
+
+size_t
+stream_codec_encode(t_ubyte * payload, const t_double * voltages, t_uint32 num_analog_channels,
+                    const t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    struct bit_writer writer;
+    t_uint32 channel;
+
+    writer.output   = payload;
+    writer.bits     = 0;
+    writer.num_bits = 0;
+
+    for (channel = 0; channel < num_analog_channels; channel++)
+        encode_voltages(&writer, voltages + channel, num_analog_channels, num_samples);
+
+    for (channel = 0; channel < num_encoder_channels; channel++)
+        writer.output = encode_counts(writer.output, counts + channel, num_encoder_channels, num_samples);
+
+    return (size_t) (writer.output - payload);
+}
+
+t_int
+stream_codec_decode(const t_ubyte * payload, size_t payload_size, t_double * voltages, t_uint32 num_analog_channels,
+                    t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    struct bit_reader reader;
+    t_uint32 channel;
+
+    reader.input    = payload;
+    reader.end      = payload + payload_size;
+    reader.bits     = 0;
+    reader.num_bits = 0;
+
+    for (channel = 0; channel < num_analog_channels; channel++)
+    {
+        if (decode_voltages(&reader, voltages + channel, num_analog_channels, num_samples) != 0)
+            return -1;
+    }
+
+    for (channel = 0; channel < num_encoder_channels; channel++)
+    {
+        reader.input = decode_counts(reader.input, reader.end, counts + channel, num_encoder_channels, num_samples);
+        if (reader.input == NULL)
+            return -1;
+    }
+
+    return (reader.input == reader.end) ? 0 : -1;
+}
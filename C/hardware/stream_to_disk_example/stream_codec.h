@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_codec.h - header file
+//
+// Lossless compression of the sample data of a stream log chunk
+// (STREAM_LOG_ENCODING_COMPRESSED in stream_log.h).
+//
+// Each channel is compressed as a separate column, first the analog
+// channels and then the encoder channels:
+//
+//  - Analog columns use the XOR encoding of the Gorilla time series
+//    database. The first voltage is stored in full. Each following
+//    voltage is XORed with the previous one, which leaves few bits set
+//    when successive voltages are equal or close, and only the bits
+//    between the leading and trailing zeros of the result are stored.
+//    Each analog column is a bit stream padded to a whole byte.
+//
+//  - Encoder columns store the difference between successive counts,
+//    starting from zero, zig-zag encoded so small negative differences
+//    become small positive numbers, as variable-length integers of
+//    seven bits per byte. An encoder turning by a few counts per sample
+//    takes one byte per sample instead of four.
+//
+// Every chunk is compressed independently so any chunk may be decoded
+// on its own. Both directions make a single pass over the samples with
+// no allocation, so compression easily keeps up with 16 channels at
+// 10 kHz on one core.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _stream_codec_h
+#define _stream_codec_h
+
+#include <stddef.h>
+
+#include "quanser_types.h"
+
+/*
+    Largest size of the compressed sample data of a chunk holding the given number of samples.
+*/
+extern size_t
+stream_codec_max_size(t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 num_samples);
+
+/*
+    Compress the voltages and counts, laid out the way hil_task_read returns them, into the
+    payload, which must hold stream_codec_max_size bytes. Returns the compressed size in bytes.
+*/
+extern size_t
+stream_codec_encode(t_ubyte * payload, const t_double * voltages, t_uint32 num_analog_channels,
+                    const t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples);
+
+/*
+    Decompress payload_size bytes of compressed sample data into voltages and counts, laid out
+    the way hil_task_read returns them. Returns 0 on success and -1 if the data is corrupt.
+*/
+extern t_int
+stream_codec_decode(const t_ubyte * payload, size_t payload_size, t_double * voltages, t_uint32 num_analog_channels,
+                    t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples);
+
+#endif
@@ -0,0 +1,368 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_log.c - C file
+//
+// Reads and writes the binary stream log format described in
+// stream_log.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stream_log.h"
+#include "stream_codec.h"
+#include "quanser_file.h"
+
+/* Stream logs may be larger than 2 GB, which is beyond the reach of fseek on some platforms */
+#if defined(_WIN32)
+#define stream_log_seek(file, offset, origin)   _fseeki64((file), (__int64) (offset), (origin))
+#define stream_log_tell(file)                   ((t_int64) _ftelli64(file))
+#else
+#define stream_log_seek(file, offset, origin)   fseeko((file), (off_t) (offset), (origin))
+#define stream_log_tell(file)                   ((t_int64) ftello(file))
+#endif
+
+/*
+    Size of the raw sample data of a chunk holding the given number of samples.
+*/
+static size_t
+stream_log_raw_payload_size(t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    return (size_t) num_samples * (num_analog_channels * sizeof(t_double) + num_encoder_channels * sizeof(t_int32));
+}
+
+/*
+    Transpose the rows of samples returned by hil_task_read into columns, one per channel.
+*/
+static void
+stream_log_pack_columns(t_ubyte * payload, const t_double * voltages, t_uint32 num_analog_channels,
+                        const t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    t_double * analog_columns  = (t_double *) payload;
+    t_int32 *  encoder_columns = (t_int32 *) (analog_columns + (size_t) num_samples * num_analog_channels);
+    t_uint32   channel;
+    t_uint32   index;
+
+    for (channel = 0; channel < num_analog_channels; channel++)
+    {
+        t_double * column = analog_columns + (size_t) channel * num_samples;
+        for (index = 0; index < num_samples; index++)
+            column[index] = voltages[(size_t) index * num_analog_channels + channel];
+    }
+
+    for (channel = 0; channel < num_encoder_channels; channel++)
+    {
+        t_int32 * column = encoder_columns + (size_t) channel * num_samples;
+        for (index = 0; index < num_samples; index++)
+            column[index] = counts[(size_t) index * num_encoder_channels + channel];
+    }
+}
+
+/*
+    Transpose the columns of a chunk back into rows of samples, as returned by hil_task_read.
+*/
+static void
+stream_log_unpack_columns(const t_ubyte * payload, t_double * voltages, t_uint32 num_analog_channels,
+                          t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    const t_double * analog_columns  = (const t_double *) payload;
+    const t_int32 *  encoder_columns = (const t_int32 *) (analog_columns + (size_t) num_samples * num_analog_channels);
+    t_uint32         channel;
+    t_uint32         index;
+
+    for (channel = 0; channel < num_analog_channels; channel++)
+    {
+        const t_double * column = analog_columns + (size_t) channel * num_samples;
+        for (index = 0; index < num_samples; index++)
+            voltages[(size_t) index * num_analog_channels + channel] = column[index];
+    }
+
+    for (channel = 0; channel < num_encoder_channels; channel++)
+    {
+        const t_int32 * column = encoder_columns + (size_t) channel * num_samples;
+        for (index = 0; index < num_samples; index++)
+            counts[(size_t) index * num_encoder_channels + channel] = column[index];
+    }
+}
+
+/*
+    Size of the buffer needed to read the sample data of any chunk of a stream log with the given header.
+*/
+static size_t
+stream_log_reader_payload_size(const struct stream_log_header * header)
+{
+    const size_t raw_size        = stream_log_raw_payload_size(header->num_analog_channels, header->num_encoder_channels,
+                                                               header->max_chunk_samples);
+    const size_t compressed_size = stream_codec_max_size(header->num_analog_channels, header->num_encoder_channels,
+                                                         header->max_chunk_samples);
+
+    return (compressed_size > raw_size) ? compressed_size : raw_size;
+}
+
+size_t
+stream_log_chunk_size(t_uint32 encoding, t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    if (encoding == STREAM_LOG_ENCODING_COMPRESSED)
+        return sizeof(struct stream_log_chunk) + stream_codec_max_size(num_analog_channels, num_encoder_channels, num_samples);
+
+    return sizeof(struct stream_log_chunk) + stream_log_raw_payload_size(num_analog_channels, num_encoder_channels, num_samples);
+}
+
+void
+stream_log_init_header(struct stream_log_header * header, t_double frequency, t_clock clock,
+                       t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 max_chunk_samples)
+{
+    memcpy(header->magic, STREAM_LOG_MAGIC, sizeof(header->magic));
+    header->version              = STREAM_LOG_VERSION;
+    header->header_size          = (t_uint32) (sizeof(*header) + (num_analog_channels + num_encoder_channels) * sizeof(t_uint32));
+    header->frequency            = frequency;
+    header->start_time           = (t_int64) time(NULL);
+    header->clock                = (t_int32) clock;
+    header->max_chunk_samples    = max_chunk_samples;
+    header->num_analog_channels  = num_analog_channels;
+    header->num_encoder_channels = num_encoder_channels;
+}
+
+size_t
+stream_log_pack_chunk(t_ubyte * buffer, t_uint32 encoding, t_uint64 first_sample,
+                      const t_double * voltages, t_uint32 num_analog_channels,
+                      const t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples)
+{
+    struct stream_log_chunk chunk;
+
+    chunk.magic        = STREAM_LOG_CHUNK_MAGIC;
+    chunk.num_samples  = num_samples;
+    chunk.encoding     = encoding;
+    chunk.first_sample = first_sample;
+
+    if (encoding == STREAM_LOG_ENCODING_COMPRESSED)
+        chunk.payload_size = (t_uint32) stream_codec_encode(buffer + sizeof(chunk), voltages, num_analog_channels,
+                                                            counts, num_encoder_channels, num_samples);
+    else
+    {
+        chunk.payload_size = (t_uint32) stream_log_raw_payload_size(num_analog_channels, num_encoder_channels, num_samples);
+        stream_log_pack_columns(buffer + sizeof(chunk), voltages, num_analog_channels, counts, num_encoder_channels, num_samples);
+    }
+
+    memcpy(buffer, &chunk, sizeof(chunk));
+
+    return sizeof(chunk) + chunk.payload_size;
+}
+
+t_int
+stream_log_writer_open(struct stream_log_writer * writer, const char * filename, t_double frequency, t_clock clock,
+                       const t_uint32 analog_channels[], t_uint32 num_analog_channels,
+                       const t_uint32 encoder_channels[], t_uint32 num_encoder_channels,
+                       t_uint32 max_chunk_samples, t_uint32 encoding)
+{
+    struct stream_log_header header;
+
+    memset(writer, 0, sizeof(*writer));
+    writer->num_analog_channels  = num_analog_channels;
+    writer->num_encoder_channels = num_encoder_channels;
+    writer->max_chunk_samples    = max_chunk_samples;
+    writer->encoding             = encoding;
+
+    writer->buffer = (t_ubyte *) malloc(stream_log_chunk_size(encoding, num_analog_channels, num_encoder_channels, max_chunk_samples));
+    if (writer->buffer == NULL)
+        return -1;
+
+    if (stdfile_open(filename, "wb", &writer->file) != 0)
+    {
+        free(writer->buffer);
+        writer->buffer = NULL;
+        return -1;
+    }
+
+    stream_log_init_header(&header, frequency, clock, num_analog_channels, num_encoder_channels, max_chunk_samples);
+
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1
+        || fwrite(analog_channels, sizeof(t_uint32), num_analog_channels, writer->file) != num_analog_channels
+        || fwrite(encoder_channels, sizeof(t_uint32), num_encoder_channels, writer->file) != num_encoder_channels)
+    {
+        stream_log_writer_close(writer);
+        return -1;
+    }
+
+    return 0;
+}
+
+t_int
+stream_log_writer_write(struct stream_log_writer * writer, t_uint64 first_sample,
+                        const t_double * voltages, const t_int32 * counts, t_uint32 num_samples)
+{
+    size_t size;
+
+    if (num_samples > writer->max_chunk_samples)
+        return -1;
+
+    size = stream_log_pack_chunk(writer->buffer, writer->encoding, first_sample, voltages, writer->num_analog_channels,
+                                 counts, writer->num_encoder_channels, num_samples);
+
+    return (fwrite(writer->buffer, 1, size, writer->file) == size) ? 0 : -1;
+}
+
+t_int
+stream_log_writer_close(struct stream_log_writer * writer)
+{
+    t_int result = 0;
+
+    if (writer->file != NULL)
+    {
+        if (stdfile_close(writer->file) != 0)
+            result = -1;
+        writer->file = NULL;
+    }
+
+    free(writer->buffer);
+    writer->buffer = NULL;
+    return result;
+}
+
+t_int
+stream_log_reader_open(struct stream_log_reader * reader, const char * filename)
+{
+    struct stream_log_header * header = &reader->header;
+
+    memset(reader, 0, sizeof(*reader));
+    if (stdfile_open(filename, "rb", &reader->file) != 0)
+        return -1;
+
+    if (fread(header, sizeof(*header), 1, reader->file) == 1
+        && memcmp(header->magic, STREAM_LOG_MAGIC, sizeof(header->magic)) == 0
+        && header->version == STREAM_LOG_VERSION
+        && header->header_size == sizeof(*header) + (header->num_analog_channels + header->num_encoder_channels) * sizeof(t_uint32))
+    {
+        reader->analog_channels  = (t_uint32 *) malloc((header->num_analog_channels + header->num_encoder_channels) * sizeof(t_uint32) + 1);
+        reader->payload          = (t_ubyte *) malloc(stream_log_reader_payload_size(header) + 1);
+        if (reader->analog_channels != NULL && reader->payload != NULL)
+        {
+            reader->encoder_channels = reader->analog_channels + header->num_analog_channels;
+            if (fread(reader->analog_channels, sizeof(t_uint32), header->num_analog_channels + header->num_encoder_channels, reader->file)
+                == header->num_analog_channels + header->num_encoder_channels)
+                return 0;
+        }
+    }
+
+    stream_log_reader_close(reader);
+    return -1;
+}
+
+t_int
+stream_log_reader_read(struct stream_log_reader * reader, struct stream_log_chunk * chunk, t_double * voltages, t_int32 * counts)
+{
+    const struct stream_log_header * header = &reader->header;
+
+    if (fread(chunk, sizeof(*chunk), 1, reader->file) != 1)
+        return feof(reader->file) ? 0 : -1;
+
+    if (chunk->magic == STREAM_LOG_INDEX_MAGIC)
+        return 0;
+
+    if (chunk->magic != STREAM_LOG_CHUNK_MAGIC || chunk->num_samples > header->max_chunk_samples)
+        return -1;
+
+    if (chunk->encoding == STREAM_LOG_ENCODING_COMPRESSED)
+    {
+        if (chunk->payload_size > stream_codec_max_size(header->num_analog_channels, header->num_encoder_channels, chunk->num_samples)
+            || fread(reader->payload, 1, chunk->payload_size, reader->file) != chunk->payload_size
+            || stream_codec_decode(reader->payload, chunk->payload_size, voltages, header->num_analog_channels,
+                                   counts, header->num_encoder_channels, chunk->num_samples) != 0)
+            return -1;
+    }
+    else if (chunk->encoding == STREAM_LOG_ENCODING_RAW)
+    {
+        if (chunk->payload_size != stream_log_raw_payload_size(header->num_analog_channels, header->num_encoder_channels, chunk->num_samples)
+            || fread(reader->payload, 1, chunk->payload_size, reader->file) != chunk->payload_size)
+            return -1;
+
+        stream_log_unpack_columns(reader->payload, voltages, header->num_analog_channels, counts, header->num_encoder_channels, chunk->num_samples);
+    }
+    else
+        return -1;
+
+    return (t_int) chunk->num_samples;
+}
+
+t_int
+stream_log_reader_load_index(struct stream_log_reader * reader)
+{
+    struct stream_log_index_trailer * trailer = &reader->trailer;
+    struct stream_log_chunk           index_chunk;
+    t_int64                           position = stream_log_tell(reader->file);
+    t_int                             result   = -1;
+
+    if (reader->index != NULL)
+        return 0;
+
+    if (stream_log_seek(reader->file, -(t_int64) sizeof(*trailer), SEEK_END) == 0
+        && fread(trailer, sizeof(*trailer), 1, reader->file) == 1
+        && trailer->magic == STREAM_LOG_INDEX_MAGIC
+        && stream_log_seek(reader->file, trailer->index_offset, SEEK_SET) == 0
+        && fread(&index_chunk, sizeof(index_chunk), 1, reader->file) == 1
+        && index_chunk.magic == STREAM_LOG_INDEX_MAGIC
+        && index_chunk.payload_size == trailer->num_entries * sizeof(struct stream_log_index_entry) + sizeof(*trailer))
+    {
+        reader->index = (struct stream_log_index_entry *) malloc(trailer->num_entries * sizeof(struct stream_log_index_entry) + 1);
+        if (reader->index != NULL)
+        {
+            if (fread(reader->index, sizeof(struct stream_log_index_entry), trailer->num_entries, reader->file) == trailer->num_entries)
+                result = 0;
+            else
+            {
+                free(reader->index);
+                reader->index = NULL;
+            }
+        }
+    }
+
+    stream_log_seek(reader->file, position, SEEK_SET);
+    return result;
+}
+
+t_int
+stream_log_reader_seek(struct stream_log_reader * reader, t_uint64 sample)
+{
+    const struct stream_log_index_entry * index = reader->index;
+    t_uint32 low;
+    t_uint32 high;
+
+    if (index == NULL || reader->trailer.num_entries == 0)
+        return (stream_log_seek(reader->file, reader->header.header_size, SEEK_SET) == 0) ? 0 : -1;
+
+    /* Binary search for the last chunk starting at or before the sample */
+    low  = 0;
+    high = reader->trailer.num_entries;
+    while (high - low > 1)
+    {
+        const t_uint32 middle = low + (high - low) / 2;
+        if (index[middle].first_sample <= sample)
+            low = middle;
+        else
+            high = middle;
+    }
+
+    return (stream_log_seek(reader->file, index[low].offset, SEEK_SET) == 0) ? 0 : -1;
+}
+
+void
+stream_log_reader_close(struct stream_log_reader * reader)
+{
+    if (reader->file != NULL)
+    {
+        stdfile_close(reader->file);
+        reader->file = NULL;
+    }
+
+    free(reader->analog_channels);
+    free(reader->payload);
+    free(reader->index);
+
+    reader->analog_channels  = NULL;
+    reader->encoder_channels = NULL;
+    reader->payload          = NULL;
+    reader->index            = NULL;
+}
@@ -0,0 +1,199 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_log.h - header file
+//
+// Binary stream log format used to record the sample blocks returned
+// by hil_task_read without formatting each sample as text.
+//
+// A stream log consists of a header followed by a sequence of chunks.
+// The header describes the recording: the sampling frequency, the clock,
+// the start time and the analog and encoder channel lists. Each chunk
+// holds the samples returned by one hil_task_read call stored column by
+// column, first the voltages of each analog channel and then the counts
+// of each encoder channel. Values are stored in the byte order of the
+// machine that made the recording. The chunks may instead be compressed
+// without loss (see stream_codec.h), in which case each chunk records
+// the encoding used for it.
+//
+// A stream log may end with an index of its chunks (see stream_segment.h).
+// The index starts with a chunk header whose magic is
+// STREAM_LOG_INDEX_MAGIC, followed by one stream_log_index_entry per
+// chunk and a stream_log_index_trailer, which is always the last thing
+// in the file. The trailer locates the index, so the chunk holding any
+// given sample can be found without reading the rest of the file.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _stream_log_h
+#define _stream_log_h
+
+#include <stdio.h>
+
+#include "hil.h"
+
+#define STREAM_LOG_MAGIC            "QSTRMLOG"      /* first eight bytes of every stream log */
+#define STREAM_LOG_VERSION          (1)             /* version of the stream log format */
+#define STREAM_LOG_CHUNK_MAGIC      (0x4B4E4843)    /* "CHNK" marks the start of every chunk */
+#define STREAM_LOG_INDEX_MAGIC      (0x58444E49)    /* "INDX" marks the start and the end of the index */
+
+#define STREAM_LOG_ENCODING_RAW         (0)         /* columns of t_double voltages followed by columns of t_int32 counts */
+#define STREAM_LOG_ENCODING_COMPRESSED  (1)         /* compressed columns (see stream_codec.h) */
+
+/*
+    The header at the start of the file. It is followed immediately by the analog
+    channel numbers and then the encoder channel numbers, each stored as a t_uint32.
+    The fields are ordered so that the structure contains no padding.
+*/
+struct stream_log_header
+{
+    char     magic[8];              /* STREAM_LOG_MAGIC (not null-terminated) */
+    t_uint32 version;               /* STREAM_LOG_VERSION */
+    t_uint32 header_size;           /* size of the header including the channel lists, in bytes */
+    t_double frequency;             /* sampling frequency in Hz */
+    t_int64  start_time;            /* start of the recording in seconds since 1970-01-01 UTC */
+    t_int32  clock;                 /* clock used to pace the task (a t_clock value) */
+    t_uint32 max_chunk_samples;     /* maximum number of samples in one chunk */
+    t_uint32 num_analog_channels;   /* number of analog channels */
+    t_uint32 num_encoder_channels;  /* number of encoder channels */
+};
+
+/*
+    The header at the start of every chunk. It is followed by payload_size bytes of sample data.
+*/
+struct stream_log_chunk
+{
+    t_uint32 magic;                 /* STREAM_LOG_CHUNK_MAGIC */
+    t_uint32 num_samples;           /* number of samples in the chunk */
+    t_uint32 encoding;              /* STREAM_LOG_ENCODING_xxx */
+    t_uint32 payload_size;          /* size of the sample data following the chunk header, in bytes */
+    t_uint64 first_sample;          /* index of the first sample in the chunk since the start of the recording */
+};
+
+/*
+    One entry of the index, locating one chunk.
+*/
+struct stream_log_index_entry
+{
+    t_uint64 first_sample;          /* index of the first sample in the chunk since the start of the recording */
+    t_uint64 offset;                /* offset of the chunk header from the start of the file */
+};
+
+/*
+    The last bytes of a stream log that has an index.
+*/
+struct stream_log_index_trailer
+{
+    t_uint64 index_offset;          /* offset of the chunk header that starts the index */
+    t_uint64 end_sample;            /* index of the sample following the last sample in the file */
+    t_uint32 num_entries;           /* number of index entries */
+    t_uint32 magic;                 /* STREAM_LOG_INDEX_MAGIC */
+};
+
+struct stream_log_writer
+{
+    FILE *    file;                 /* file to which the log is written */
+    t_uint32  num_analog_channels;  /* number of analog channels in each sample */
+    t_uint32  num_encoder_channels; /* number of encoder channels in each sample */
+    t_uint32  max_chunk_samples;    /* maximum number of samples in one chunk */
+    t_uint32  encoding;             /* STREAM_LOG_ENCODING_xxx used for every chunk */
+    t_ubyte * buffer;               /* buffer in which a chunk is assembled */
+};
+
+struct stream_log_reader
+{
+    FILE *                          file;               /* file from which the log is read */
+    struct stream_log_header        header;             /* header of the log */
+    t_uint32 *                      analog_channels;    /* analog channel numbers */
+    t_uint32 *                      encoder_channels;   /* encoder channel numbers */
+    t_ubyte *                       payload;            /* buffer into which the sample data of a chunk is read */
+    struct stream_log_index_entry * index;              /* index of the chunks, if the log has one and it has been loaded */
+    struct stream_log_index_trailer trailer;            /* trailer of the index, if the index has been loaded */
+};
+
+/*
+    Largest size of a chunk in the given encoding, including its chunk header, holding the given number of samples.
+*/
+extern size_t
+stream_log_chunk_size(t_uint32 encoding, t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 num_samples);
+
+/*
+    Fill in the header of a new stream log. The start time is set to the current time.
+*/
+extern void
+stream_log_init_header(struct stream_log_header * header, t_double frequency, t_clock clock,
+                       t_uint32 num_analog_channels, t_uint32 num_encoder_channels, t_uint32 max_chunk_samples);
+
+/*
+    Assemble a chunk in the given encoding, including its chunk header, in the given buffer, which
+    must hold stream_log_chunk_size bytes. The voltages and counts are laid out the way hil_task_read
+    returns them. Returns the size of the chunk in bytes.
+*/
+extern size_t
+stream_log_pack_chunk(t_ubyte * buffer, t_uint32 encoding, t_uint64 first_sample,
+                      const t_double * voltages, t_uint32 num_analog_channels,
+                      const t_int32 * counts, t_uint32 num_encoder_channels, t_uint32 num_samples);
+
+/*
+    Create a stream log and write its header. Chunks may hold at most max_chunk_samples samples
+    and are written in the given encoding. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_log_writer_open(struct stream_log_writer * writer, const char * filename, t_double frequency, t_clock clock,
+                       const t_uint32 analog_channels[], t_uint32 num_analog_channels,
+                       const t_uint32 encoder_channels[], t_uint32 num_encoder_channels,
+                       t_uint32 max_chunk_samples, t_uint32 encoding);
+
+/*
+    Write one chunk of samples, the first of which is the given sample since the start of the
+    recording. The voltages and counts are laid out the way hil_task_read returns them, i.e. one
+    row of channels per sample. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_log_writer_write(struct stream_log_writer * writer, t_uint64 first_sample,
+                        const t_double * voltages, const t_int32 * counts, t_uint32 num_samples);
+
+/*
+    Close the stream log and release its resources. Returns 0 on success and -1 if the data still
+    buffered could not be written or the file could not be closed.
+*/
+extern t_int
+stream_log_writer_close(struct stream_log_writer * writer);
+
+/*
+    Open a stream log and read its header and channel lists.
+    Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_log_reader_open(struct stream_log_reader * reader, const char * filename);
+
+/*
+    Read the next chunk into voltages and counts, using the same layout as hil_task_read.
+    The buffers must hold header.max_chunk_samples samples. Returns the number of samples
+    read, 0 at the end of the log (or the start of its index) and -1 if the log is corrupt.
+*/
+extern t_int
+stream_log_reader_read(struct stream_log_reader * reader, struct stream_log_chunk * chunk, t_double * voltages, t_int32 * counts);
+
+/*
+    Load the index at the end of the stream log. Returns 0 on success and -1 if the log
+    has no index. The read position is left unchanged.
+*/
+extern t_int
+stream_log_reader_load_index(struct stream_log_reader * reader);
+
+/*
+    Position the reader at the chunk holding the given sample, so the next call to
+    stream_log_reader_read returns that chunk. Without an index the reader is positioned
+    at the first chunk. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_log_reader_seek(struct stream_log_reader * reader, t_uint64 sample);
+
+/*
+    Close the stream log and release its resources.
+*/
+extern void
+stream_log_reader_close(struct stream_log_reader * reader);
+
+#endif
@@ -0,0 +1,345 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_segment.c - C file
+//
+// Implements the memory-mapped segment writer described in
+// stream_segment.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#if !defined(_WIN32)
+#define _FILE_OFFSET_BITS 64
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "stream_segment.h"
+#include "quanser_string.h"
+
+#define INDEX_ENTRY_SIZE    sizeof(struct stream_log_index_entry)
+
+/*
+    Space needed after the chunks for the index of a segment with the given number of entries.
+*/
+static size_t
+index_size(t_uint32 num_entries)
+{
+    return sizeof(struct stream_log_chunk) + num_entries * INDEX_ENTRY_SIZE + sizeof(struct stream_log_index_trailer);
+}
+
+/*
+    Platform-specific functions to create, map, unmap and truncate a segment file.
+*/
+#if defined(_WIN32)
+
+static t_int
+map_segment(struct stream_segment_writer * writer, const char * filename)
+{
+    LARGE_INTEGER size;
+
+    writer->file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (writer->file == INVALID_HANDLE_VALUE)
+        return -1;
+
+    /* Allocate the whole segment now so writing never has to extend the file */
+    size.QuadPart = (LONGLONG) writer->segment_size;
+    if (SetFilePointerEx(writer->file, size, NULL, FILE_BEGIN) && SetEndOfFile(writer->file))
+    {
+        writer->mapping = CreateFileMappingA(writer->file, NULL, PAGE_READWRITE, 0, 0, NULL);
+        if (writer->mapping != NULL)
+        {
+            writer->base = (t_ubyte *) MapViewOfFile(writer->mapping, FILE_MAP_WRITE, 0, 0, writer->segment_size);
+            if (writer->base != NULL)
+                return 0;
+
+            CloseHandle(writer->mapping);
+        }
+    }
+
+    CloseHandle(writer->file);
+    DeleteFileA(filename);
+    return -1;
+}
+
+static t_int
+unmap_segment(struct stream_segment_writer * writer, size_t length)
+{
+    LARGE_INTEGER size;
+    t_int result = 0;
+
+    if (!FlushViewOfFile(writer->base, length) || !UnmapViewOfFile(writer->base))
+        result = -1;
+    CloseHandle(writer->mapping);
+
+    size.QuadPart = (LONGLONG) length;
+    if (!SetFilePointerEx(writer->file, size, NULL, FILE_BEGIN) || !SetEndOfFile(writer->file))
+        result = -1;
+    CloseHandle(writer->file);
+
+    writer->base = NULL;
+    return result;
+}
+
+#else
+
+static t_int
+map_segment(struct stream_segment_writer * writer, const char * filename)
+{
+    int flags = MAP_SHARED;
+
+#if defined(MAP_POPULATE)
+    /* Fault in the pages of the mapping now rather than while writing the chunks */
+    flags |= MAP_POPULATE;
+#endif
+
+    writer->file = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (writer->file < 0)
+        return -1;
+
+    /* Allocate the whole segment now so writing never has to extend the file */
+#if defined(__APPLE__)
+    if (ftruncate(writer->file, (off_t) writer->segment_size) == 0)
+#else
+    if (posix_fallocate(writer->file, 0, (off_t) writer->segment_size) == 0)
+#endif
+    {
+        void * base = mmap(NULL, writer->segment_size, PROT_READ | PROT_WRITE, flags, writer->file, 0);
+        if (base != MAP_FAILED)
+        {
+            writer->base = (t_ubyte *) base;
+            return 0;
+        }
+    }
+
+    close(writer->file);
+    unlink(filename);
+    return -1;
+}
+
+static t_int
+unmap_segment(struct stream_segment_writer * writer, size_t length)
+{
+    t_int result = 0;
+
+    /* Write the chunks and index to the file now, so that a failure to write them is reported */
+    if (msync(writer->base, length, MS_SYNC) != 0)
+        result = -1;
+    if (munmap(writer->base, writer->segment_size) != 0)
+        result = -1;
+    if (ftruncate(writer->file, (off_t) length) != 0)
+        result = -1;
+    if (close(writer->file) != 0)
+        result = -1;
+
+    writer->base = NULL;
+    return result;
+}
+
+#endif
+
+/*
+    Create the next segment file and write the stream log header at its start.
+*/
+static t_int
+begin_segment(struct stream_segment_writer * writer, t_uint64 first_sample)
+{
+    const t_uint32 num_channels = writer->header.num_analog_channels + writer->header.num_encoder_channels;
+    char filename[_MAX_PATH + STREAM_SEGMENT_MAX_SUFFIX];
+
+    if (stream_segment_filename(filename, sizeof(filename), writer->base_name, writer->segment_number) != 0
+        || map_segment(writer, filename) != 0)
+        return -1;
+
+    memcpy(writer->base, &writer->header, sizeof(writer->header));
+    memcpy(writer->base + sizeof(writer->header), writer->channels, num_channels * sizeof(t_uint32));
+
+    writer->used         = writer->header.header_size;
+    writer->num_entries  = 0;
+    writer->first_sample = first_sample;
+    writer->end_sample   = first_sample;
+    return 0;
+}
+
+/*
+    Write the index behind the last chunk and close the current segment.
+*/
+static t_int
+end_segment(struct stream_segment_writer * writer)
+{
+    const t_uint32 num_entries = writer->num_entries;
+
+    struct stream_log_chunk         index_chunk;
+    struct stream_log_index_trailer trailer;
+    t_ubyte * entries = writer->base + writer->segment_size - num_entries * INDEX_ENTRY_SIZE;
+    t_uint32  low;
+    t_uint32  high;
+
+    index_chunk.magic        = STREAM_LOG_INDEX_MAGIC;
+    index_chunk.num_samples  = 0;
+    index_chunk.encoding     = STREAM_LOG_ENCODING_RAW;
+    index_chunk.payload_size = (t_uint32) (index_size(num_entries) - sizeof(index_chunk));
+    index_chunk.first_sample = writer->first_sample;
+
+    /* The entries were stored backwards from the end of the mapping. Reverse them and move them behind the index chunk header.
+       The chunks are not aligned, so the entries are copied with memcpy rather than accessed directly. */
+    for (low = 0, high = num_entries; high > low + 1; low++, high--)
+    {
+        struct stream_log_index_entry entry;
+        memcpy(&entry, entries + low * INDEX_ENTRY_SIZE, INDEX_ENTRY_SIZE);
+        memcpy(entries + low * INDEX_ENTRY_SIZE, entries + (high - 1) * INDEX_ENTRY_SIZE, INDEX_ENTRY_SIZE);
+        memcpy(entries + (high - 1) * INDEX_ENTRY_SIZE, &entry, INDEX_ENTRY_SIZE);
+    }
+
+    memmove(writer->base + writer->used + sizeof(index_chunk), entries, num_entries * INDEX_ENTRY_SIZE);
+
+    trailer.index_offset = writer->used;
+    trailer.end_sample   = writer->end_sample;
+    trailer.num_entries  = num_entries;
+    trailer.magic        = STREAM_LOG_INDEX_MAGIC;
+
+    memcpy(writer->base + writer->used, &index_chunk, sizeof(index_chunk));
+    memcpy(writer->base + writer->used + sizeof(index_chunk) + num_entries * INDEX_ENTRY_SIZE, &trailer, sizeof(trailer));
+
+    writer->segment_number++;
+    return unmap_segment(writer, writer->used + index_size(num_entries));
+}
+
+t_int
+stream_segment_filename(char * filename, size_t length, const char * base_name, t_uint32 segment_number)
+{
+    const int result = snprintf(filename, length, "%s_%0*u" STREAM_SEGMENT_EXTENSION, base_name, STREAM_SEGMENT_MIN_DIGITS, segment_number);
+    return (result >= 0 && (size_t) result < length) ? 0 : -1;
+}
+
+t_int
+stream_segment_parse_filename(const char * filename, char * base_name, size_t length, t_uint32 * segment_number)
+{
+    const size_t filename_length  = string_length(filename, _MAX_PATH);
+    const size_t extension_length = sizeof(STREAM_SEGMENT_EXTENSION) - 1;
+    size_t end, start, index;
+    t_uint32 number = 0;
+
+    if (filename_length <= extension_length || strcmp(filename + filename_length - extension_length, STREAM_SEGMENT_EXTENSION) != 0)
+        return -1;
+
+    /* The segment number is the run of digits before the extension, which follows an underscore */
+    end = filename_length - extension_length;
+    for (start = end; start > 0 && filename[start - 1] >= '0' && filename[start - 1] <= '9'; start--)
+        ;
+
+    if (end - start < STREAM_SEGMENT_MIN_DIGITS || end - start > STREAM_SEGMENT_MAX_DIGITS
+        || start < 2 || filename[start - 1] != '_' || start - 1 >= length)
+        return -1;
+
+    for (index = start; index < end; index++)
+    {
+        const t_uint32 digit = (t_uint32) (filename[index] - '0');
+        if (number > (0xFFFFFFFFu - digit) / 10)
+            return -1;
+        number = number * 10 + digit;
+    }
+
+    memcpy(base_name, filename, start - 1);
+    base_name[start - 1] = '\0';
+    *segment_number = number;
+    return 0;
+}
+
+t_int
+stream_segment_writer_open(struct stream_segment_writer * writer, const char * base_name, t_double frequency, t_clock clock,
+                           const t_uint32 analog_channels[], t_uint32 num_analog_channels,
+                           const t_uint32 encoder_channels[], t_uint32 num_encoder_channels,
+                           t_uint32 max_chunk_samples, t_uint32 encoding, size_t segment_size, t_double segment_duration)
+{
+    memset(writer, 0, sizeof(*writer));
+
+    stream_log_init_header(&writer->header, frequency, clock, num_analog_channels, num_encoder_channels, max_chunk_samples);
+
+    /* Every segment must be able to hold at least one full chunk and its index */
+    if (segment_size < writer->header.header_size + stream_log_chunk_size(encoding, num_analog_channels, num_encoder_channels, max_chunk_samples)
+                       + index_size(1))
+        return -1;
+
+    writer->channels = (t_uint32 *) malloc((num_analog_channels + num_encoder_channels) * sizeof(t_uint32) + 1);
+    writer->buffer   = (t_ubyte *) malloc(stream_log_chunk_size(encoding, num_analog_channels, num_encoder_channels, max_chunk_samples));
+    if (writer->channels == NULL || writer->buffer == NULL)
+    {
+        free(writer->channels);
+        free(writer->buffer);
+        writer->channels = NULL;
+        writer->buffer   = NULL;
+        return -1;
+    }
+
+    memcpy(writer->channels, analog_channels, num_analog_channels * sizeof(t_uint32));
+    memcpy(writer->channels + num_analog_channels, encoder_channels, num_encoder_channels * sizeof(t_uint32));
+
+    string_copy(writer->base_name, sizeof(writer->base_name), base_name);
+    writer->encoding        = encoding;
+    writer->segment_size    = segment_size;
+    writer->segment_samples = (segment_duration > 0) ? (t_uint64) (segment_duration * frequency + 0.5) : 0;
+    return 0;
+}
+
+t_int
+stream_segment_writer_write(struct stream_segment_writer * writer, t_uint64 first_sample,
+                            const t_double * voltages, const t_int32 * counts, t_uint32 num_samples)
+{
+    const size_t max_size = stream_log_chunk_size(writer->encoding, writer->header.num_analog_channels,
+                                                  writer->header.num_encoder_channels, num_samples);
+    struct stream_log_index_entry entry;
+    size_t size;
+
+    if (num_samples > writer->header.max_chunk_samples)
+        return -1;
+
+    if (writer->base != NULL)
+    {
+        const t_boolean is_full = (writer->used + max_size + index_size(writer->num_entries + 1) > writer->segment_size);
+        const t_boolean is_long = (writer->segment_samples != 0 && first_sample - writer->first_sample >= writer->segment_samples);
+
+        if ((is_full || is_long) && end_segment(writer) != 0)
+            return -1;
+    }
+
+    if (writer->base == NULL && begin_segment(writer, first_sample) != 0)
+        return -1;
+
+    /*
+        The chunks follow one another without padding, so a chunk in the mapping is generally not
+        aligned for the doubles of its columns. The chunk is packed into the aligned buffer instead
+        and copied into the mapping as bytes.
+    */
+    size = stream_log_pack_chunk(writer->buffer, writer->encoding, first_sample, voltages, writer->header.num_analog_channels,
+                                 counts, writer->header.num_encoder_channels, num_samples);
+    memcpy(writer->base + writer->used, writer->buffer, size);
+
+    entry.first_sample = first_sample;
+    entry.offset       = writer->used;
+    writer->num_entries++;
+    memcpy(writer->base + writer->segment_size - writer->num_entries * INDEX_ENTRY_SIZE, &entry, sizeof(entry));
+
+    writer->used      += size;
+    writer->end_sample = first_sample + num_samples;
+    return 0;
+}
+
+t_int
+stream_segment_writer_close(struct stream_segment_writer * writer)
+{
+    t_int result = 0;
+
+    if (writer->base != NULL)
+        result = end_segment(writer);
+
+    free(writer->channels);
+    free(writer->buffer);
+    writer->channels = NULL;
+    writer->buffer   = NULL;
+    return result;
+}
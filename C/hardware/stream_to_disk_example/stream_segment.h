@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////
+//
+// stream_segment.h - header file
+//
+// Writes a long recording as a series of stream logs of bounded size,
+// called segments, for recordings lasting many hours.
+//
+// Each segment is a complete stream log (see stream_log.h) named
+// <base>_0000.qsl, <base>_0001.qsl and so on. Segment numbers beyond
+// 9999 take as many digits as they need, as in <base>_10000.qsl. A
+// segment file is allocated at its full size when it is created and is
+// filled through a memory mapping, so writing a chunk is a copy into
+// memory rather than a call through the C library's buffering. The
+// chunks are packed in an aligned buffer first, since their places in
+// the mapping are not aligned for their samples. When the next chunk
+// would not fit, or the segment covers the configured duration, the
+// segment is closed and the next one is started.
+//
+// Every segment ends with an index of its chunks. The index entries
+// are kept at the end of the mapping while the segment is being
+// written, and are moved into place behind the last chunk when the
+// segment is closed. The mapping is then flushed to the file and the
+// file is truncated to its used length.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _stream_segment_h
+#define _stream_segment_h
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "stream_log.h"
+
+#define STREAM_SEGMENT_EXTENSION    ".qsl"  /* extension of every segment file */
+#define STREAM_SEGMENT_MIN_DIGITS   (4)     /* fewest digits in a segment number, which is padded with zeros */
+#define STREAM_SEGMENT_MAX_DIGITS   (10)    /* most digits in a segment number */
+#define STREAM_SEGMENT_MAX_SUFFIX   (15)    /* longest suffix added to the base name, such as "_4294967295.qsl" */
+
+struct stream_segment_writer
+{
+    char                     base_name[_MAX_PATH]; /* segment file names without the suffix */
+    struct stream_log_header header;            /* header written at the start of every segment */
+    t_uint32 *               channels;          /* analog channel numbers followed by the encoder channel numbers */
+    t_ubyte *                buffer;            /* aligned buffer in which each chunk is packed before it is copied into the mapping */
+    t_uint32                 encoding;          /* STREAM_LOG_ENCODING_xxx used for every chunk */
+    size_t                   segment_size;      /* size of each segment file in bytes */
+    t_uint64                 segment_samples;   /* most samples in one segment, or zero for no limit */
+    t_uint32                 segment_number;    /* number of the current segment */
+
+    /* The current segment */
+    t_ubyte *                base;              /* start of the mapping, or NULL if no segment is open */
+    size_t                   used;              /* bytes of the mapping used by the header and chunks */
+    t_uint32                 num_entries;       /* number of index entries stored at the end of the mapping */
+    t_uint64                 first_sample;      /* index of the first sample in the segment */
+    t_uint64                 end_sample;        /* index of the sample following the last sample in the segment */
+#if defined(_WIN32)
+    HANDLE                   file;              /* segment file */
+    HANDLE                   mapping;           /* file mapping of the segment file */
+#else
+    int                      file;              /* segment file descriptor */
+#endif
+};
+
+/*
+    Build the name of the given segment from the base name. A buffer of STREAM_SEGMENT_MAX_SUFFIX
+    characters more than the base name always holds the name. Returns 0 on success and -1 if the
+    name does not fit in the buffer.
+*/
+extern t_int
+stream_segment_filename(char * filename, size_t length, const char * base_name, t_uint32 segment_number);
+
+/*
+    Get the base name and segment number from the name of a segment file. Returns 0 on success
+    and -1 if the name does not end in a segment suffix or the base name does not fit in the buffer.
+*/
+extern t_int
+stream_segment_parse_filename(const char * filename, char * base_name, size_t length, t_uint32 * segment_number);
+
+/*
+    Prepare to record into segments of segment_size bytes, each covering at most segment_duration
+    seconds (zero for no limit). Chunks are written in the given encoding. The first segment is
+    created when the first chunk is written. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_segment_writer_open(struct stream_segment_writer * writer, const char * base_name, t_double frequency, t_clock clock,
+                           const t_uint32 analog_channels[], t_uint32 num_analog_channels,
+                           const t_uint32 encoder_channels[], t_uint32 num_encoder_channels,
+                           t_uint32 max_chunk_samples, t_uint32 encoding, size_t segment_size, t_double segment_duration);
+
+/*
+    Write one chunk of samples, starting a new segment first if necessary. The arguments are
+    the same as for stream_log_writer_write. Returns 0 on success and -1 on failure.
+*/
+extern t_int
+stream_segment_writer_write(struct stream_segment_writer * writer, t_uint64 first_sample,
+                            const t_double * voltages, const t_int32 * counts, t_uint32 num_samples);
+
+/*
+    Finish the current segment and release the resources of the writer.
+    Returns 0 on success and -1 if the last segment could not be completed.
+*/
+extern t_int
+stream_segment_writer_close(struct stream_segment_writer * writer);
+
+#endif
@@ -7,6 +7,39 @@
 // channels 0 and 1, at a sampling rate of 1kHz. The data is written to
 // a file as it is collected.
 //
+// The data may be written as formatted text or as a binary stream log
+// (see stream_log.h). The binary format stores each block returned by
+// hil_task_read as fixed-width columns, which takes far less processing
+// time and disk space than formatting every sample. Use the
+// stream_log_export example to convert a stream log to text.
+//
+// The file is written by a separate writer thread so that a slow disk
+// never delays the calls to hil_task_read. The reading thread only fills
+// preallocated blocks in a lock-free ring (see sample_ring.h) which the
+// writer thread drains to disk. If the writer falls so far behind that
+// the ring is full, blocks are dropped rather than letting the task
+// buffer overflow. The number of dropped blocks and the most blocks ever
+// waiting in the ring are reported when the example stops.
+//
+// For recordings lasting many hours, the segmented format writes a
+// series of stream logs of bounded size (see stream_segment.h). Each
+// segment is allocated up front and filled through a memory mapping,
+// and a new segment is started once the current one is full or covers
+// the configured duration. Every segment ends with an index of its
+// chunks so any time range can be exported without reading the rest
+// of the recording.
+//
+// The binary and segmented formats may optionally compress each chunk
+// without loss (see stream_codec.h). Encoder counts that change by a
+// few counts per sample then take about one byte per sample, and
+// steady voltages take a bit or two.
+//
+// The text format is produced by a specialized formatter (see
+// text_format.h) rather than fprintf. Each block is formatted into one
+// buffer and written with a single call. The text is exactly the same
+// as that of fprintf. The stream_text_format_performance example
+// compares the two.
+//
 // Data collection is started using the hil_task_start function.
 // The data is then read from the C API's internal buffer in one second
 // intervals (1000 samples), using the hil_task_read function.
@@ -27,6 +60,62 @@
     
 #include "stream_to_disk_example.h"
 
+#define SAMPLES_TO_READ     1000    /* one second's worth */
+#define RING_BLOCKS         16      /* blocks buffered between the reading thread and the writer thread (a power of two) */
+
+/*
+    The formats in which the data may be recorded.
+*/
+enum recording_format
+{
+    RECORDING_FORMAT_TEXT,      /* one line of formatted text per sample */
+    RECORDING_FORMAT_BINARY,    /* binary stream log of column chunks (see stream_log.h) */
+    RECORDING_FORMAT_SEGMENTED  /* series of memory-mapped stream logs of bounded size (see stream_segment.h) */
+};
+
+/*
+    The state of a recording in progress.
+*/
+struct recording
+{
+    enum recording_format    format;        /* format of the recording */
+    FILE *                   file;          /* text file (text format only) */
+    char *                   text;          /* buffer in which a block is formatted (text format only) */
+    t_double                 time;          /* time of the next sample (text format only) */
+    t_uint64                 next_sample;   /* index of the next sample (text format only) */
+    struct stream_log_writer log;           /* stream log (binary format only) */
+    struct stream_segment_writer segments;  /* segment writer (segmented format only) */
+};
+
+static const t_uint32 analog_channels[]  = { 0, 1 };          /* analog input channels to read */
+static const t_uint32 encoder_channels[] = { 0, 1 };          /* encoder input channels to read */
+static const t_double frequency          = 1000;              /* sampling frequency in Hz */
+static const t_clock  sampling_clock     = HARDWARE_CLOCK_0;  /* clock used to pace the reader task */
+
+#define NUM_ANALOG_CHANNELS     ARRAY_LENGTH(analog_channels)
+#define NUM_ENCODER_CHANNELS    ARRAY_LENGTH(encoder_channels)
+
+/*
+    A block of samples read by one call to hil_task_read.
+*/
+struct sample_block
+{
+    t_uint64 first_sample;                                  /* index of the first sample since the start of the task */
+    t_int    num_samples;                                   /* number of samples in the block */
+    t_double voltages[SAMPLES_TO_READ][NUM_ANALOG_CHANNELS];
+    t_int32  counts[SAMPLES_TO_READ][NUM_ENCODER_CHANNELS];
+};
+
+/*
+    The state shared between the reading thread and the writer thread.
+*/
+struct writer_context
+{
+    struct sample_ring * ring;      /* ring of blocks waiting to be written */
+    struct recording *   recording; /* recording to which the blocks are written */
+    volatile int         failed;    /* set by the writer thread if the file could not be written */
+};
+
 static int stop = 0;
 
 void signal_handler(int signal)
@@ -34,6 +123,136 @@ void signal_handler(int signal)
     stop = 1;
 }
 
+/*
+    Create the file for the recording in the given format. The binary and segmented formats write
+    chunks in the given encoding. For the segmented format the file name is the base name of the
+    segments, each of which holds at most segment_size bytes and segment_duration seconds of data.
+    Returns 0 on success and -1 on failure.
+*/
+static t_int
+open_recording(struct recording * recording, enum recording_format format, t_uint32 encoding, const char * filename,
+               size_t segment_size, t_double segment_duration)
+{
+    recording->format      = format;
+    recording->file        = NULL;
+    recording->text        = NULL;
+    recording->time        = 0;
+    recording->next_sample = 0;
+
+    if (format == RECORDING_FORMAT_BINARY)
+        return stream_log_writer_open(&recording->log, filename, frequency, sampling_clock,
+            analog_channels, NUM_ANALOG_CHANNELS, encoder_channels, NUM_ENCODER_CHANNELS, SAMPLES_TO_READ, encoding);
+
+    if (format == RECORDING_FORMAT_SEGMENTED)
+        return stream_segment_writer_open(&recording->segments, filename, frequency, sampling_clock,
+            analog_channels, NUM_ANALOG_CHANNELS, encoder_channels, NUM_ENCODER_CHANNELS, SAMPLES_TO_READ,
+            encoding, segment_size, segment_duration);
+
+    recording->text = (char *) malloc(SAMPLES_TO_READ * text_format_sample_size(NUM_ANALOG_CHANNELS, NUM_ENCODER_CHANNELS));
+    if (recording->text == NULL)
+        return -1;
+
+    if (stdfile_open(filename, "wt", &recording->file) != 0)
+    {
+        free(recording->text);
+        return -1;
+    }
+
+    /* Each block is formatted in full before it is written, so the file needs no buffering of its own */
+    setvbuf(recording->file, NULL, _IONBF, 0);
+    return 0;
+}
+
+/*
+    Write a block of samples returned by hil_task_read to the recording.
+    Returns 0 on success and -1 on failure.
+*/
+static t_int
+write_recording(struct recording * recording, const struct sample_block * block)
+{
+    const t_double period = 1.0 / frequency;
+
+    char * text = recording->text;
+    t_int  index;
+
+    if (recording->format == RECORDING_FORMAT_BINARY)
+        return stream_log_writer_write(&recording->log, block->first_sample, &block->voltages[0][0], &block->counts[0][0], block->num_samples);
+
+    if (recording->format == RECORDING_FORMAT_SEGMENTED)
+        return stream_segment_writer_write(&recording->segments, block->first_sample, &block->voltages[0][0], &block->counts[0][0], block->num_samples);
+
+    /* Account for any dropped blocks so the times remain correct */
+    for (; recording->next_sample < block->first_sample; recording->next_sample++)
+        recording->time += period;
+
+    /* Format the whole block and write it with one call */
+    for (index = 0; index < block->num_samples; index++)
+    {
+        text = text_format_sample(text, recording->time, analog_channels, block->voltages[index], NUM_ANALOG_CHANNELS,
+                                  encoder_channels, block->counts[index], NUM_ENCODER_CHANNELS);
+        recording->time += period;
+    }
+
+    recording->next_sample += block->num_samples;
+    return (fwrite(recording->text, 1, text - recording->text, recording->file) == (size_t) (text - recording->text)) ? 0 : -1;
+}
+
+/*
+    Close the recording. Returns 0 on success and -1 if the end of the recording could not be written.
+*/
+static t_int
+close_recording(struct recording * recording)
+{
+    t_int result = 0;
+
+    if (recording->format == RECORDING_FORMAT_BINARY)
+        result = stream_log_writer_close(&recording->log);
+    else if (recording->format == RECORDING_FORMAT_SEGMENTED)
+        result = stream_segment_writer_close(&recording->segments);
+    else
+    {
+        if (stdfile_close(recording->file) != 0)
+            result = -1;
+        free(recording->text);
+    }
+
+    return result;
+}
+
+/*
+    The writer thread. Writes the blocks committed to the ring by the reading thread
+    until the ring is closed and drained.
+*/
+static void *
+writer_thread(void * argument)
+{
+    struct writer_context * context = (struct writer_context *) argument;
+    t_timeout idle_interval;
+
+    idle_interval.seconds     = 0;
+    idle_interval.nanoseconds = 10000000; /* 10 ms */
+    idle_interval.is_absolute = false;
+
+    while (!sample_ring_is_drained(context->ring))
+    {
+        const struct sample_block * block = (const struct sample_block *) sample_ring_acquire_read(context->ring);
+        if (block != NULL)
+        {
+            if (!context->failed && write_recording(context->recording, block) != 0)
+                context->failed = 1; /* keep draining the ring so the reading thread never stalls */
+
+            sample_ring_release_read(context->ring);
+
+            printf(".");
+            fflush(stdout);
+        }
+        else
+            qtimer_sleep(&idle_interval);
+    }
+
+    return NULL;
+}
+
 int main(int argc, char * argv[])
 {
     static const char board_type[]       = "q2_usb";
@@ -55,90 +274,166 @@ int main(int argc, char * argv[])
     if (result == 0)
     {
         const t_uint32  samples              = -1; /* read continuously */
-        const t_uint32  analog_channels[]    = { 0, 1 };
-        const t_uint32  encoder_channels[]   = { 0, 1 };
-        const t_double  frequency            = 1000;
-
-        #define NUM_ANALOG_CHANNELS     ARRAY_LENGTH(analog_channels)
-        #define NUM_ENCODER_CHANNELS    ARRAY_LENGTH(encoder_channels)
-        #define SAMPLES_TO_READ         1000    /* one second's worth */
-
         const t_uint32  samples_in_buffer    = (t_uint32)(2 * SAMPLES_TO_READ); /* double buffer */
-        const t_double  period               = 1.0 / frequency;
 
-        static t_int32  counts[SAMPLES_TO_READ][NUM_ENCODER_CHANNELS];
-        static t_double voltages[SAMPLES_TO_READ][NUM_ANALOG_CHANNELS];
-        static const char default_filename[] = "data.txt";
+        static struct sample_block discarded_block; /* read into when the ring is full */
+        static const char default_text_filename[]   = "data.txt";
+        static const char default_binary_filename[] = "data.qsl";
+        static const char default_segment_name[]    = "data";
+        static const t_double default_segment_size     = 256;  /* MB */
+        static const t_double default_segment_duration = 3600; /* seconds */
 
+        enum recording_format format;
+        t_uint32 encoding = STREAM_LOG_ENCODING_RAW;
+        struct recording recording;
+        struct sample_ring ring;
+        struct writer_context context;
+        qthread_t writer;
+        const char * default_filename;
+        t_double segment_size     = 0;
+        t_double segment_duration = 0;
         t_int  samples_read;
         t_task task;
         char filename[_MAX_PATH];
-        FILE * file_handle;
 
         printf("This example reads the first two analog input channels and encoder channels\n");
         printf("at %g Hz, continuously, writing the data to a file.\n", frequency);
         
         printf("Press CTRL-C to stop reading.\n\n");
-        printf("Enter the name of the file to which to write the data [%s]:\n", default_filename);
+        printf("Enter the format in which to write the data, text, binary or segmented [text]:\n");
+        fgets(filename, ARRAY_LENGTH(filename), stdin);
+        if (filename[0] == 'b' || filename[0] == 'B')
+        {
+            format           = RECORDING_FORMAT_BINARY;
+            default_filename = default_binary_filename;
+        }
+        else if (filename[0] == 's' || filename[0] == 'S')
+        {
+            format           = RECORDING_FORMAT_SEGMENTED;
+            default_filename = default_segment_name;
+
+            printf("Enter the size of each segment in MB [%g]:\n", default_segment_size);
+            fgets(filename, ARRAY_LENGTH(filename), stdin);
+            segment_size = atof(filename);
+            if (segment_size <= 0)
+                segment_size = default_segment_size;
+
+            printf("Enter the longest time each segment may cover in seconds, or 0 for no limit [%g]:\n", default_segment_duration);
+            fgets(filename, ARRAY_LENGTH(filename), stdin);
+            segment_duration = (filename[0] == '\n' || filename[0] == '\0') ? default_segment_duration : atof(filename);
+        }
+        else
+        {
+            format           = RECORDING_FORMAT_TEXT;
+            default_filename = default_text_filename;
+        }
+
+        if (format != RECORDING_FORMAT_TEXT)
+        {
+            printf("Compress the data, yes or no [no]:\n");
+            fgets(filename, ARRAY_LENGTH(filename), stdin);
+            if (filename[0] == 'y' || filename[0] == 'Y')
+                encoding = STREAM_LOG_ENCODING_COMPRESSED;
+        }
+
+        if (format == RECORDING_FORMAT_SEGMENTED)
+            printf("Enter the name of the segment files, without the \"_0000%s\" suffix [%s]:\n", STREAM_SEGMENT_EXTENSION, default_filename);
+        else
+            printf("Enter the name of the file to which to write the data [%s]:\n", default_filename);
         fgets(filename, ARRAY_LENGTH(filename), stdin); /* use fgets to avoid deprecation warnings that occur on some systems */
         filename[string_length(filename, sizeof(filename)) - 1] = '\0';
         if (filename[0] == '\0')
             string_copy(filename, sizeof(filename), default_filename);
         
-        if (stdfile_open(filename, "wt", &file_handle) == 0)
+        if (sample_ring_create(&ring, sizeof(struct sample_block), RING_BLOCKS) != 0)
         {
-            t_double time = 0;
+            printf("Unable to allocate the sample buffers.\n");
+            hil_close(board);
+            return -1;
+        }
 
+        if (open_recording(&recording, format, encoding, filename, (size_t) (segment_size * 1024 * 1024), segment_duration) == 0)
+        {
             printf("\nWriting to the file. Each dot represents %d data points.\n", SAMPLES_TO_READ);
 
+            context.ring      = &ring;
+            context.recording = &recording;
+            context.failed    = 0;
+
             result = hil_task_create_reader(board, samples_in_buffer, analog_channels, NUM_ANALOG_CHANNELS,
                 encoder_channels, NUM_ENCODER_CHANNELS, NULL, 0, NULL, 0, &task);
             if (result == 0)
             {
-                result = hil_task_start(task, HARDWARE_CLOCK_0, frequency, samples);
+                result = qthread_create(&writer, NULL, writer_thread, &context);
                 if (result == 0)
                 {
-                    samples_read = hil_task_read(task, SAMPLES_TO_READ, &voltages[0][0], &counts[0][0], NULL, NULL);
-                    while (samples_read > 0 && stop == 0)
+                    result = hil_task_start(task, sampling_clock, frequency, samples);
+                    if (result == 0)
                     {
-                        t_uint channel;
-                        t_int index;
+                        t_uint64 next_sample = 0;
+                        struct sample_block * block;
 
-                        printf(".");
-                        fflush(stdout);
+                        /* Read straight into the next free block of the ring. If the writer has fallen so far behind that
+                           the ring is full, keep reading so the task buffer does not overflow but discard the block. */
+                        block = (struct sample_block *) sample_ring_acquire_write(&ring);
+                        if (block == NULL)
+                            block = &discarded_block;
 
-                        for (index = 0; index < samples_read; index++)
+                        samples_read = hil_task_read(task, SAMPLES_TO_READ, &block->voltages[0][0], &block->counts[0][0], NULL, NULL);
+                        while (samples_read > 0 && stop == 0 && !context.failed)
                         {
-                            fprintf(file_handle, "t: %8.4f  ", time);
-                            time += period;
-
-                            for (channel = 0; channel < NUM_ANALOG_CHANNELS; channel++)
-                                fprintf(file_handle, "ADC #%d: %5.3f    ", analog_channels[channel], voltages[index][channel]);
-                            for (channel = 0; channel < NUM_ENCODER_CHANNELS; channel++)
-                                fprintf(file_handle, "ENC #%d: %5d    ", encoder_channels[channel], counts[index][channel]);
-                            fprintf(file_handle, "\n");
+                            block->first_sample = next_sample;
+                            block->num_samples  = samples_read;
+                            next_sample += samples_read;
+
+                            if (block != &discarded_block)
+                                sample_ring_commit_write(&ring);
+                            else
+                                sample_ring_drop_write(&ring);
+
+                            block = (struct sample_block *) sample_ring_acquire_write(&ring);
+                            if (block == NULL)
+                                block = &discarded_block;
+
+                            samples_read = hil_task_read(task, SAMPLES_TO_READ, &block->voltages[0][0], &block->counts[0][0], NULL, NULL);
                         }
 
-                        samples_read = hil_task_read(task, SAMPLES_TO_READ, &voltages[0][0], &counts[0][0], NULL, NULL);
-                    }
+                        hil_task_stop(task);
 
-                    hil_task_stop(task);
+                        /* Let the writer thread finish writing the blocks still in the ring */
+                        sample_ring_close(&ring);
+                        qthread_join(writer, NULL);
 
-                    if (samples_read < 0)
-                    {
-                        msg_get_error_message(NULL, samples_read, message, ARRAY_LENGTH(message));
-                        printf("Unable to read channels. %s Error %d.\n", message, -samples_read);
+                        printf("\nAt most %u of %u blocks were waiting to be written. %u blocks were dropped.\n",
+                            ring.high_water_mark, ring.num_blocks, ring.dropped_blocks);
+
+                        if (context.failed)
+                            printf("Unable to write to the file \"%s\".\n", filename);
+
+                        if (samples_read < 0)
+                        {
+                            msg_get_error_message(NULL, samples_read, message, ARRAY_LENGTH(message));
+                            printf("Unable to read channels. %s Error %d.\n", message, -samples_read);
+                        }
+                        else
+                        {
+                            printf("\nRead operation has been stopped. Press Enter to continue.\n");
+                            getchar(); /* absorb Ctrl+C */
+                        }
                     }
                     else
                     {
-                        printf("\nRead operation has been stopped. Press Enter to continue.\n");
-                        getchar(); /* absorb Ctrl+C */
+                        sample_ring_close(&ring);
+                        qthread_join(writer, NULL);
+
+                        msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
+                        printf("Unable to start task. %s Error %d.\n", message, -result);
                     }
                 }
                 else
                 {
                     msg_get_error_message(NULL, result, message, ARRAY_LENGTH(message));
-                    printf("Unable to start task. %s Error %d.\n", message, -result);
+                    printf("Unable to create the writer thread. %s Error %d.\n", message, -result);
                 }
 
                 hil_task_delete(task);
@@ -149,11 +444,14 @@ int main(int argc, char * argv[])
                 printf("Unable to create task. %s Error %d.\n", message, -result);
             }
 
-            stdfile_close(file_handle);
+            if (close_recording(&recording) != 0)
+                printf("Unable to complete the file \"%s\".\n", filename);
         }
         else
             printf("Unable to open file \"%s\".\n", filename);
 
+        sample_ring_destroy(&ring);
+
         hil_close(board);
     }
     else
@@ -16,4 +16,11 @@
 #include "quanser_signal.h"
 #include "quanser_messages.h"
 #include "quanser_file.h"
-#include "quanser_string.h"
\ No newline at end of file
+#include "quanser_string.h"
+#include "quanser_thread.h"
+#include "quanser_timer.h"
+
+#include "stream_log.h"
+#include "stream_segment.h"
+#include "sample_ring.h"
+#include "text_format.h"
@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////
+//
+// text_format.c - C file
+//
+// Implements the text formatting of samples described in
+// text_format.h.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "text_format.h"
+
+/* Scaled values are converted to integers only below this limit, where a t_double is accurate to well under 1/1000 */
+#define MAX_SCALED_VALUE    (8796093022208.0)   /* 2^43 */
+
+static const t_double decimal_scales[]  = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+static const t_uint64 decimal_divisors[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+/*
+    Write the decimal digits of the value, least significant first, into the end of the digits
+    buffer, producing at least min_digits digits. Returns a pointer to the most significant digit.
+*/
+static char *
+format_digits(char * end, t_uint64 value, t_int min_digits)
+{
+    char * digit = end;
+
+    do
+    {
+        *--digit = (char) ('0' + value % 10);
+        value /= 10;
+        --min_digits;
+    } while (value != 0 || min_digits > 0);
+
+    return digit;
+}
+
+/*
+    Copy the formatted characters to the output, padded on the left with spaces to the given width.
+*/
+static char *
+format_padded(char * output, const char * text, size_t length, t_int width)
+{
+    while (width > (t_int) length)
+    {
+        *output++ = ' ';
+        --width;
+    }
+
+    memcpy(output, text, length);
+    return output + length;
+}
+
+char *
+text_format_fixed(char * output, t_double value, t_int width, t_int precision)
+{
+    t_double magnitude;
+    t_double scaled;
+    t_double whole;
+    t_double fraction;
+
+    if (precision >= 0 && precision < (t_int) (sizeof(decimal_scales) / sizeof(decimal_scales[0])))
+    {
+        magnitude = fabs(value);
+        scaled    = magnitude * decimal_scales[precision];
+
+        /* The comparison is false for NaN and infinity */
+        if (scaled < MAX_SCALED_VALUE)
+        {
+            whole    = floor(scaled);
+            fraction = scaled - whole; /* exact */
+
+            /*
+                The product may be off by half a unit in the last place, so it only decides the rounding
+                if the fraction is clearly away from one half. Otherwise snprintf rounds the exact value.
+            */
+            if (fabs(fraction - 0.5) > scaled * 2.3e-16)
+            {
+                const t_uint64 rounded = (t_uint64) whole + (fraction > 0.5);
+                char digits[40];
+                char * end = digits + sizeof(digits);
+                char * start;
+
+                if (precision > 0)
+                {
+                    start  = format_digits(end, rounded % decimal_divisors[precision], precision);
+                    *--start = '.';
+                    start  = format_digits(start, rounded / decimal_divisors[precision], 1);
+                }
+                else
+                    start = format_digits(end, rounded, 1);
+
+                /* printf keeps the sign of negative values that round to zero, including -0 */
+                if (signbit(value))
+                    *--start = '-';
+
+                return format_padded(output, start, (size_t) (end - start), width);
+            }
+        }
+    }
+
+    return output + snprintf(output, TEXT_FORMAT_MAX_NUMBER, "%*.*f", width, precision, value);
+}
+
+char *
+text_format_integer(char * output, t_int32 value, t_int width)
+{
+    char digits[16];
+    char * end = digits + sizeof(digits);
+    char * start;
+
+    if (value < 0)
+    {
+        start    = format_digits(end, (t_uint64) -(t_int64) value, 1);
+        *--start = '-';
+    }
+    else
+        start = format_digits(end, (t_uint64) value, 1);
+
+    return format_padded(output, start, (size_t) (end - start), width);
+}
+
+size_t
+text_format_sample_size(t_uint32 num_analog_channels, t_uint32 num_encoder_channels)
+{
+    static const size_t time_size    = sizeof("t: ") - 1 + TEXT_FORMAT_MAX_NUMBER + sizeof("  ") - 1;
+    static const size_t channel_size = sizeof("ADC #") - 1 + TEXT_FORMAT_MAX_NUMBER + sizeof(": ") - 1 + TEXT_FORMAT_MAX_NUMBER + sizeof("    ") - 1;
+
+    return time_size + (num_analog_channels + num_encoder_channels) * channel_size + 1;
+}
+
+char *
+text_format_sample(char * output, t_double time,
+                   const t_uint32 analog_channels[], const t_double * voltages, t_uint32 num_analog_channels,
+                   const t_uint32 encoder_channels[], const t_int32 * counts, t_uint32 num_encoder_channels)
+{
+    t_uint32 channel;
+
+    memcpy(output, "t: ", 3);
+    output = text_format_fixed(output + 3, time, 8, 4);
+    memcpy(output, "  ", 2);
+    output += 2;
+
+    for (channel = 0; channel < num_analog_channels; channel++)
+    {
+        memcpy(output, "ADC #", 5);
+        output = text_format_integer(output + 5, (t_int32) analog_channels[channel], 0);
+        memcpy(output, ": ", 2);
+        output = text_format_fixed(output + 2, voltages[channel], 5, 3);
+        memcpy(output, "    ", 4);
+        output += 4;
+    }
+
+    for (channel = 0; channel < num_encoder_channels; channel++)
+    {
+        memcpy(output, "ENC #", 5);
+        output = text_format_integer(output + 5, (t_int32) encoder_channels[channel], 0);
+        memcpy(output, ": ", 2);
+        output = text_format_integer(output + 2, counts[channel], 5);
+        memcpy(output, "    ", 4);
+        output += 4;
+    }
+
+    *output++ = '\n';
+    return output;
+}
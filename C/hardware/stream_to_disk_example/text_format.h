@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////
+//
+// text_format.h - header file
+//
+// Formats samples as text for the text recordings written by the
+// stream_to_disk_example and the stream_log_export example, without
+// going through printf.
+//
+// The output is byte for byte the same as the printf formats used for
+// the text recordings. Numbers are converted with integer arithmetic
+// and written straight into a caller-supplied buffer, so a whole block
+// of samples can be formatted and then written with a single call.
+// The few values whose rounding cannot be decided exactly this way,
+// such as values lying almost exactly halfway between two results, and
+// values too large for the integer arithmetic, are passed to snprintf.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#ifndef _text_format_h
+#define _text_format_h
+
+#include <stddef.h>
+
+#include "quanser_types.h"
+
+#define TEXT_FORMAT_MAX_NUMBER      (330)   /* room needed to format any t_double or t_int32, including the terminating null */
+
+/*
+    Write the value the way printf("%*.*f", width, precision, value) does, for a precision of at
+    most 9. The output must have room for TEXT_FORMAT_MAX_NUMBER characters. No terminating null
+    is written. Returns a pointer to the character following the value.
+*/
+extern char *
+text_format_fixed(char * output, t_double value, t_int width, t_int precision);
+
+/*
+    Write the value the way printf("%*d", width, value) does. The output must have room for
+    TEXT_FORMAT_MAX_NUMBER characters. No terminating null is written. Returns a pointer to the
+    character following the value.
+*/
+extern char *
+text_format_integer(char * output, t_int32 value, t_int width);
+
+/*
+    Largest number of characters written by text_format_sample for the given numbers of channels.
+*/
+extern size_t
+text_format_sample_size(t_uint32 num_analog_channels, t_uint32 num_encoder_channels);
+
+/*
+    Write one line of a text recording for a sample taken at the given time. The line is the same
+    as that written by
+
+        fprintf(file, "t: %8.4f  ", time);
+        fprintf(file, "ADC #%d: %5.3f    ", analog_channels[channel], voltages[channel]);  for each analog channel
+        fprintf(file, "ENC #%d: %5d    ", encoder_channels[channel], counts[channel]);    for each encoder channel
+        fprintf(file, "\n");
+
+    The output must have room for text_format_sample_size characters. No terminating null is
+    written. Returns a pointer to the character following the line.
+*/
+extern char *
+text_format_sample(char * output, t_double time,
+                   const t_uint32 analog_channels[], const t_double * voltages, t_uint32 num_analog_channels,
+                   const t_uint32 encoder_channels[], const t_int32 * counts, t_uint32 num_encoder_channels);
+
+#endif
@@ -0,0 +1,296 @@
+//////////////////////////////////////////////////////////////////
+//
+// value_parser_performance.c - C file
+//
+// This example compares how quickly a large text file of voltages can
+// be parsed using fgets and strtod, as the stream_from_disk_example
+// originally did, and using the parser in value_parser.h, which reads
+// the file a large block at a time and converts the numbers itself.
+//
+// A text file of the size entered, 1 GB by default, is generated in the
+// format written by the stream_from_disk_example: a line of channel
+// names followed by one line of tab-separated voltages per sample. Most
+// channels hold sine waves written with six decimal places. The last
+// channel holds values written with seventeen significant digits, which
+// exercise the numbers the parser hands to strtod.
+//
+// The file is then parsed with each method. Every value is folded into
+// a checksum of its bit pattern, and the checksums are compared to
+// confirm that both methods produce exactly the same voltages.
+//
+// No hardware is required to run this example.
+//
+// This performance example demonstrates the use of the following functions:
+//    timeout_get_high_resolution_time
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include "value_parser_performance.h"
+
+#define NUM_CHANNELS        8           /* voltages on each line */
+#define SAMPLES_PER_BLOCK   1000        /* samples parsed per block, as in the stream_from_disk_example */
+#define TEXT_BUFFER_SIZE    (1 << 20)   /* bytes of text read at a time by the value parser */
+
+static t_double voltages[SAMPLES_PER_BLOCK][NUM_CHANNELS];
+
+/*
+    Totals gathered while parsing a file.
+*/
+struct parse_result
+{
+    t_uint64 num_samples;   /* number of lines of voltages parsed */
+    t_uint64 checksum;      /* checksum of the bit patterns of all the voltages */
+    t_double elapsed;       /* time taken in seconds */
+};
+
+/*
+    Read a line from the console, using the default if nothing is entered.
+*/
+static void
+read_line(char * line, size_t length, const char * default_line)
+{
+    fgets(line, (int) length, stdin); /* use fgets to avoid deprecation warnings that occur on some systems */
+    line[string_length(line, length) - 1] = '\0';
+    if (line[0] == '\0')
+        string_copy(line, length, default_line);
+}
+
+/*
+    Fold a block of voltages into the checksum.
+*/
+static t_uint64
+update_checksum(t_uint64 checksum, const t_double * values, size_t count)
+{
+    size_t index;
+
+    for (index = 0; index < count; index++)
+    {
+        t_uint64 bits;
+
+        memcpy(&bits, &values[index], sizeof(bits));
+        checksum = (checksum ^ bits) * 0x100000001B3ull;
+    }
+
+    return checksum;
+}
+
+/*
+    Generate a text file of at least the given size. Returns the number of bytes written, or zero
+    if the file could not be written.
+*/
+static t_uint64
+generate_file(const char * filename, t_uint64 size)
+{
+    static char buffer[SAMPLES_PER_BLOCK * NUM_CHANNELS * TEXT_FORMAT_MAX_NUMBER];
+
+    const t_double period = 0.001;
+    t_uint64 bytes  = 0;
+    t_uint64 sample = 0;
+    FILE *   file;
+    t_uint   channel;
+
+    if (stdfile_open(filename, "wb", &file) != 0)
+        return 0;
+
+    for (channel = 0; channel < NUM_CHANNELS; channel++)
+        bytes += fprintf(file, "DAC #%u\t", channel);
+    bytes += fprintf(file, "\n");
+
+    while (bytes < size)
+    {
+        char * text = buffer;
+        t_uint index;
+
+        for (index = 0; index < SAMPLES_PER_BLOCK; index++, sample++)
+        {
+            const t_double time = sample * period;
+
+            for (channel = 0; channel < NUM_CHANNELS - 1; channel++)
+            {
+                text = text_format_fixed(text, (channel + 7.0) * sin(2 * M_PI * (channel + 1) * time), 0, 6);
+                *text++ = '\t';
+            }
+
+            text += snprintf(text, TEXT_FORMAT_MAX_NUMBER, "%.17g\t\n", 10.0 * cos(2 * M_PI * time) / (time + 1));
+        }
+
+        if (fwrite(buffer, 1, text - buffer, file) != (size_t) (text - buffer))
+        {
+            stdfile_close(file);
+            return 0;
+        }
+
+        bytes += text - buffer;
+    }
+
+    stdfile_close(file);
+    return bytes;
+}
+
+/*
+    Parse the file with fgets and strtod, the way the stream_from_disk_example originally did.
+    Returns 0 on success and -1 if the file cannot be read.
+*/
+static t_int
+parse_with_strtod(const char * filename, struct parse_result * result)
+{
+    static char line[512];
+
+    t_timeout start_time, stop_time, interval;
+    FILE * file;
+
+    if (stdfile_open(filename, "rt", &file) != 0)
+        return -1;
+
+    memset(result, 0, sizeof(*result));
+    timeout_get_high_resolution_time(&start_time);
+
+    /* Skip the line of channel names */
+    fgets(line, sizeof(line), file);
+
+    for (;;)
+    {
+        t_uint samples_read;
+
+        for (samples_read = 0; samples_read < SAMPLES_PER_BLOCK; samples_read++)
+        {
+            if (fgets(line, sizeof(line), file))
+            {
+                t_uint channel;
+                char * position = &line[0];
+
+                for (channel = 0; channel < NUM_CHANNELS; channel++)
+                    voltages[samples_read][channel] = strtod(position, &position);
+            }
+            else
+                break;
+        }
+
+        result->checksum     = update_checksum(result->checksum, &voltages[0][0], (size_t) samples_read * NUM_CHANNELS);
+        result->num_samples += samples_read;
+
+        if (samples_read < SAMPLES_PER_BLOCK)
+            break;
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+    result->elapsed = interval.seconds + interval.nanoseconds * 1e-9;
+
+    stdfile_close(file);
+    return 0;
+}
+
+/*
+    Parse the file with the value parser. Returns 0 on success and -1 if the file cannot be read.
+*/
+static t_int
+parse_with_value_parser(const char * filename, struct parse_result * result)
+{
+    static char line[512];
+    static char text[TEXT_BUFFER_SIZE];
+
+    t_timeout start_time, stop_time, interval;
+    struct value_reader reader;
+    FILE * file;
+
+    if (stdfile_open(filename, "rt", &file) != 0)
+        return -1;
+
+    memset(result, 0, sizeof(*result));
+    timeout_get_high_resolution_time(&start_time);
+
+    /* Skip the line of channel names */
+    fgets(line, sizeof(line), file);
+    value_reader_init(&reader, file, text, sizeof(text));
+
+    for (;;)
+    {
+        const t_uint32 samples_read = value_reader_read(&reader, NUM_CHANNELS, &voltages[0][0], SAMPLES_PER_BLOCK);
+
+        result->checksum     = update_checksum(result->checksum, &voltages[0][0], (size_t) samples_read * NUM_CHANNELS);
+        result->num_samples += samples_read;
+
+        if (samples_read < SAMPLES_PER_BLOCK)
+            break;
+    }
+
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+    result->elapsed = interval.seconds + interval.nanoseconds * 1e-9;
+
+    stdfile_close(file);
+    return 0;
+}
+
+/*
+    Print the speed of one method.
+*/
+static void
+print_result(const char * method, const struct parse_result * result, t_uint64 bytes)
+{
+    printf("%-14s %f seconds (%.1f MB/s or %.3f usecs per sample)\n", method, result->elapsed,
+        bytes / result->elapsed / (1024 * 1024), result->elapsed / (t_double) result->num_samples * 1e6);
+}
+
+int main(int argc, char * argv[])
+{
+    static const char default_filename[] = "values.txt";
+    static const char default_size[]     = "1024";
+
+    struct parse_result strtod_result;
+    struct parse_result parser_result;
+    t_timeout start_time, stop_time, interval;
+    char      filename[_MAX_PATH];
+    char      line[64];
+    t_uint64  size;
+    t_uint64  bytes;
+
+    printf("This example compares parsing a large text file of voltages with strtod and with the value parser.\n\n");
+
+    printf("Enter the name of the text file to generate [%s]:\n", default_filename);
+    read_line(filename, sizeof(filename), default_filename);
+
+    printf("Enter the size of the file in MB [%s]:\n", default_size);
+    read_line(line, sizeof(line), default_size);
+    size = (t_uint64) strtoul(line, NULL, 10);
+    if (size == 0)
+        size = (t_uint64) strtoul(default_size, NULL, 10);
+
+    printf("\nGenerating \"%s\"...\n", filename);
+
+    timeout_get_high_resolution_time(&start_time);
+    bytes = generate_file(filename, size * 1024 * 1024);
+    timeout_get_high_resolution_time(&stop_time);
+    timeout_subtract(&interval, &stop_time, &start_time);
+
+    if (bytes == 0)
+    {
+        printf("Unable to write the file \"%s\".\n", filename);
+    }
+    else
+    {
+        printf("Generated %.1f MB in %f seconds.\n\n", bytes / (1024.0 * 1024.0), interval.seconds + interval.nanoseconds * 1e-9);
+
+        if (parse_with_strtod(filename, &strtod_result) == 0 && parse_with_value_parser(filename, &parser_result) == 0)
+        {
+            print_result("strtod:", &strtod_result, bytes);
+            print_result("value_parser:", &parser_result, bytes);
+
+            printf("\nThe value parser is %.1f times as fast as strtod.\n", strtod_result.elapsed / parser_result.elapsed);
+
+            if (strtod_result.num_samples == parser_result.num_samples && strtod_result.checksum == parser_result.checksum)
+                printf("Both methods parsed the same %.0f samples of %u voltages.\n", (double) parser_result.num_samples, NUM_CHANNELS);
+            else
+                printf("The parsed voltages DIFFER.\n");
+        }
+        else
+            printf("Unable to read the file \"%s\".\n", filename);
+    }
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+//////////////////////////////////////////////////////////////////
+//
+//	value_parser_performance.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+
+#include "quanser_file.h"
+#include "quanser_string.h"
+#include "quanser_time.h"
+
+#include "text_format.h"
+#include "value_parser.h"
@@ -0,0 +1,175 @@
+//////////////////////////////////////////////////////////////////
+//
+// waveform_import.c - C file
+//
+// This example converts a tab-separated text file of analog output
+// voltages, as generated by the stream_from_disk_example, into a binary
+// waveform file (see waveform_file.h). Comma-separated files may also
+// be converted. The numbers are parsed by the locale-independent parser
+// in value_parser.h, which gives exactly the same voltages as strtod. The stream_from_disk_example can
+// play a waveform file back without parsing it.
+//
+// The first line of the text file names the channels, as in "DAC #0",
+// and each following line holds one voltage per channel. Blank lines
+// are skipped. The text file does not record the sampling frequency, so
+// it is entered when the file is converted.
+//
+// No hardware is required to run this example.
+//
+// Copyright (C) 2026 Quanser Inc.
+//////////////////////////////////////////////////////////////////
+
+#include "waveform_import.h"
+
+#define MAX_CHANNELS        (64)    /* most channels in one text file */
+#define SAMPLES_PER_WRITE   (1000)  /* samples converted between writes to the waveform file */
+
+/*
+    Read a file name from the console, using the default if nothing is entered.
+*/
+static void
+read_filename(char * filename, size_t length, const char * default_filename)
+{
+    fgets(filename, (int) length, stdin); /* use fgets to avoid deprecation warnings that occur on some systems */
+    filename[string_length(filename, length) - 1] = '\0';
+    if (filename[0] == '\0')
+        string_copy(filename, length, default_filename);
+}
+
+/*
+    Get the channel numbers from the header line of the text file. Returns the number of channels.
+*/
+static t_uint32
+parse_channels(const char * line, t_uint32 channels[])
+{
+    static const char prefix[] = "DAC #";
+
+    t_uint32 num_channels = 0;
+    const char * position = strstr(line, prefix);
+
+    while (position != NULL && num_channels < MAX_CHANNELS)
+    {
+        channels[num_channels++] = (t_uint32) strtoul(position + sizeof(prefix) - 1, NULL, 10);
+        position = strstr(position + sizeof(prefix) - 1, prefix);
+    }
+
+    return num_channels;
+}
+
+/*
+    Returns true if the line holds nothing but white space, such as the blank line that many
+    editors leave at the end of a file.
+*/
+static t_boolean
+is_blank_line(const char * line)
+{
+    return line[strspn(line, " \t\r\n\v\f")] == '\0';
+}
+
+/*
+    Parse one voltage per channel from a line of the text file. The values may be separated by
+    tabs, spaces or commas. Returns 0 on success and -1 if the line holds too few values.
+*/
+static t_int
+parse_values(const char * line, t_uint32 num_channels, t_double * voltages)
+{
+    const char * position = line;
+    t_uint32 channel;
+
+    for (channel = 0; channel < num_channels; channel++)
+    {
+        position += strspn(position, " \t,");
+        if (value_parser_parse_number(position, &position, &voltages[channel]) != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char * argv[])
+{
+    static const char default_input_filename[]  = "sample_data.txt";
+    static const char default_output_filename[] = "sample_data.qwf";
+    static const t_double default_frequency     = 1000;
+
+    static t_double voltages[SAMPLES_PER_WRITE][MAX_CHANNELS];
+    static char line[4096];
+
+    struct waveform_writer writer;
+    t_uint32 channels[MAX_CHANNELS];
+    t_uint32 num_channels;
+    t_double frequency;
+    FILE * file_handle;
+    char input_filename[_MAX_PATH];
+    char output_filename[_MAX_PATH];
+
+    printf("This example converts a tab-separated text file of voltages to a binary waveform file.\n\n");
+
+    printf("Enter the name of the text file to convert [%s]:\n", default_input_filename);
+    read_filename(input_filename, sizeof(input_filename), default_input_filename);
+
+    printf("Enter the name of the waveform file to which to write the data [%s]:\n", default_output_filename);
+    read_filename(output_filename, sizeof(output_filename), default_output_filename);
+
+    printf("Enter the sampling frequency of the data in Hz [%g]:\n", default_frequency);
+    fgets(line, sizeof(line), stdin);
+    frequency = atof(line);
+    if (frequency <= 0)
+        frequency = default_frequency;
+
+    if (stdfile_open(input_filename, "rt", &file_handle) == 0)
+    {
+        if (fgets(line, sizeof(line), file_handle) != NULL && (num_channels = parse_channels(line, channels)) > 0)
+        {
+            if (waveform_writer_open(&writer, output_filename, frequency, channels, num_channels) == 0)
+            {
+                t_uint32 line_number = 1;
+                t_uint32 count       = 0;
+                t_int    result      = 0;
+
+                /* Parse the voltages into a contiguous block, num_channels per sample, and write each full block */
+                while (result == 0 && fgets(line, sizeof(line), file_handle) != NULL)
+                {
+                    ++line_number;
+                    if (is_blank_line(line))
+                        continue;
+
+                    if (parse_values(line, num_channels, &voltages[0][0] + (size_t) count * num_channels) != 0)
+                    {
+                        printf("Line %u of \"%s\" holds fewer than %u values.\n", line_number, input_filename, num_channels);
+                        result = -1;
+                    }
+                    else if (++count == SAMPLES_PER_WRITE)
+                    {
+                        result = waveform_writer_write(&writer, &voltages[0][0], count);
+                        count  = 0;
+                    }
+                }
+
+                if (result == 0 && count > 0)
+                    result = waveform_writer_write(&writer, &voltages[0][0], count);
+
+                if (waveform_writer_close(&writer) != 0)
+                    result = -1;
+
+                if (result == 0)
+                    printf("Converted %.0f samples of %u channels to \"%s\".\n", (double) writer.num_samples, num_channels, output_filename);
+                else
+                    printf("Unable to convert \"%s\" to \"%s\".\n", input_filename, output_filename);
+            }
+            else
+                printf("Unable to open file \"%s\".\n", output_filename);
+        }
+        else
+            printf("The file \"%s\" does not start with a line of channel names.\n", input_filename);
+
+        stdfile_close(file_handle);
+    }
+    else
+        printf("Unable to open file \"%s\".\n", input_filename);
+
+    printf("\nPress Enter to continue.\n");
+    getchar();
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+//////////////////////////////////////////////////////////////////
+//
+//	waveform_import.h - header file
+//
+//////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "quanser_file.h"
+#include "quanser_string.h"
+
+#include "waveform_file.h"
+#include "value_parser.h"